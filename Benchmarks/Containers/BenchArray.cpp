@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "Core/Containers/Array.h"
+
+namespace
+{
+	constexpr size_t ElementCount = 4096;
+
+	// The first argument is the SimdLevel the kernels are forced to
+	void SimdLevels(benchmark::internal::Benchmark* benchmark)
+	{
+		for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::Sse41, SimdLevel::Avx2 })
+		{
+			benchmark->Arg(static_cast<int64_t>(level));
+		}
+	}
+
+	void SetLevel(benchmark::State& state)
+	{
+		ArrayOps::SetSimdLevel(static_cast<SimdLevel>(state.range(0)));
+		state.SetLabel(GetSimdLevelName(ArrayOps::GetSimdLevel()));
+	}
+
+	template<typename T>
+	Array<T, ElementCount, 32>& GetArray()
+	{
+		static Array<T, ElementCount, 32> array = []()
+		{
+			Array<T, ElementCount, 32> values{};
+			for (size_t i = 0; i < ElementCount; ++i)
+			{
+				values[i] = static_cast<T>((i * 7919) % 1000);
+			}
+			return values;
+		}();
+		return array;
+	}
+}
+
+template<typename T>
+static void BM_ArrayFill(benchmark::State& state)
+{
+	SetLevel(state);
+	Array<T, ElementCount, 32>& array = GetArray<T>();
+	for (auto _ : state)
+	{
+		array.Fill(static_cast<T>(1));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ElementCount * sizeof(T)));
+}
+
+template<typename T>
+static void BM_ArrayCopy(benchmark::State& state)
+{
+	SetLevel(state);
+	static Array<T, ElementCount, 32> destination{};
+	for (auto _ : state)
+	{
+		destination.CopyFrom(GetArray<T>());
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ElementCount * sizeof(T)));
+}
+
+template<typename T>
+static void BM_ArraySum(benchmark::State& state)
+{
+	SetLevel(state);
+	const Array<T, ElementCount, 32>& array = GetArray<T>();
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(array.Sum());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ElementCount));
+}
+
+template<typename T>
+static void BM_ArrayMinMax(benchmark::State& state)
+{
+	SetLevel(state);
+	const Array<T, ElementCount, 32>& array = GetArray<T>();
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(array.MinMax());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ElementCount));
+}
+
+// Searches a value that is not there, so the whole array is scanned
+template<typename T>
+static void BM_ArrayFind(benchmark::State& state)
+{
+	SetLevel(state);
+	const Array<T, ElementCount, 32>& array = GetArray<T>();
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(array.Find(static_cast<T>(-1)));
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ElementCount));
+}
+
+#define NIH_ARRAY_BENCHMARK(function) \
+	BENCHMARK_TEMPLATE(function, float)->Apply(SimdLevels); \
+	BENCHMARK_TEMPLATE(function, int32_t)->Apply(SimdLevels)
+
+NIH_ARRAY_BENCHMARK(BM_ArrayFill);
+NIH_ARRAY_BENCHMARK(BM_ArrayCopy);
+NIH_ARRAY_BENCHMARK(BM_ArraySum);
+NIH_ARRAY_BENCHMARK(BM_ArrayMinMax);
+NIH_ARRAY_BENCHMARK(BM_ArrayFind);
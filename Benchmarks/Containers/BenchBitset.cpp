@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Core/Containers/DynamicBitset.h"
+#include "Core/Containers/HashSet.h"
+#include "Core/Containers/SparseSet.h"
+
+namespace
+{
+	// Visibility style sets, about one id in four is in the set
+	std::vector<uint32_t> MakeIds(size_t universe)
+	{
+		std::mt19937 random(42);
+		std::vector<uint32_t> ids;
+		for (uint32_t id = 0; id < universe; ++id)
+		{
+			if (random() % 4 == 0)
+			{
+				ids.push_back(id);
+			}
+		}
+		return ids;
+	}
+}
+
+// Intersection of two masks then count, DynamicBitset against std::vector<bool>
+static void BM_DynamicBitsetAndCount(benchmark::State& state)
+{
+	const size_t size = static_cast<size_t>(state.range(0));
+	DynamicBitset<> a(size);
+	DynamicBitset<> b(size);
+	for (uint32_t id : MakeIds(size))
+	{
+		a.Set(id);
+		b.Set((id * 7) % size);
+	}
+	DynamicBitset<> result(size);
+	for (auto _ : state)
+	{
+		result = a;
+		result &= b;
+		benchmark::DoNotOptimize(result.Count());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+static void BM_VectorBoolAndCount(benchmark::State& state)
+{
+	const size_t size = static_cast<size_t>(state.range(0));
+	std::vector<bool> a(size);
+	std::vector<bool> b(size);
+	for (uint32_t id : MakeIds(size))
+	{
+		a[id] = true;
+		b[(id * 7) % size] = true;
+	}
+	std::vector<bool> result(size);
+	for (auto _ : state)
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < size; ++i)
+		{
+			result[i] = a[i] && b[i];
+			count += result[i];
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+// Visits every member of a sparse mask
+static void BM_DynamicBitsetForEach(benchmark::State& state)
+{
+	const size_t size = static_cast<size_t>(state.range(0));
+	DynamicBitset<> bits(size);
+	for (uint32_t id : MakeIds(size))
+	{
+		bits.Set(id);
+	}
+	for (auto _ : state)
+	{
+		size_t sum = 0;
+		bits.ForEachSetBit([&sum](size_t index) { sum += index; });
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template<typename Set>
+static void BM_SetContains(benchmark::State& state)
+{
+	const size_t size = static_cast<size_t>(state.range(0));
+	Set set;
+	for (uint32_t id : MakeIds(size))
+	{
+		set.Insert(id);
+	}
+	for (auto _ : state)
+	{
+		size_t found = 0;
+		for (uint32_t id = 0; id < size; ++id)
+		{
+			found += set.Contains(id);
+		}
+		benchmark::DoNotOptimize(found);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+BENCHMARK(BM_DynamicBitsetAndCount)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK(BM_VectorBoolAndCount)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK(BM_DynamicBitsetForEach)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_SetContains, SparseSet<uint32_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_SetContains, HashSet<uint32_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
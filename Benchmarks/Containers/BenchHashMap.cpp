@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "Core/Containers/HashMap.h"
+#include "Core/Containers/Vector.h"
+
+namespace
+{
+	// Scattered keys, like resource ids or entity handles
+	Vector<uint64_t> MakeKeys(size_t count, uint64_t seed)
+	{
+		Vector<uint64_t> keys;
+		keys.Reserve(count);
+		uint64_t state = seed;
+		for (size_t i = 0; i < count; ++i)
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			keys.PushBackUnchecked(state ^ (state >> 29));
+		}
+		return keys;
+	}
+
+	using StdMap = std::unordered_map<uint64_t, uint64_t>;
+	using EngineMap = HashMap<uint64_t, uint64_t>;
+
+	void Insert(StdMap& map, uint64_t key, uint64_t value) { map.emplace(key, value); }
+	void Insert(EngineMap& map, uint64_t key, uint64_t value) { map.TryEmplace(key, value); }
+
+	const uint64_t* Find(const StdMap& map, uint64_t key)
+	{
+		const auto it = map.find(key);
+		return it != map.end() ? &it->second : nullptr;
+	}
+	const uint64_t* Find(const EngineMap& map, uint64_t key) { return map.Find(key); }
+
+	void Erase(StdMap& map, uint64_t key) { map.erase(key); }
+	void Erase(EngineMap& map, uint64_t key) { map.Erase(key); }
+
+	void ApplyRange(benchmark::internal::Benchmark* benchmark)
+	{
+		for (int64_t count = 1'000; count <= 10'000'000; count *= 10)
+		{
+			benchmark->Arg(count);
+		}
+		benchmark->Unit(benchmark::kMillisecond);
+	}
+}
+
+template<typename Map>
+static void BM_HashMapInsert(benchmark::State& state)
+{
+	const Vector<uint64_t> keys = MakeKeys(static_cast<size_t>(state.range(0)), 1);
+	for (auto _ : state)
+	{
+		Map map;
+		for (uint64_t key : keys)
+		{
+			Insert(map, key, key);
+		}
+		benchmark::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_HashMapInsert, StdMap)->Apply(ApplyRange);
+BENCHMARK_TEMPLATE(BM_HashMapInsert, EngineMap)->Apply(ApplyRange);
+
+// Half of the lookups hit, half miss
+template<typename Map>
+static void BM_HashMapFind(benchmark::State& state)
+{
+	const Vector<uint64_t> keys = MakeKeys(static_cast<size_t>(state.range(0)), 1);
+	const Vector<uint64_t> missingKeys = MakeKeys(static_cast<size_t>(state.range(0)), 2);
+	Map map;
+	for (uint64_t key : keys)
+	{
+		Insert(map, key, key);
+	}
+
+	for (auto _ : state)
+	{
+		uint64_t sum = 0;
+		for (size_t i = 0; i < keys.GetSize(); ++i)
+		{
+			const uint64_t key = (i & 1) != 0 ? keys[i] : missingKeys[i];
+			if (const uint64_t* value = Find(map, key))
+			{
+				sum += *value;
+			}
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_HashMapFind, StdMap)->Apply(ApplyRange);
+BENCHMARK_TEMPLATE(BM_HashMapFind, EngineMap)->Apply(ApplyRange);
+
+template<typename Map>
+static void BM_HashMapErase(benchmark::State& state)
+{
+	const Vector<uint64_t> keys = MakeKeys(static_cast<size_t>(state.range(0)), 1);
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		Map map;
+		for (uint64_t key : keys)
+		{
+			Insert(map, key, key);
+		}
+		state.ResumeTiming();
+
+		for (uint64_t key : keys)
+		{
+			Erase(map, key);
+		}
+		benchmark::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_HashMapErase, StdMap)->Apply(ApplyRange);
+BENCHMARK_TEMPLATE(BM_HashMapErase, EngineMap)->Apply(ApplyRange);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "Core/Containers/MpmcQueue.h"
+#include "Core/Containers/SpscQueue.h"
+
+namespace
+{
+	constexpr size_t QueueCapacity = 1024;
+	constexpr size_t BatchSize = 32;
+
+	// Mutex protected deque, the baseline the lock free queues replace
+	class LockedQueue
+	{
+	public:
+		bool TryPush(uint64_t value)
+		{
+			std::scoped_lock lock(m_Mutex);
+			if (m_Items.size() == QueueCapacity)
+			{
+				return false;
+			}
+			m_Items.push_back(value);
+			return true;
+		}
+
+		bool TryPop(uint64_t& value)
+		{
+			std::scoped_lock lock(m_Mutex);
+			if (m_Items.empty())
+			{
+				return false;
+			}
+			value = m_Items.front();
+			m_Items.pop_front();
+			return true;
+		}
+
+	private:
+		std::mutex m_Mutex;
+		std::deque<uint64_t> m_Items;
+	};
+
+	SpscQueue<uint64_t, QueueCapacity> s_SpscQueue;
+	MpmcQueue<uint64_t, QueueCapacity> s_MpmcQueue;
+	LockedQueue s_LockedQueue;
+}
+
+// Even threads produce and odd threads consume; every operation is a try so no thread can block the others
+// on shutdown, and only the successful operations are reported as items
+template<typename Queue>
+static void ProducerConsumer(benchmark::State& state, Queue& queue)
+{
+	const bool producer = state.thread_index() % 2 == 0 || state.threads() == 1;
+	const bool consumer = state.thread_index() % 2 == 1 || state.threads() == 1;
+	int64_t operationCount = 0;
+	uint64_t value = 0;
+	for (auto _ : state)
+	{
+		if (producer && queue.TryPush(value))
+		{
+			value++;
+			operationCount++;
+		}
+		if (consumer && queue.TryPop(value))
+		{
+			operationCount++;
+		}
+	}
+	state.SetItemsProcessed(operationCount);
+}
+
+template<typename Queue>
+static void ProducerConsumerBatch(benchmark::State& state, Queue& queue)
+{
+	const bool producer = state.thread_index() % 2 == 0 || state.threads() == 1;
+	const bool consumer = state.thread_index() % 2 == 1 || state.threads() == 1;
+	int64_t operationCount = 0;
+	uint64_t batch[BatchSize] = {};
+	for (auto _ : state)
+	{
+		if (producer)
+		{
+			operationCount += static_cast<int64_t>(queue.TryPushBatch(batch, BatchSize));
+		}
+		if (consumer)
+		{
+			operationCount += static_cast<int64_t>(queue.TryPopBatch(batch, BatchSize));
+		}
+	}
+	state.SetItemsProcessed(operationCount);
+}
+
+static void BM_SpscQueue(benchmark::State& state) { ProducerConsumer(state, s_SpscQueue); }
+static void BM_SpscQueueBatch(benchmark::State& state) { ProducerConsumerBatch(state, s_SpscQueue); }
+static void BM_MpmcQueue(benchmark::State& state) { ProducerConsumer(state, s_MpmcQueue); }
+static void BM_MpmcQueueBatch(benchmark::State& state) { ProducerConsumerBatch(state, s_MpmcQueue); }
+static void BM_LockedQueue(benchmark::State& state) { ProducerConsumer(state, s_LockedQueue); }
+
+// The SPSC queue only allows one producer and one consumer
+BENCHMARK(BM_SpscQueue)->Threads(2)->UseRealTime();
+BENCHMARK(BM_SpscQueueBatch)->Threads(2)->UseRealTime();
+BENCHMARK(BM_MpmcQueue)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_MpmcQueueBatch)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_LockedQueue)->ThreadRange(1, 16)->UseRealTime();
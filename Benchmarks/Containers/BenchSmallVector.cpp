@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "Core/Containers/SmallVector.h"
+#include "Core/Containers/Vector.h"
+
+namespace
+{
+	uint64_t s_AllocationCount = 0;
+
+	// Heap allocator that counts, so the benchmark reports how many allocations each list costs
+	struct CountingHeapAllocator
+	{
+		[[nodiscard]] void* Allocate(size_t size, size_t alignment)
+		{
+			s_AllocationCount++;
+			return HeapAllocator().Allocate(size, alignment);
+		}
+		void Free(void* memory, size_t size, size_t alignment) { HeapAllocator().Free(memory, size, alignment); }
+		[[nodiscard]] bool operator==(const CountingHeapAllocator&) const { return true; }
+	};
+
+	constexpr size_t ListCount = 1024;
+}
+
+// Many short per entity lists, between 1 and 8 elements, built and thrown away every frame
+template<typename List>
+static void BM_ShortLists(benchmark::State& state)
+{
+	const size_t maxLength = static_cast<size_t>(state.range(0));
+	s_AllocationCount = 0;
+	for (auto _ : state)
+	{
+		for (size_t list = 0; list < ListCount; ++list)
+		{
+			List values;
+			const size_t length = 1 + list % maxLength;
+			for (size_t i = 0; i < length; ++i)
+			{
+				values.PushBack(static_cast<uint32_t>(i));
+			}
+			benchmark::DoNotOptimize(values.GetData());
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * ListCount);
+	state.counters["Allocations/List"] = static_cast<double>(s_AllocationCount) / static_cast<double>(state.iterations() * ListCount);
+}
+BENCHMARK_TEMPLATE(BM_ShortLists, Vector<uint32_t, CountingHeapAllocator>)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(BM_ShortLists, SmallVector<uint32_t, 8, CountingHeapAllocator>)->Arg(4)->Arg(8)->Arg(16);
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Core/Containers/Vector.h"
+
+namespace
+{
+	// Trivially copyable, growth is a single memcpy
+	struct Particle
+	{
+		float m_Position[3];
+		float m_Velocity[3];
+		uint32_t m_Id;
+	};
+}
+
+template<typename Container>
+static void BM_PushParticles(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	for (auto _ : state)
+	{
+		Container particles;
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float value = static_cast<float>(i);
+			if constexpr (requires { particles.PushBack(Particle{}); })
+			{
+				particles.PushBack(Particle{ { value, value, value }, { 0.0f, 1.0f, 0.0f }, static_cast<uint32_t>(i) });
+			}
+			else
+			{
+				particles.push_back(Particle{ { value, value, value }, { 0.0f, 1.0f, 0.0f }, static_cast<uint32_t>(i) });
+			}
+		}
+		benchmark::DoNotOptimize(particles);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PushParticles, std::vector<Particle>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushParticles, Vector<Particle>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+// Not trivially copyable but trivially relocatable, the standard vector moves them one by one on growth
+template<typename Container>
+static void BM_PushUniquePtrs(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	for (auto _ : state)
+	{
+		Container pointers;
+		for (size_t i = 0; i < count; ++i)
+		{
+			if constexpr (requires { pointers.EmplaceBack(); })
+			{
+				pointers.EmplaceBack();
+			}
+			else
+			{
+				pointers.emplace_back();
+			}
+		}
+		benchmark::DoNotOptimize(pointers);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PushUniquePtrs, std::vector<std::unique_ptr<int>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushUniquePtrs, Vector<std::unique_ptr<int>>)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void BM_PushReservedUnchecked(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	for (auto _ : state)
+	{
+		Vector<uint32_t> values;
+		values.Reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			values.PushBackUnchecked(static_cast<uint32_t>(i));
+		}
+		benchmark::DoNotOptimize(values);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushReservedUnchecked)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void BM_PushReservedStd(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	for (auto _ : state)
+	{
+		std::vector<uint32_t> values;
+		values.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			values.push_back(static_cast<uint32_t>(i));
+		}
+		benchmark::DoNotOptimize(values);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushReservedStd)->RangeMultiplier(16)->Range(16, 1 << 20);
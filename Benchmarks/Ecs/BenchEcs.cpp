@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Math/Vec3.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Ecs/Query.h"
+#include "Ecs/World.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+	JobSystem& GetJobSystem()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	struct Position
+	{
+		Vec3 m_Value;
+	};
+
+	struct Velocity
+	{
+		Vec3 m_Value;
+	};
+
+	// The object per entity way: one heap allocated task with its own virtual Update
+	class MoverTask : public Task
+	{
+	public:
+		explicit MoverTask(const Vec3& velocity) : m_Velocity(velocity) {}
+
+		void Init() override {}
+		void Update(float deltaTime) override { m_Position = m_Position + m_Velocity * deltaTime; }
+
+		Vec3 m_Position{};
+		Vec3 m_Velocity;
+	};
+
+	Vec3 GetVelocity(int64_t i)
+	{
+		return Vec3(float(i % 7), 1.0f, float(i % 3));
+	}
+}
+
+static void BM_EcsUpdatePositions(benchmark::State& state)
+{
+	World world;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		world.CreateEntity(Position{}, Velocity{ GetVelocity(i) });
+	}
+
+	Query<Position, const Velocity> query(world);
+	for (auto _ : state)
+	{
+		query.ForEach([](Position& position, const Velocity& velocity)
+		{
+			position.m_Value = position.m_Value + velocity.m_Value * DeltaTime;
+		});
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Same update with the chunks spread over the workers
+static void BM_EcsParallelUpdatePositions(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	World world;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		world.CreateEntity(Position{}, Velocity{ GetVelocity(i) });
+	}
+
+	Query<Position, const Velocity> query(world);
+	for (auto _ : state)
+	{
+		query.ParallelForEach(jobSystem, [](Position& position, const Velocity& velocity)
+		{
+			position.m_Value = position.m_Value + velocity.m_Value * DeltaTime;
+		}, 8);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TaskUpdatePositions(benchmark::State& state)
+{
+	// Task has no virtual destructor, the movers are owned by their own type
+	Vector<UniquePtr<MoverTask>> movers;
+	Vector<Task*> tasks;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		movers.EmplaceBack(new MoverTask(GetVelocity(i)));
+		tasks.PushBack(movers.Back().get());
+	}
+
+	for (auto _ : state)
+	{
+		for (Task* task : tasks)
+		{
+			task->Update(DeltaTime);
+		}
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Structural changes, entities moved to another archetype and back
+static void BM_EcsAddRemoveComponent(benchmark::State& state)
+{
+	World world;
+	Vector<Entity> entities;
+	for (int64_t i = 0; i < state.range(0); ++i)
+	{
+		entities.PushBack(world.CreateEntity(Position{}));
+	}
+
+	for (auto _ : state)
+	{
+		for (Entity entity : entities)
+		{
+			world.AddComponent(entity, Velocity{});
+		}
+		for (Entity entity : entities)
+		{
+			world.RemoveComponent<Velocity>(entity);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+BENCHMARK(BM_EcsUpdatePositions)->Arg(1000000);
+BENCHMARK(BM_EcsParallelUpdatePositions)->Arg(1000000)->UseRealTime();
+BENCHMARK(BM_TaskUpdatePositions)->Arg(1000000);
+BENCHMARK(BM_EcsAddRemoveComponent)->Arg(100000);
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+#include "Engine/Clock.h"
+#include "Engine/Engine.h"
+#include "Tasks/Task.h"
+#include "Window/HeadlessWindow.h"
+
+namespace
+{
+	class CountTask : public Task
+	{
+	public:
+		void Init() override {}
+		void Update(float deltaTime) override { m_Time += deltaTime; }
+
+		float m_Time{0.0f};
+	};
+}
+
+// Full engine frames on a headless window with a virtual clock, so nothing waits on vsync or on the OS
+// The second argument is the pipeline depth, with 1 the headless render runs on its own thread
+static void BM_HeadlessEngineLoop(benchmark::State& state)
+{
+	constexpr uint64_t FramesPerIteration = 1000;
+	const size_t taskCount = static_cast<size_t>(state.range(0));
+	const uint32_t pipelineDepth = static_cast<uint32_t>(state.range(1));
+
+	VirtualClock clock;
+	clock.SetAutoAdvanceSeconds(1.0 / 60.0);
+
+	Engine engine;
+	engine.SetWindow(std::make_unique<HeadlessWindow>());
+	engine.SetClock(clock);
+	engine.SetPipelineDepth(pipelineDepth);
+	engine.Init();
+
+	Vector<CountTask> tasks(taskCount);
+	for (size_t i = 0; i < taskCount; ++i)
+	{
+		// every task writes its own resource so they can all run in parallel
+		tasks[i].DeclareWrite(i);
+		engine.GetTaskManager().AddTask(&tasks[i]);
+	}
+
+	for (auto _ : state)
+	{
+		engine.RunFrames(FramesPerIteration);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * FramesPerIteration));
+	state.counters["Frames/s"] = benchmark::Counter(static_cast<double>(state.iterations() * FramesPerIteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_HeadlessEngineLoop)->ArgsProduct({{0, 8, 64}, {0, 1}})->UseRealTime();
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+#include "Core/Math/Math.h"
+
+namespace
+{
+	constexpr size_t PointCount = 4096;
+
+	Mat4 MakeTransform(float angle)
+	{
+		return Mat4::CreateAffine(Vec3(1.5f), Quat::CreateFromAxisAngle(Normalize(Vec3(1.0f, 2.0f, 3.0f)), angle), Vec3(1.0f, -2.0f, 3.0f));
+	}
+
+	// Textbook triple loop, the baseline of the SIMD multiply
+	void MultiplyScalar(const float a[4][4], const float b[4][4], float result[4][4])
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int column = 0; column < 4; ++column)
+			{
+				float sum = 0.0f;
+				for (int i = 0; i < 4; ++i)
+				{
+					sum += a[row][i] * b[i][column];
+				}
+				result[row][column] = sum;
+			}
+		}
+	}
+}
+
+static void BM_Mat4Multiply(benchmark::State& state)
+{
+	Mat4 a = MakeTransform(0.3f);
+	const Mat4 b = MakeTransform(0.7f);
+	for (auto _ : state)
+	{
+		a = a * b;
+		benchmark::DoNotOptimize(a);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Mat4MultiplyScalar(benchmark::State& state)
+{
+	float a[4][4];
+	float b[4][4];
+	const Mat4 transformA = MakeTransform(0.3f);
+	const Mat4 transformB = MakeTransform(0.7f);
+	std::memcpy(a, &transformA, sizeof(a));
+	std::memcpy(b, &transformB, sizeof(b));
+	for (auto _ : state)
+	{
+		float result[4][4];
+		MultiplyScalar(a, b, result);
+		std::memcpy(a, result, sizeof(a));
+		benchmark::DoNotOptimize(a);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+// One point at a time through Mat4::TransformPoint
+static void BM_TransformPointsAoS(benchmark::State& state)
+{
+	const Mat4 transform = MakeTransform(0.5f);
+	std::vector<Vec3> points(PointCount, Vec3(1.0f, 2.0f, 3.0f));
+	std::vector<Vec3> results(PointCount);
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PointCount; ++i)
+		{
+			results[i] = transform.TransformPoint(points[i]);
+		}
+		benchmark::DoNotOptimize(results.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PointCount));
+}
+
+// Component arrays, a packet of Width points per iteration
+template<typename Packet>
+static void BM_TransformPointsSoA(benchmark::State& state)
+{
+	const Mat4 transform = MakeTransform(0.5f);
+	std::vector<float> xs(PointCount, 1.0f), ys(PointCount, 2.0f), zs(PointCount, 3.0f);
+	std::vector<float> outX(PointCount), outY(PointCount), outZ(PointCount);
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PointCount; i += Packet::Width)
+		{
+			const Packet points = Packet::LoadSoA(&xs[i], &ys[i], &zs[i]);
+			TransformPoints(transform, points).StoreSoA(&outX[i], &outY[i], &outZ[i]);
+		}
+		benchmark::DoNotOptimize(outX.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PointCount));
+}
+
+BENCHMARK(BM_Mat4Multiply);
+BENCHMARK(BM_Mat4MultiplyScalar);
+BENCHMARK(BM_TransformPointsAoS);
+BENCHMARK_TEMPLATE(BM_TransformPointsSoA, Vec3x4);
+BENCHMARK_TEMPLATE(BM_TransformPointsSoA, Vec3x8);
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Core/Math/Math.h"
+#include "Core/Math/TransformBatch.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/ParallelTransforms.h"
+
+namespace
+{
+	JobSystem& GetJobSystem()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	Mat4 MakeTransform(float angle)
+	{
+		return Mat4::CreateAffine(Vec3(1.5f), Quat::CreateFromAxisAngle(Normalize(Vec3(1.0f, 2.0f, 3.0f)), angle), Vec3(1.0f, -2.0f, 3.0f));
+	}
+
+	// Objects with a local and a world matrix and a local and a world box
+	struct Scene
+	{
+		explicit Scene(size_t count)
+			: m_Locals(count, MakeTransform(0.3f)), m_Worlds(count)
+			, m_Floats(count * 12, 1.0f)
+			, m_Count(count)
+		{
+		}
+
+		SoAPoints GetPoints(size_t index) { return { &m_Floats[index * 3 * m_Count], &m_Floats[(index * 3 + 1) * m_Count], &m_Floats[(index * 3 + 2) * m_Count] }; }
+		SoABounds GetLocalBounds() { return { GetPoints(0), GetPoints(1) }; }
+		SoABounds GetWorldBounds() { return { GetPoints(2), GetPoints(3) }; }
+
+		std::vector<Mat4> m_Locals;
+		std::vector<Mat4> m_Worlds;
+		std::vector<float> m_Floats;
+		size_t m_Count;
+	};
+
+	// Items per second are transforms per second, arguments are the object counts
+	void ObjectCounts(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->RangeMultiplier(10)->Range(10000, 1000000)->UseRealTime();
+	}
+
+	// level 0 is the math library baseline, 1 the dispatched kernel, the label tells which one ran
+	void SetLevel(benchmark::State& state)
+	{
+		TransformBatch::SetSimdLevel(state.range(1) == 0 ? SimdLevel::Scalar : GetSupportedSimdLevel());
+		state.SetLabel(GetSimdLevelName(TransformBatch::GetSimdLevel()));
+	}
+}
+
+// One Mat4 multiply per object as a hierarchy update would do
+static void BM_BatchMultiplyMatrices(benchmark::State& state)
+{
+	Scene scene(static_cast<size_t>(state.range(0)));
+	const Mat4 parent = MakeTransform(0.7f);
+	SetLevel(state);
+	for (auto _ : state)
+	{
+		TransformBatch::MultiplyMatrices(scene.m_Locals.data(), parent, scene.m_Worlds.data(), scene.m_Count);
+		benchmark::DoNotOptimize(scene.m_Worlds.data());
+	}
+	TransformBatch::SetSimdLevel(GetSupportedSimdLevel());
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.m_Count));
+}
+
+static void BM_BatchTransformPoints(benchmark::State& state)
+{
+	Scene scene(static_cast<size_t>(state.range(0)));
+	const Mat4 matrix = MakeTransform(0.7f);
+	SetLevel(state);
+	for (auto _ : state)
+	{
+		TransformBatch::TransformPoints(matrix, scene.GetPoints(0), scene.GetPoints(1), scene.m_Count);
+		benchmark::DoNotOptimize(scene.m_Floats.data());
+	}
+	TransformBatch::SetSimdLevel(GetSupportedSimdLevel());
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.m_Count));
+}
+
+static void BM_BatchTransformBounds(benchmark::State& state)
+{
+	Scene scene(static_cast<size_t>(state.range(0)));
+	SetLevel(state);
+	for (auto _ : state)
+	{
+		TransformBatch::TransformBounds(scene.m_Locals.data(), scene.GetLocalBounds(), scene.GetWorldBounds(), scene.m_Count);
+		benchmark::DoNotOptimize(scene.m_Floats.data());
+	}
+	TransformBatch::SetSimdLevel(GetSupportedSimdLevel());
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.m_Count));
+}
+
+static void BM_ParallelMultiplyMatrices(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	Scene scene(static_cast<size_t>(state.range(0)));
+	const Mat4 parent = MakeTransform(0.7f);
+	for (auto _ : state)
+	{
+		ParallelTransforms::MultiplyMatrices(jobSystem, scene.m_Locals.data(), parent, scene.m_Worlds.data(), scene.m_Count);
+		benchmark::DoNotOptimize(scene.m_Worlds.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.m_Count));
+}
+
+static void BM_ParallelTransformPoints(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	Scene scene(static_cast<size_t>(state.range(0)));
+	const Mat4 matrix = MakeTransform(0.7f);
+	for (auto _ : state)
+	{
+		ParallelTransforms::TransformPoints(jobSystem, matrix, scene.GetPoints(0), scene.GetPoints(1), scene.m_Count);
+		benchmark::DoNotOptimize(scene.m_Floats.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.m_Count));
+}
+
+static void BM_ParallelTransformBounds(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	Scene scene(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		ParallelTransforms::TransformBounds(jobSystem, scene.m_Locals.data(), scene.GetLocalBounds(), scene.GetWorldBounds(), scene.m_Count);
+		benchmark::DoNotOptimize(scene.m_Floats.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.m_Count));
+}
+
+BENCHMARK(BM_BatchMultiplyMatrices)->ArgsProduct({ { 10000, 100000, 1000000 }, { 0, 1 } });
+BENCHMARK(BM_BatchTransformPoints)->ArgsProduct({ { 10000, 100000, 1000000 }, { 0, 1 } });
+BENCHMARK(BM_BatchTransformBounds)->ArgsProduct({ { 10000, 100000, 1000000 }, { 0, 1 } });
+BENCHMARK(BM_ParallelMultiplyMatrices)->Apply(ObjectCounts);
+BENCHMARK(BM_ParallelTransformPoints)->Apply(ObjectCounts);
+BENCHMARK(BM_ParallelTransformBounds)->Apply(ObjectCounts);
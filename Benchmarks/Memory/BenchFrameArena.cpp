@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "Core/Memory/FrameArena.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace
+{
+	JobSystem& GetJobSystem()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	// Small scratch sizes, like the temporary lists a task builds during a frame
+	size_t GetAllocationSize(size_t i)
+	{
+		return 16 + (i % 8) * 24;
+	}
+
+	constexpr size_t Grain = 64;
+}
+
+// One frame worth of scratch allocations, all released at the end of the frame
+static void BM_FrameScratchNewDelete(benchmark::State& state)
+{
+	const size_t allocationCount = static_cast<size_t>(state.range(0));
+	Vector<std::byte*> allocations(allocationCount);
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < allocationCount; ++i)
+		{
+			allocations[i] = new std::byte[GetAllocationSize(i)];
+			benchmark::DoNotOptimize(allocations[i]);
+		}
+		for (std::byte* allocation : allocations)
+		{
+			delete[] allocation;
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FrameScratchNewDelete)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+static void BM_FrameScratchArena(benchmark::State& state)
+{
+	const size_t allocationCount = static_cast<size_t>(state.range(0));
+	FrameArena arena;
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < allocationCount; ++i)
+		{
+			benchmark::DoNotOptimize(arena.Allocate(GetAllocationSize(i)));
+		}
+		arena.Reset();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["HighWaterMark"] = static_cast<double>(arena.GetHighWaterMark());
+}
+BENCHMARK(BM_FrameScratchArena)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+// Same frame, but the allocations come from every worker at once, which is where the global heap contends
+static void BM_ParallelFrameScratchNewDelete(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	const size_t allocationCount = static_cast<size_t>(state.range(0));
+	Vector<std::byte*> allocations(allocationCount);
+	for (auto _ : state)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, allocationCount }, Grain, [&allocations](size_t i)
+		{
+			allocations[i] = new std::byte[GetAllocationSize(i)];
+		});
+		ParallelFor(jobSystem, IndexRange{ 0, allocationCount }, Grain, [&allocations](size_t i)
+		{
+			delete[] allocations[i];
+		});
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelFrameScratchNewDelete)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->UseRealTime();
+
+static void BM_ParallelFrameScratchArena(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	const size_t allocationCount = static_cast<size_t>(state.range(0));
+	Vector<std::byte*> allocations(allocationCount);
+	FrameArena arena;
+	for (auto _ : state)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, allocationCount }, Grain, [&allocations, &arena](size_t i)
+		{
+			allocations[i] = static_cast<std::byte*>(arena.Allocate(GetAllocationSize(i)));
+		});
+		arena.Reset();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["HighWaterMark"] = static_cast<double>(arena.GetHighWaterMark());
+}
+BENCHMARK(BM_ParallelFrameScratchArena)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->UseRealTime();
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/PoolAllocator.h"
+
+namespace
+{
+	// About the size of a task or a render command
+	struct PoolObject
+	{
+		uint64_t m_Data[6];
+	};
+
+	// Shuffled order so objects die in a different order than they were created, like in a long session
+	size_t GetFreeIndex(size_t i, size_t count)
+	{
+		return (i * 7919) % count;
+	}
+}
+
+static void BM_ObjectChurnNewDelete(benchmark::State& state)
+{
+	const size_t objectCount = static_cast<size_t>(state.range(0));
+	Vector<PoolObject*> objects(objectCount);
+	for (auto _ : state)
+	{
+		for (PoolObject*& object : objects)
+		{
+			object = new PoolObject();
+		}
+		benchmark::DoNotOptimize(objects.GetData());
+		for (size_t i = 0; i < objectCount; ++i)
+		{
+			delete objects[GetFreeIndex(i, objectCount)];
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ObjectChurnNewDelete)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+static void BM_ObjectChurnPool(benchmark::State& state)
+{
+	const size_t objectCount = static_cast<size_t>(state.range(0));
+	Vector<PoolObject*> objects(objectCount);
+	Pool<PoolObject> pool;
+	for (auto _ : state)
+	{
+		for (PoolObject*& object : objects)
+		{
+			object = pool.New();
+		}
+		benchmark::DoNotOptimize(objects.GetData());
+		for (size_t i = 0; i < objectCount; ++i)
+		{
+			pool.Delete(objects[GetFreeIndex(i, objectCount)]);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["Chunks"] = static_cast<double>(pool.GetAllocator().GetChunkCount());
+}
+BENCHMARK(BM_ObjectChurnPool)->RangeMultiplier(8)->Range(64, 1 << 15);
@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+
+#include "Core/Containers/Vector.h"
+#include "Render/NullRenderBackend.h"
+#include "Render/ParallelSubmit.h"
+#include "Render/RenderBucket.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace
+{
+	constexpr uint32_t PipelineCount = 64;
+	constexpr uint32_t MaterialCount = 1024;
+
+	JobSystem& GetJobSystem()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	// Random state and depth per draw, what a culled scene looks like before sorting
+	DrawPacket MakeDraw(uint32_t index, uint64_t& key)
+	{
+		const uint32_t hash = index * 2654435761u;
+		DrawPacket packet;
+		packet.m_Pipeline = hash % PipelineCount;
+		packet.m_Material = (hash >> 8) % MaterialCount;
+		packet.m_Mesh = index;
+		packet.m_IndexCount = 36;
+		key = SortKey::MakeOpaque(0, 0, packet.m_Pipeline, packet.m_Material, hash & SortKey::MaxDepth);
+		return packet;
+	}
+
+	void BM_RenderBucketRecord(benchmark::State& state)
+	{
+		const uint32_t drawCount = static_cast<uint32_t>(state.range(0));
+		RenderBucket bucket(1);
+		for (auto _ : state)
+		{
+			bucket.Clear();
+			for (uint32_t i = 0; i < drawCount; ++i)
+			{
+				uint64_t key = 0;
+				const DrawPacket packet = MakeDraw(i, key);
+				bucket.Push(0, key, packet);
+			}
+			benchmark::DoNotOptimize(bucket.GetSize());
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawCount);
+	}
+	BENCHMARK(BM_RenderBucketRecord)->Arg(10'000)->Arg(100'000);
+
+	void BM_RenderBucketParallelRecord(benchmark::State& state)
+	{
+		const uint32_t drawCount = static_cast<uint32_t>(state.range(0));
+		JobSystem& jobSystem = GetJobSystem();
+		RenderBucket bucket(jobSystem.GetWorkerCount());
+		for (auto _ : state)
+		{
+			bucket.Clear();
+			ParallelFor(jobSystem, IndexRange{ 0, drawCount }, 1024, [&](IndexRange chunk)
+			{
+				for (size_t i = chunk.m_Begin; i < chunk.m_End; ++i)
+				{
+					uint64_t key = 0;
+					const DrawPacket packet = MakeDraw(static_cast<uint32_t>(i), key);
+					bucket.Push(jobSystem, key, packet);
+				}
+			});
+			benchmark::DoNotOptimize(bucket.GetSize());
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawCount);
+	}
+	BENCHMARK(BM_RenderBucketParallelRecord)->Arg(10'000)->Arg(100'000)->UseRealTime();
+
+	void BM_RenderBucketRadixSort(benchmark::State& state)
+	{
+		const uint32_t drawCount = static_cast<uint32_t>(state.range(0));
+		RenderBucket bucket(1);
+		for (uint32_t i = 0; i < drawCount; ++i)
+		{
+			uint64_t key = 0;
+			const DrawPacket packet = MakeDraw(i, key);
+			bucket.Push(0, key, packet);
+		}
+		for (auto _ : state)
+		{
+			bucket.Sort();
+			benchmark::DoNotOptimize(bucket.GetSortedKey(0));
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawCount);
+	}
+	BENCHMARK(BM_RenderBucketRadixSort)->Arg(10'000)->Arg(100'000);
+
+	// Baseline: comparison sort of the same key and pointer pairs
+	void BM_RenderBucketStdSort(benchmark::State& state)
+	{
+		const uint32_t drawCount = static_cast<uint32_t>(state.range(0));
+		Vector<DrawPacket> packets;
+		Vector<uint64_t> keys;
+		for (uint32_t i = 0; i < drawCount; ++i)
+		{
+			uint64_t key = 0;
+			packets.PushBack(MakeDraw(i, key));
+			keys.PushBack(key);
+		}
+
+		struct Entry
+		{
+			uint64_t m_Key;
+			const DrawPacket* m_Packet;
+		};
+		Vector<Entry> entries;
+		for (auto _ : state)
+		{
+			entries.Clear();
+			for (uint32_t i = 0; i < drawCount; ++i)
+			{
+				entries.PushBack(Entry{ keys[i], &packets[i] });
+			}
+			std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.m_Key < rhs.m_Key; });
+			benchmark::DoNotOptimize(entries[0].m_Packet);
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawCount);
+	}
+	BENCHMARK(BM_RenderBucketStdSort)->Arg(10'000)->Arg(100'000);
+
+	void BM_RenderBucketSubmit(benchmark::State& state)
+	{
+		const uint32_t drawCount = static_cast<uint32_t>(state.range(0));
+		RenderBucket bucket(1);
+		for (uint32_t i = 0; i < drawCount; ++i)
+		{
+			uint64_t key = 0;
+			const DrawPacket packet = MakeDraw(i, key);
+			bucket.Push(0, key, packet);
+		}
+		bucket.Sort();
+		for (auto _ : state)
+		{
+			NullRenderBackend backend;
+			bucket.Submit(backend);
+			benchmark::DoNotOptimize(backend.GetChecksum());
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawCount);
+	}
+	BENCHMARK(BM_RenderBucketSubmit)->Arg(10'000)->Arg(100'000);
+
+	// One backend per worker, the way command lists are recorded
+	void BM_RenderBucketParallelSubmit(benchmark::State& state)
+	{
+		const uint32_t drawCount = static_cast<uint32_t>(state.range(0));
+		JobSystem& jobSystem = GetJobSystem();
+		RenderBucket bucket(1);
+		for (uint32_t i = 0; i < drawCount; ++i)
+		{
+			uint64_t key = 0;
+			const DrawPacket packet = MakeDraw(i, key);
+			bucket.Push(0, key, packet);
+		}
+		bucket.Sort();
+
+		const uint32_t rangeCount = ParallelSubmit::GetRangeCount(drawCount, jobSystem.GetWorkerCount());
+		Vector<NullRenderBackend> backends;
+		backends.Resize(rangeCount);
+		for (auto _ : state)
+		{
+			ParallelSubmit::Run(jobSystem, bucket, rangeCount, [&backends](uint32_t range) -> IRenderBackend& { return backends[range]; });
+			benchmark::DoNotOptimize(backends[0].GetChecksum());
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * drawCount);
+	}
+	BENCHMARK(BM_RenderBucketParallelSubmit)->Arg(10'000)->Arg(100'000)->UseRealTime();
+}
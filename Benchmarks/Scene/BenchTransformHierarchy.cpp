@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Math/Math.h"
+#include "Scene/TransformHierarchy.h"
+#include "Tasks/JobSystem.h"
+
+namespace
+{
+	constexpr uint32_t NodeCount = 100000;
+
+	JobSystem& GetJobSystem()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	// A few roots, every node has up to 8 children, about 6 levels
+	void BuildScene(TransformHierarchy& hierarchy, Vector<TransformHierarchy::Handle>& nodes)
+	{
+		for (uint32_t i = 0; i < NodeCount; ++i)
+		{
+			const Mat4 local = Mat4::CreateAffine(Vec3(1.0f), Quat::CreateFromAxisAngle(Vec3::UnitY(), 0.1f), Vec3(1.0f, 0.0f, 0.0f));
+			nodes.PushBack(hierarchy.Create(local, i < 8 ? TransformHierarchy::Handle() : nodes[(i - 8) / 8]));
+		}
+		hierarchy.Update();
+	}
+
+	/*
+	* Moves movedPercent of the nodes, spread over the scene, then updates
+	* Moving a node also recomputes its subtree, so more than movedPercent of the transforms are recomputed
+	*/
+	void RunFrames(benchmark::State& state, JobSystem* jobSystem)
+	{
+		TransformHierarchy hierarchy;
+		Vector<TransformHierarchy::Handle> nodes;
+		BuildScene(hierarchy, nodes);
+
+		const uint32_t movedPercent = static_cast<uint32_t>(state.range(0));
+		const uint32_t stride = 100 / movedPercent;
+		uint32_t frame = 0;
+		size_t updatedCount = 0;
+		for (auto _ : state)
+		{
+			const Mat4 local = Mat4::CreateTranslation(Vec3(float(frame % 7), 0.0f, 0.0f));
+			for (uint32_t i = frame % stride; i < NodeCount; i += stride)
+			{
+				hierarchy.SetLocal(nodes[i], local);
+			}
+			hierarchy.Update(jobSystem);
+			updatedCount += hierarchy.GetUpdatedCount();
+			++frame;
+		}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NodeCount));
+		state.counters["Recomputed"] = benchmark::Counter(static_cast<double>(updatedCount) / static_cast<double>(state.iterations()));
+	}
+}
+
+// Items per second are scene nodes per second, arguments are the percentage of moved nodes
+static void BM_HierarchyUpdate(benchmark::State& state)
+{
+	RunFrames(state, nullptr);
+}
+
+static void BM_HierarchyParallelUpdate(benchmark::State& state)
+{
+	RunFrames(state, &GetJobSystem());
+}
+
+BENCHMARK(BM_HierarchyUpdate)->Arg(1)->Arg(100);
+BENCHMARK(BM_HierarchyParallelUpdate)->Arg(1)->Arg(100)->UseRealTime();
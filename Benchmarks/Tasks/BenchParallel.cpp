@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "Core/Containers/Vector.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace
+{
+	JobSystem& GetJobSystem()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	// A few flops per element so that the loop is not only bound by memory bandwidth
+	float UpdateElement(float value)
+	{
+		return std::sqrt(value * value + 1.0f) * 0.5f;
+	}
+
+	constexpr size_t Grain = 1024;
+}
+
+static void BM_SerialFor(benchmark::State& state)
+{
+	Vector<float> values(static_cast<size_t>(state.range(0)), 1.0f);
+	for (auto _ : state)
+	{
+		for (float& value : values)
+		{
+			value = UpdateElement(value);
+		}
+		benchmark::DoNotOptimize(values.GetData());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerialFor)->RangeMultiplier(16)->Range(1 << 10, 1 << 24);
+
+static void BM_ParallelFor(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	Vector<float> values(static_cast<size_t>(state.range(0)), 1.0f);
+	for (auto _ : state)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, values.GetSize() }, Grain, [&values](IndexRange chunk)
+		{
+			for (size_t i = chunk.m_Begin; i < chunk.m_End; ++i)
+			{
+				values[i] = UpdateElement(values[i]);
+			}
+		});
+		benchmark::DoNotOptimize(values.GetData());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["Workers"] = jobSystem.GetWorkerCount();
+}
+BENCHMARK(BM_ParallelFor)->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->UseRealTime();
+
+static void BM_SerialReduce(benchmark::State& state)
+{
+	Vector<float> values(static_cast<size_t>(state.range(0)), 1.0f);
+	for (auto _ : state)
+	{
+		double sum = 0.0;
+		for (float value : values)
+		{
+			sum += UpdateElement(value);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerialReduce)->RangeMultiplier(16)->Range(1 << 10, 1 << 24);
+
+static void BM_ParallelReduce(benchmark::State& state)
+{
+	JobSystem& jobSystem = GetJobSystem();
+	Vector<float> values(static_cast<size_t>(state.range(0)), 1.0f);
+	for (auto _ : state)
+	{
+		const double sum = ParallelReduce(jobSystem, IndexRange{ 0, values.GetSize() }, Grain, 0.0,
+			[&values](IndexRange chunk, double accumulator)
+			{
+				for (size_t i = chunk.m_Begin; i < chunk.m_End; ++i)
+				{
+					accumulator += UpdateElement(values[i]);
+				}
+				return accumulator;
+			},
+			[](double lhs, double rhs) { return lhs + rhs; });
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["Workers"] = jobSystem.GetWorkerCount();
+}
+BENCHMARK(BM_ParallelReduce)->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->UseRealTime();
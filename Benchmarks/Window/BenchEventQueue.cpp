@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include "Window/EventQueue.h"
+#include "Window/HeadlessWindow.h"
+
+// One engine tick worth of event handling: pump the pending messages, expose them to the frame, consume them
+static void BM_HeadlessEventPump(benchmark::State& state)
+{
+	const uint32_t eventsPerTick = static_cast<uint32_t>(state.range(0));
+	HeadlessWindow window;
+	EventQueue& queue = window.GetEventQueue();
+
+	WindowEvent event;
+	event.m_Type = WindowEventType::MouseMove;
+
+	uint64_t consumed = 0;
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < eventsPerTick; ++i)
+		{
+			event.m_X = static_cast<int32_t>(i);
+			window.PostEvent(event);
+		}
+
+		window.UpdateMessages();
+		queue.BeginFrame();
+		queue.ForEach([&consumed](const WindowEvent& frameEvent) { consumed += static_cast<uint64_t>(frameEvent.m_X); });
+		queue.EndFrame();
+	}
+	benchmark::DoNotOptimize(consumed);
+	state.SetItemsProcessed(state.iterations() * eventsPerTick);
+	state.counters["Dropped"] = static_cast<double>(queue.GetDroppedCount());
+}
+BENCHMARK(BM_HeadlessEventPump)->RangeMultiplier(4)->Range(1, 1024);
@@ -0,0 +1,44 @@
+# Engine code that does not depend on the platform layer
+# It is built as a library so the tests and the benchmarks can run on every platform
+set(NIHENGINE_DIR ${CMAKE_CURRENT_LIST_DIR}/../NihEngine)
+
+# Builds the core under another name, for consumers that need other compile definitions than the shared target
+function(nih_add_engine_core TARGET_NAME)
+    add_library(${TARGET_NAME} STATIC
+        ${NIHENGINE_DIR}/Core/Containers/ArrayOps.cpp
+        ${NIHENGINE_DIR}/Core/Math/Mat4.cpp
+        ${NIHENGINE_DIR}/Core/Math/TransformBatch.cpp
+        ${NIHENGINE_DIR}/Core/Memory/FrameArena.cpp
+        ${NIHENGINE_DIR}/Core/Memory/PoolAllocator.cpp
+        ${NIHENGINE_DIR}/Core/Strings/StringId.cpp
+        ${NIHENGINE_DIR}/Ecs/Access.cpp
+        ${NIHENGINE_DIR}/Ecs/Archetype.cpp
+        ${NIHENGINE_DIR}/Ecs/CommandBuffer.cpp
+        ${NIHENGINE_DIR}/Ecs/Component.cpp
+        ${NIHENGINE_DIR}/Ecs/System.cpp
+        ${NIHENGINE_DIR}/Ecs/World.cpp
+        ${NIHENGINE_DIR}/Engine/Clock.cpp
+        ${NIHENGINE_DIR}/Engine/Engine.cpp
+        ${NIHENGINE_DIR}/Engine/FramePipeline.cpp
+        ${NIHENGINE_DIR}/Render/RenderBucket.cpp
+        ${NIHENGINE_DIR}/Scene/TransformHierarchy.cpp
+        ${NIHENGINE_DIR}/System/CpuFeatures.cpp
+        ${NIHENGINE_DIR}/System/Log.cpp
+        ${NIHENGINE_DIR}/Tasks/JobSystem.cpp
+        ${NIHENGINE_DIR}/Tasks/Task.cpp
+        ${NIHENGINE_DIR}/Tasks/TaskGraph.cpp
+        ${NIHENGINE_DIR}/Tasks/TaskManager.cpp
+        ${NIHENGINE_DIR}/Window/EventQueue.cpp
+        ${NIHENGINE_DIR}/Window/HeadlessWindow.cpp
+    )
+
+    find_package(Threads REQUIRED)
+    target_include_directories(${TARGET_NAME} PUBLIC ${NIHENGINE_DIR})
+    target_link_libraries(${TARGET_NAME} PUBLIC Threads::Threads)
+    # the engine is written in C++20, only the Windows root project sets the standard globally
+    target_compile_features(${TARGET_NAME} PUBLIC cxx_std_20)
+endfunction()
+
+if(NOT TARGET NihEngineCore)
+    nih_add_engine_core(NihEngineCore)
+endif()
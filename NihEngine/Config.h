@@ -2,4 +2,54 @@
 
 #if defined(_DEBUG)
 #define ENABLE_ASSERT
-#endif
\ No newline at end of file
+#endif
+
+// StringId keeps the text of every id in debug builds so it can be printed, see Core/Strings/StringId.h
+#if !defined(NIH_STRINGID_NAMES) && defined(_DEBUG)
+#define NIH_STRINGID_NAMES
+#endif
+
+// ECS systems check the components they touch against the ones they declared in debug builds, see Ecs/Access.h
+#if !defined(NIH_ECS_VALIDATE_ACCESS) && defined(_DEBUG)
+#define NIH_ECS_VALIDATE_ACCESS
+#endif
+
+// Logs below this severity are compiled out, see LogSeverity in System/Log.h
+#if !defined(NIH_LOG_MIN_SEVERITY)
+#if defined(_DEBUG)
+#define NIH_LOG_MIN_SEVERITY 0
+#else
+#define NIH_LOG_MIN_SEVERITY 1
+#endif
+#endif
+
+// SSE2 is part of every x64 target, the portable code paths are used everywhere else
+#if !defined(NIH_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NIH_SSE2
+#endif
+
+// NEON is part of every 64 bits ARM target
+#if !defined(NIH_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define NIH_NEON
+#endif
+
+// The math library is compiled for the baseline of the target (SSE2 or NEON), AVX only when the whole build enables it.
+// NIH_MATH_SCALAR forces the portable code, to compare or to debug the SIMD paths
+#if !defined(NIH_MATH_SCALAR) && defined(NIH_SSE2)
+#define NIH_MATH_SSE
+#if defined(__AVX__)
+#define NIH_MATH_AVX
+#endif
+#elif !defined(NIH_MATH_SCALAR) && defined(NIH_NEON)
+#define NIH_MATH_NEON
+#endif
+
+// Wider instruction sets are never assumed, functions using them are tagged and only called after a CPU check
+// (see System/CpuFeatures.h); MSVC accepts the intrinsics without any tag. The AVX2 level also requires FMA and POPCNT, which every AVX2 CPU has
+#if defined(NIH_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define NIH_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define NIH_TARGET_AVX2 __attribute__((target("avx2,fma,popcnt")))
+#else
+#define NIH_TARGET_SSE41
+#define NIH_TARGET_AVX2
+#endif
@@ -1,11 +1,22 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
+#include "Core/Containers/ArrayOps.h"
 #include "System/Assert.h"
 
-template <typename T, size_t Size>
+/*
+* Fixed size array, an aggregate like a C array
+* Alignment raises the alignment of the storage, Array<float, N, 32> lines up with AVX registers and
+* Array<T, N, CacheLineSize> with cache lines
+* The bulk operations go through the SIMD kernels of ArrayOps for float and int32 arrays when they are
+* big enough to pay for the dispatch, and stay plain loops in constant evaluation
+*/
+template <typename T, size_t Size, size_t Alignment = alignof(T)>
 class Array
 {
+	static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= alignof(T), "Alignment must be a power of two, at least alignof(T)");
+
 public:
 	[[nodiscard]] constexpr const T& At(size_t pos) const
 	{
@@ -19,6 +30,9 @@ public:
 	}
 
 	[[nodiscard]] constexpr size_t GetSize() const { return Size; };
+	[[nodiscard]] static constexpr size_t GetAlignment() { return Alignment; }
+	[[nodiscard]] constexpr const T* GetData() const { return m_Data; }
+	[[nodiscard]] constexpr T* GetData() { return m_Data; }
 	[[nodiscard]] constexpr const T& Front() const { return m_Data[0]; }
 	[[nodiscard]] constexpr T& Front() { return m_Data[0]; }
 	[[nodiscard]] constexpr const T& Back() const { return m_Data[Size - 1]; }
@@ -34,7 +48,100 @@ public:
 		return m_Data[pos];
 	}
 
-	T m_Data[Size];
+	constexpr void Fill(const T& value)
+	{
+		if constexpr (UseKernels)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				ArrayOps::Fill(m_Data, Size, value);
+				return;
+			}
+		}
+		for (size_t i = 0; i < Size; ++i)
+		{
+			m_Data[i] = value;
+		}
+	}
+
+	template<size_t OtherAlignment>
+	constexpr void CopyFrom(const Array<T, Size, OtherAlignment>& source)
+	{
+		if constexpr (UseKernels)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				ArrayOps::Copy(m_Data, source.m_Data, Size);
+				return;
+			}
+		}
+		for (size_t i = 0; i < Size; ++i)
+		{
+			m_Data[i] = source.m_Data[i];
+		}
+	}
+
+	[[nodiscard]] constexpr T Sum() const
+	{
+		if constexpr (UseKernels)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return ArrayOps::Sum(m_Data, Size);
+			}
+		}
+		T sum{};
+		for (size_t i = 0; i < Size; ++i)
+		{
+			sum += m_Data[i];
+		}
+		return sum;
+	}
+
+	[[nodiscard]] constexpr ArrayOps::MinMaxResult<T> MinMax() const
+	{
+		static_assert(Size > 0, "MinMax needs at least one element");
+		if constexpr (UseKernels)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return ArrayOps::MinMax(m_Data, Size);
+			}
+		}
+		ArrayOps::MinMaxResult<T> result{ m_Data[0], m_Data[0] };
+		for (size_t i = 1; i < Size; ++i)
+		{
+			result.m_Min = m_Data[i] < result.m_Min ? m_Data[i] : result.m_Min;
+			result.m_Max = m_Data[i] > result.m_Max ? m_Data[i] : result.m_Max;
+		}
+		return result;
+	}
+
+	// Index of the first element equal to value, GetSize() when there is none
+	[[nodiscard]] constexpr size_t Find(const T& value) const
+	{
+		if constexpr (UseKernels)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return ArrayOps::Find(m_Data, Size, value);
+			}
+		}
+		for (size_t i = 0; i < Size; ++i)
+		{
+			if (m_Data[i] == value)
+			{
+				return i;
+			}
+		}
+		return Size;
+	}
+
+	// Below this size the inline loop is cheaper than the call through the dispatch table
+	static constexpr size_t KernelThreshold = 16;
+	static constexpr bool UseKernels = ArrayOps::IsAccelerated<T> && Size >= KernelThreshold;
+
+	alignas(Alignment) T m_Data[Size];
 };
 
 // Deducing guides that will let us write Array array{0,1,2,3} without specifying type or size
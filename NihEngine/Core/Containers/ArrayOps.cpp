@@ -0,0 +1,579 @@
+#include "Core/Containers/ArrayOps.h"
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#include "System/Assert.h"
+
+#if defined(NIH_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	struct Kernels
+	{
+		SimdLevel m_Level;
+		void (*m_FillFloat)(float*, size_t, float);
+		void (*m_FillInt)(int32_t*, size_t, int32_t);
+		float (*m_SumFloat)(const float*, size_t);
+		int32_t (*m_SumInt)(const int32_t*, size_t);
+		ArrayOps::MinMaxResult<float> (*m_MinMaxFloat)(const float*, size_t);
+		ArrayOps::MinMaxResult<int32_t> (*m_MinMaxInt)(const int32_t*, size_t);
+		size_t (*m_FindFloat)(const float*, size_t, float);
+		size_t (*m_FindInt)(const int32_t*, size_t, int32_t);
+		void (*m_BitAnd)(uint64_t*, const uint64_t*, size_t);
+		void (*m_BitOr)(uint64_t*, const uint64_t*, size_t);
+		void (*m_BitAndNot)(uint64_t*, const uint64_t*, size_t);
+		size_t (*m_PopCount)(const uint64_t*, size_t);
+	};
+
+	namespace Scalar
+	{
+		template<typename T>
+		void Fill(T* data, size_t count, T value)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				data[i] = value;
+			}
+		}
+
+		float SumFloat(const float* data, size_t count)
+		{
+			float sum = 0.0f;
+			for (size_t i = 0; i < count; ++i)
+			{
+				sum += data[i];
+			}
+			return sum;
+		}
+
+		int32_t SumInt(const int32_t* data, size_t count)
+		{
+			// unsigned so the wrap around is defined
+			uint32_t sum = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				sum += static_cast<uint32_t>(data[i]);
+			}
+			return static_cast<int32_t>(sum);
+		}
+
+		template<typename T>
+		ArrayOps::MinMaxResult<T> MinMax(const T* data, size_t count)
+		{
+			ArrayOps::MinMaxResult<T> result{ data[0], data[0] };
+			for (size_t i = 1; i < count; ++i)
+			{
+				result.m_Min = data[i] < result.m_Min ? data[i] : result.m_Min;
+				result.m_Max = data[i] > result.m_Max ? data[i] : result.m_Max;
+			}
+			return result;
+		}
+
+		template<typename T>
+		size_t Find(const T* data, size_t count, T value)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (data[i] == value)
+				{
+					return i;
+				}
+			}
+			return count;
+		}
+
+		void BitAnd(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			for (size_t i = 0; i < wordCount; ++i)
+			{
+				destination[i] &= source[i];
+			}
+		}
+
+		void BitOr(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			for (size_t i = 0; i < wordCount; ++i)
+			{
+				destination[i] |= source[i];
+			}
+		}
+
+		void BitAndNot(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			for (size_t i = 0; i < wordCount; ++i)
+			{
+				destination[i] &= ~source[i];
+			}
+		}
+
+		size_t PopCount(const uint64_t* words, size_t wordCount)
+		{
+			size_t count = 0;
+			for (size_t i = 0; i < wordCount; ++i)
+			{
+				count += static_cast<size_t>(std::popcount(words[i]));
+			}
+			return count;
+		}
+
+		constexpr Kernels Table{ SimdLevel::Scalar, Fill<float>, Fill<int32_t>, SumFloat, SumInt, MinMax<float>, MinMax<int32_t>, Find<float>, Find<int32_t>, BitAnd, BitOr, BitAndNot, PopCount };
+	}
+
+#if defined(NIH_SSE2)
+	namespace Sse41
+	{
+		NIH_TARGET_SSE41 void FillFloat(float* data, size_t count, float value)
+		{
+			const __m128 broadcast = _mm_set1_ps(value);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(data + i, broadcast);
+			}
+			Scalar::Fill(data + i, count - i, value);
+		}
+
+		NIH_TARGET_SSE41 void FillInt(int32_t* data, size_t count, int32_t value)
+		{
+			const __m128i broadcast = _mm_set1_epi32(value);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), broadcast);
+			}
+			Scalar::Fill(data + i, count - i, value);
+		}
+
+		NIH_TARGET_SSE41 float HorizontalSum(__m128 value)
+		{
+			const __m128 high = _mm_movehl_ps(value, value);
+			const __m128 pair = _mm_add_ps(value, high);
+			return _mm_cvtss_f32(_mm_add_ss(pair, _mm_shuffle_ps(pair, pair, 1)));
+		}
+
+		NIH_TARGET_SSE41 float SumFloat(const float* data, size_t count)
+		{
+			// two accumulators hide the latency of the additions
+			__m128 sum0 = _mm_setzero_ps();
+			__m128 sum1 = _mm_setzero_ps();
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				sum0 = _mm_add_ps(sum0, _mm_loadu_ps(data + i));
+				sum1 = _mm_add_ps(sum1, _mm_loadu_ps(data + i + 4));
+			}
+			return HorizontalSum(_mm_add_ps(sum0, sum1)) + Scalar::SumFloat(data + i, count - i);
+		}
+
+		NIH_TARGET_SSE41 int32_t SumInt(const int32_t* data, size_t count)
+		{
+			__m128i sum = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				sum = _mm_add_epi32(sum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+			}
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+			return static_cast<int32_t>(static_cast<uint32_t>(_mm_cvtsi128_si32(sum)) + static_cast<uint32_t>(Scalar::SumInt(data + i, count - i)));
+		}
+
+		NIH_TARGET_SSE41 ArrayOps::MinMaxResult<float> MinMaxFloat(const float* data, size_t count)
+		{
+			if (count < 4)
+			{
+				return Scalar::MinMax(data, count);
+			}
+
+			__m128 minimum = _mm_loadu_ps(data);
+			__m128 maximum = minimum;
+			size_t i = 4;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 value = _mm_loadu_ps(data + i);
+				minimum = _mm_min_ps(minimum, value);
+				maximum = _mm_max_ps(maximum, value);
+			}
+			// the last partial vector overlaps values already seen, which does not change a min or a max
+			const __m128 tail = _mm_loadu_ps(data + count - 4);
+			minimum = _mm_min_ps(minimum, tail);
+			maximum = _mm_max_ps(maximum, tail);
+
+			minimum = _mm_min_ps(minimum, _mm_movehl_ps(minimum, minimum));
+			minimum = _mm_min_ss(minimum, _mm_shuffle_ps(minimum, minimum, 1));
+			maximum = _mm_max_ps(maximum, _mm_movehl_ps(maximum, maximum));
+			maximum = _mm_max_ss(maximum, _mm_shuffle_ps(maximum, maximum, 1));
+			return { _mm_cvtss_f32(minimum), _mm_cvtss_f32(maximum) };
+		}
+
+		NIH_TARGET_SSE41 ArrayOps::MinMaxResult<int32_t> MinMaxInt(const int32_t* data, size_t count)
+		{
+			if (count < 4)
+			{
+				return Scalar::MinMax(data, count);
+			}
+
+			__m128i minimum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+			__m128i maximum = minimum;
+			size_t i = 4;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				minimum = _mm_min_epi32(minimum, value);
+				maximum = _mm_max_epi32(maximum, value);
+			}
+			const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count - 4));
+			minimum = _mm_min_epi32(minimum, tail);
+			maximum = _mm_max_epi32(maximum, tail);
+
+			minimum = _mm_min_epi32(minimum, _mm_shuffle_epi32(minimum, _MM_SHUFFLE(1, 0, 3, 2)));
+			minimum = _mm_min_epi32(minimum, _mm_shuffle_epi32(minimum, _MM_SHUFFLE(2, 3, 0, 1)));
+			maximum = _mm_max_epi32(maximum, _mm_shuffle_epi32(maximum, _MM_SHUFFLE(1, 0, 3, 2)));
+			maximum = _mm_max_epi32(maximum, _mm_shuffle_epi32(maximum, _MM_SHUFFLE(2, 3, 0, 1)));
+			return { _mm_cvtsi128_si32(minimum), _mm_cvtsi128_si32(maximum) };
+		}
+
+		NIH_TARGET_SSE41 size_t FindFloat(const float* data, size_t count, float value)
+		{
+			const __m128 broadcast = _mm_set1_ps(value);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), broadcast));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(static_cast<uint32_t>(mask));
+				}
+			}
+			return i + Scalar::Find(data + i, count - i, value);
+		}
+
+		NIH_TARGET_SSE41 size_t FindInt(const int32_t* data, size_t count, int32_t value)
+		{
+			const __m128i broadcast = _mm_set1_epi32(value);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), broadcast);
+				const int mask = _mm_movemask_ps(_mm_castsi128_ps(equal));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(static_cast<uint32_t>(mask));
+				}
+			}
+			return i + Scalar::Find(data + i, count - i, value);
+		}
+
+		// Returns how many words were done, the caller finishes the odd one
+		template<typename Operation>
+		NIH_TARGET_SSE41 size_t BitOperation(uint64_t* destination, const uint64_t* source, size_t wordCount, Operation operation)
+		{
+			size_t i = 0;
+			for (; i + 2 <= wordCount; i += 2)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), operation(a, b));
+			}
+			return i;
+		}
+
+		struct And { NIH_TARGET_SSE41 __m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); } };
+		struct Or { NIH_TARGET_SSE41 __m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); } };
+		// andnot complements its first operand
+		struct AndNot { NIH_TARGET_SSE41 __m128i operator()(__m128i a, __m128i b) const { return _mm_andnot_si128(b, a); } };
+
+		NIH_TARGET_SSE41 void BitAnd(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			const size_t done = BitOperation(destination, source, wordCount, And());
+			Scalar::BitAnd(destination + done, source + done, wordCount - done);
+		}
+
+		NIH_TARGET_SSE41 void BitOr(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			const size_t done = BitOperation(destination, source, wordCount, Or());
+			Scalar::BitOr(destination + done, source + done, wordCount - done);
+		}
+
+		NIH_TARGET_SSE41 void BitAndNot(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			const size_t done = BitOperation(destination, source, wordCount, AndNot());
+			Scalar::BitAndNot(destination + done, source + done, wordCount - done);
+		}
+
+		constexpr Kernels Table{ SimdLevel::Sse41, FillFloat, FillInt, SumFloat, SumInt, MinMaxFloat, MinMaxInt, FindFloat, FindInt, BitAnd, BitOr, BitAndNot, Scalar::PopCount };
+	}
+
+	namespace Avx2
+	{
+		NIH_TARGET_AVX2 void FillFloat(float* data, size_t count, float value)
+		{
+			const __m256 broadcast = _mm256_set1_ps(value);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(data + i, broadcast);
+			}
+			Scalar::Fill(data + i, count - i, value);
+		}
+
+		NIH_TARGET_AVX2 void FillInt(int32_t* data, size_t count, int32_t value)
+		{
+			const __m256i broadcast = _mm256_set1_epi32(value);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), broadcast);
+			}
+			Scalar::Fill(data + i, count - i, value);
+		}
+
+		NIH_TARGET_AVX2 float SumFloat(const float* data, size_t count)
+		{
+			__m256 sum0 = _mm256_setzero_ps();
+			__m256 sum1 = _mm256_setzero_ps();
+			size_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				sum0 = _mm256_add_ps(sum0, _mm256_loadu_ps(data + i));
+				sum1 = _mm256_add_ps(sum1, _mm256_loadu_ps(data + i + 8));
+			}
+			const __m256 sum = _mm256_add_ps(sum0, sum1);
+			const __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+			return Sse41::HorizontalSum(half) + Sse41::SumFloat(data + i, count - i);
+		}
+
+		NIH_TARGET_AVX2 int32_t SumInt(const int32_t* data, size_t count)
+		{
+			__m256i sum = _mm256_setzero_si256();
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				sum = _mm256_add_epi32(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+			}
+			__m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+			half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+			half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+			return static_cast<int32_t>(static_cast<uint32_t>(_mm_cvtsi128_si32(half)) + static_cast<uint32_t>(Scalar::SumInt(data + i, count - i)));
+		}
+
+		NIH_TARGET_AVX2 ArrayOps::MinMaxResult<float> MinMaxFloat(const float* data, size_t count)
+		{
+			if (count < 8)
+			{
+				return Sse41::MinMaxFloat(data, count);
+			}
+
+			__m256 minimum = _mm256_loadu_ps(data);
+			__m256 maximum = minimum;
+			for (size_t i = 8; i + 8 <= count; i += 8)
+			{
+				const __m256 value = _mm256_loadu_ps(data + i);
+				minimum = _mm256_min_ps(minimum, value);
+				maximum = _mm256_max_ps(maximum, value);
+			}
+			const __m256 tail = _mm256_loadu_ps(data + count - 8);
+			minimum = _mm256_min_ps(minimum, tail);
+			maximum = _mm256_max_ps(maximum, tail);
+
+			float lanes[8];
+			_mm_storeu_ps(lanes, _mm_min_ps(_mm256_castps256_ps128(minimum), _mm256_extractf128_ps(minimum, 1)));
+			_mm_storeu_ps(lanes + 4, _mm_max_ps(_mm256_castps256_ps128(maximum), _mm256_extractf128_ps(maximum, 1)));
+			const ArrayOps::MinMaxResult<float> low = Scalar::MinMax(lanes, 4);
+			const ArrayOps::MinMaxResult<float> high = Scalar::MinMax(lanes + 4, 4);
+			return { low.m_Min, high.m_Max };
+		}
+
+		NIH_TARGET_AVX2 ArrayOps::MinMaxResult<int32_t> MinMaxInt(const int32_t* data, size_t count)
+		{
+			if (count < 8)
+			{
+				return Sse41::MinMaxInt(data, count);
+			}
+
+			__m256i minimum = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+			__m256i maximum = minimum;
+			for (size_t i = 8; i + 8 <= count; i += 8)
+			{
+				const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+				minimum = _mm256_min_epi32(minimum, value);
+				maximum = _mm256_max_epi32(maximum, value);
+			}
+			const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + count - 8));
+			minimum = _mm256_min_epi32(minimum, tail);
+			maximum = _mm256_max_epi32(maximum, tail);
+
+			int32_t lanes[8];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_min_epi32(_mm256_castsi256_si128(minimum), _mm256_extracti128_si256(minimum, 1)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes + 4), _mm_max_epi32(_mm256_castsi256_si128(maximum), _mm256_extracti128_si256(maximum, 1)));
+			const ArrayOps::MinMaxResult<int32_t> low = Scalar::MinMax(lanes, 4);
+			const ArrayOps::MinMaxResult<int32_t> high = Scalar::MinMax(lanes + 4, 4);
+			return { low.m_Min, high.m_Max };
+		}
+
+		NIH_TARGET_AVX2 size_t FindFloat(const float* data, size_t count, float value)
+		{
+			const __m256 broadcast = _mm256_set1_ps(value);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), broadcast, _CMP_EQ_OQ));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(static_cast<uint32_t>(mask));
+				}
+			}
+			return i + Scalar::Find(data + i, count - i, value);
+		}
+
+		NIH_TARGET_AVX2 size_t FindInt(const int32_t* data, size_t count, int32_t value)
+		{
+			const __m256i broadcast = _mm256_set1_epi32(value);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), broadcast);
+				const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(static_cast<uint32_t>(mask));
+				}
+			}
+			return i + Scalar::Find(data + i, count - i, value);
+		}
+
+		template<typename Operation>
+		NIH_TARGET_AVX2 size_t BitOperation(uint64_t* destination, const uint64_t* source, size_t wordCount, Operation operation)
+		{
+			size_t i = 0;
+			for (; i + 4 <= wordCount; i += 4)
+			{
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), operation(a, b));
+			}
+			return i;
+		}
+
+		struct And { NIH_TARGET_AVX2 __m256i operator()(__m256i a, __m256i b) const { return _mm256_and_si256(a, b); } };
+		struct Or { NIH_TARGET_AVX2 __m256i operator()(__m256i a, __m256i b) const { return _mm256_or_si256(a, b); } };
+		// andnot complements its first operand
+		struct AndNot { NIH_TARGET_AVX2 __m256i operator()(__m256i a, __m256i b) const { return _mm256_andnot_si256(b, a); } };
+
+		NIH_TARGET_AVX2 void BitAnd(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			const size_t done = BitOperation(destination, source, wordCount, And());
+			Scalar::BitAnd(destination + done, source + done, wordCount - done);
+		}
+
+		NIH_TARGET_AVX2 void BitOr(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			const size_t done = BitOperation(destination, source, wordCount, Or());
+			Scalar::BitOr(destination + done, source + done, wordCount - done);
+		}
+
+		NIH_TARGET_AVX2 void BitAndNot(uint64_t* destination, const uint64_t* source, size_t wordCount)
+		{
+			const size_t done = BitOperation(destination, source, wordCount, AndNot());
+			Scalar::BitAndNot(destination + done, source + done, wordCount - done);
+		}
+
+		// Compiled for POPCNT, one instruction per word with four independent counters
+		NIH_TARGET_AVX2 size_t PopCount(const uint64_t* words, size_t wordCount)
+		{
+			size_t counts[4] = {};
+			size_t i = 0;
+			for (; i + 4 <= wordCount; i += 4)
+			{
+				counts[0] += static_cast<size_t>(std::popcount(words[i]));
+				counts[1] += static_cast<size_t>(std::popcount(words[i + 1]));
+				counts[2] += static_cast<size_t>(std::popcount(words[i + 2]));
+				counts[3] += static_cast<size_t>(std::popcount(words[i + 3]));
+			}
+			for (; i < wordCount; ++i)
+			{
+				counts[0] += static_cast<size_t>(std::popcount(words[i]));
+			}
+			return counts[0] + counts[1] + counts[2] + counts[3];
+		}
+
+		constexpr Kernels Table{ SimdLevel::Avx2, FillFloat, FillInt, SumFloat, SumInt, MinMaxFloat, MinMaxInt, FindFloat, FindInt, BitAnd, BitOr, BitAndNot, PopCount };
+	}
+#endif
+
+	const Kernels* SelectKernels(SimdLevel level)
+	{
+#if defined(NIH_SSE2)
+		if (level >= SimdLevel::Avx2 && GetSupportedSimdLevel() >= SimdLevel::Avx2)
+		{
+			return &Avx2::Table;
+		}
+		if (level >= SimdLevel::Sse41 && GetSupportedSimdLevel() >= SimdLevel::Sse41)
+		{
+			return &Sse41::Table;
+		}
+#endif
+		return &Scalar::Table;
+	}
+
+	std::atomic<const Kernels*> s_Kernels{nullptr};
+
+	const Kernels& GetKernels()
+	{
+		const Kernels* kernels = s_Kernels.load(std::memory_order_acquire);
+		if (kernels == nullptr)
+		{
+			// several threads can race here, they all pick the same table
+			kernels = SelectKernels(GetSupportedSimdLevel());
+			s_Kernels.store(kernels, std::memory_order_release);
+		}
+		return *kernels;
+	}
+}
+
+namespace ArrayOps
+{
+	void Fill(float* data, size_t count, float value) { GetKernels().m_FillFloat(data, count, value); }
+	void Fill(int32_t* data, size_t count, int32_t value) { GetKernels().m_FillInt(data, count, value); }
+
+	// memcpy is already vectorized and dispatched by the C runtime, hand written loops do not beat it
+	void Copy(float* destination, const float* source, size_t count) { std::memcpy(destination, source, count * sizeof(float)); }
+	void Copy(int32_t* destination, const int32_t* source, size_t count) { std::memcpy(destination, source, count * sizeof(int32_t)); }
+
+	float Sum(const float* data, size_t count) { return GetKernels().m_SumFloat(data, count); }
+	int32_t Sum(const int32_t* data, size_t count) { return GetKernels().m_SumInt(data, count); }
+
+	MinMaxResult<float> MinMax(const float* data, size_t count)
+	{
+		NIH_ASSERT(count > 0);
+		return GetKernels().m_MinMaxFloat(data, count);
+	}
+
+	MinMaxResult<int32_t> MinMax(const int32_t* data, size_t count)
+	{
+		NIH_ASSERT(count > 0);
+		return GetKernels().m_MinMaxInt(data, count);
+	}
+
+	size_t Find(const float* data, size_t count, float value) { return GetKernels().m_FindFloat(data, count, value); }
+	size_t Find(const int32_t* data, size_t count, int32_t value) { return GetKernels().m_FindInt(data, count, value); }
+
+	void BitAnd(uint64_t* destination, const uint64_t* source, size_t wordCount) { GetKernels().m_BitAnd(destination, source, wordCount); }
+	void BitOr(uint64_t* destination, const uint64_t* source, size_t wordCount) { GetKernels().m_BitOr(destination, source, wordCount); }
+	void BitAndNot(uint64_t* destination, const uint64_t* source, size_t wordCount) { GetKernels().m_BitAndNot(destination, source, wordCount); }
+	size_t PopCount(const uint64_t* words, size_t wordCount) { return GetKernels().m_PopCount(words, wordCount); }
+
+	SimdLevel GetSimdLevel()
+	{
+		return GetKernels().m_Level;
+	}
+
+	void SetSimdLevel(SimdLevel level)
+	{
+		s_Kernels.store(SelectKernels(level), std::memory_order_release);
+	}
+}
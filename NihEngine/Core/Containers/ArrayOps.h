@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "System/CpuFeatures.h"
+
+/*
+* Bulk kernels over contiguous float and int32 ranges and over bit words, used by Array and DynamicBitset
+* Each kernel has a scalar, an SSE4.1 and an AVX2 version, the best one the CPU supports is picked on first use
+* Copy is the exception, it is memcpy at every level
+* Float sums are accumulated in several lanes, the result can differ from a sequential sum in the last bits
+*/
+namespace ArrayOps
+{
+	template<typename T>
+	struct MinMaxResult
+	{
+		T m_Min;
+		T m_Max;
+	};
+
+	template<typename T>
+	inline constexpr bool IsAccelerated = std::is_same_v<T, float> || std::is_same_v<T, int32_t>;
+
+	void Fill(float* data, size_t count, float value);
+	void Fill(int32_t* data, size_t count, int32_t value);
+
+	// The ranges must not overlap
+	void Copy(float* destination, const float* source, size_t count);
+	void Copy(int32_t* destination, const int32_t* source, size_t count);
+
+	[[nodiscard]] float Sum(const float* data, size_t count);
+	// Wraps around on overflow like the scalar sum
+	[[nodiscard]] int32_t Sum(const int32_t* data, size_t count);
+
+	// count must not be 0, NaNs give an unspecified result
+	[[nodiscard]] MinMaxResult<float> MinMax(const float* data, size_t count);
+	[[nodiscard]] MinMaxResult<int32_t> MinMax(const int32_t* data, size_t count);
+
+	// Index of the first element equal to value, count when there is none
+	[[nodiscard]] size_t Find(const float* data, size_t count, float value);
+	[[nodiscard]] size_t Find(const int32_t* data, size_t count, int32_t value);
+
+	// Word by word destination = destination op source, for bitsets
+	void BitAnd(uint64_t* destination, const uint64_t* source, size_t wordCount);
+	void BitOr(uint64_t* destination, const uint64_t* source, size_t wordCount);
+	void BitAndNot(uint64_t* destination, const uint64_t* source, size_t wordCount);
+	[[nodiscard]] size_t PopCount(const uint64_t* words, size_t wordCount);
+
+	[[nodiscard]] SimdLevel GetSimdLevel();
+	// Forces the kernels to a lower level, for tests and benchmarks; levels the CPU lacks are clamped
+	void SetSimdLevel(SimdLevel level);
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "Core/Containers/ArrayOps.h"
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/Allocator.h"
+#include "System/Assert.h"
+
+/*
+* Bits packed in 64 bits words, sized at run time
+* Searches skip whole empty words and use the bit scan instructions inside a word, counting and the
+* And/Or/AndNot of two bitsets go through the SIMD kernels of ArrayOps
+* The bits of the last word past GetSize() are always zero, so counts and comparisons can work on whole words
+*/
+template<typename Allocator = HeapAllocator>
+class DynamicBitset
+{
+public:
+	static constexpr size_t WordBits = 64;
+
+	DynamicBitset() = default;
+	explicit DynamicBitset(const Allocator& allocator) : m_Words(allocator) {}
+
+	explicit DynamicBitset(size_t size, bool value = false, const Allocator& allocator = Allocator())
+		: m_Words(allocator)
+	{
+		Resize(size, value);
+	}
+
+	[[nodiscard]] size_t GetSize() const { return m_Size; }
+	[[nodiscard]] bool IsEmpty() const { return m_Size == 0; }
+	[[nodiscard]] size_t GetWordCount() const { return m_Words.GetSize(); }
+	[[nodiscard]] const uint64_t* GetWords() const { return m_Words.GetData(); }
+
+	// New bits take value, existing bits are kept
+	void Resize(size_t size, bool value = false)
+	{
+		const size_t oldSize = m_Size;
+		m_Words.Resize(GetWordCount(size), value ? ~uint64_t(0) : 0);
+		if (value && oldSize < size && oldSize % WordBits != 0)
+		{
+			m_Words[oldSize / WordBits] |= ~uint64_t(0) << (oldSize % WordBits);
+		}
+		m_Size = size;
+		ClearUnusedBits();
+	}
+
+	void Clear()
+	{
+		m_Words.Clear();
+		m_Size = 0;
+	}
+
+	[[nodiscard]] bool Test(size_t index) const
+	{
+		NIH_ASSERT(index < m_Size);
+		return (m_Words[index / WordBits] >> (index % WordBits)) & 1;
+	}
+
+	[[nodiscard]] bool operator[](size_t index) const { return Test(index); }
+
+	void Set(size_t index)
+	{
+		NIH_ASSERT(index < m_Size);
+		m_Words[index / WordBits] |= uint64_t(1) << (index % WordBits);
+	}
+
+	void Set(size_t index, bool value)
+	{
+		if (value)
+		{
+			Set(index);
+		}
+		else
+		{
+			Reset(index);
+		}
+	}
+
+	void Reset(size_t index)
+	{
+		NIH_ASSERT(index < m_Size);
+		m_Words[index / WordBits] &= ~(uint64_t(1) << (index % WordBits));
+	}
+
+	void Flip(size_t index)
+	{
+		NIH_ASSERT(index < m_Size);
+		m_Words[index / WordBits] ^= uint64_t(1) << (index % WordBits);
+	}
+
+	void SetAll()
+	{
+		for (uint64_t& word : m_Words)
+		{
+			word = ~uint64_t(0);
+		}
+		ClearUnusedBits();
+	}
+
+	void ResetAll()
+	{
+		for (uint64_t& word : m_Words)
+		{
+			word = 0;
+		}
+	}
+
+	// Number of set bits
+	[[nodiscard]] size_t Count() const { return ArrayOps::PopCount(m_Words.GetData(), m_Words.GetSize()); }
+
+	[[nodiscard]] bool Any() const
+	{
+		for (uint64_t word : m_Words)
+		{
+			if (word != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	[[nodiscard]] bool None() const { return !Any(); }
+	[[nodiscard]] bool All() const { return Count() == m_Size; }
+
+	// Index of the first set bit, GetSize() when there is none
+	[[nodiscard]] size_t FindFirst() const { return FindFrom(0); }
+
+	// Index of the first set bit after index, GetSize() when there is none
+	[[nodiscard]] size_t FindNext(size_t index) const { return FindFrom(index + 1); }
+
+	// Calls function(index) for every set bit, in increasing order
+	template<typename Function>
+	void ForEachSetBit(Function&& function) const
+	{
+		for (size_t wordIndex = 0; wordIndex < m_Words.GetSize(); ++wordIndex)
+		{
+			uint64_t word = m_Words[wordIndex];
+			while (word != 0)
+			{
+				function(wordIndex * WordBits + static_cast<size_t>(std::countr_zero(word)));
+				// clear the lowest set bit
+				word &= word - 1;
+			}
+		}
+	}
+
+	// Both bitsets must have the same size
+	DynamicBitset& operator&=(const DynamicBitset& other)
+	{
+		NIH_ASSERT(m_Size == other.m_Size);
+		ArrayOps::BitAnd(m_Words.GetData(), other.m_Words.GetData(), m_Words.GetSize());
+		return *this;
+	}
+
+	DynamicBitset& operator|=(const DynamicBitset& other)
+	{
+		NIH_ASSERT(m_Size == other.m_Size);
+		ArrayOps::BitOr(m_Words.GetData(), other.m_Words.GetData(), m_Words.GetSize());
+		return *this;
+	}
+
+	// Clears every bit set in other
+	DynamicBitset& AndNot(const DynamicBitset& other)
+	{
+		NIH_ASSERT(m_Size == other.m_Size);
+		ArrayOps::BitAndNot(m_Words.GetData(), other.m_Words.GetData(), m_Words.GetSize());
+		return *this;
+	}
+
+	// True when every bit set in other is also set here, what a component mask query asks
+	[[nodiscard]] bool Contains(const DynamicBitset& other) const
+	{
+		NIH_ASSERT(m_Size == other.m_Size);
+		for (size_t i = 0; i < m_Words.GetSize(); ++i)
+		{
+			if ((m_Words[i] & other.m_Words[i]) != other.m_Words[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	[[nodiscard]] bool operator==(const DynamicBitset& other) const { return m_Size == other.m_Size && m_Words == other.m_Words; }
+
+private:
+	static constexpr size_t GetWordCount(size_t size) { return (size + WordBits - 1) / WordBits; }
+
+	size_t FindFrom(size_t index) const
+	{
+		if (index >= m_Size)
+		{
+			return m_Size;
+		}
+
+		size_t wordIndex = index / WordBits;
+		// ignore the bits before index in the first word
+		uint64_t word = m_Words[wordIndex] & (~uint64_t(0) << (index % WordBits));
+		while (word == 0)
+		{
+			if (++wordIndex == m_Words.GetSize())
+			{
+				return m_Size;
+			}
+			word = m_Words[wordIndex];
+		}
+		return wordIndex * WordBits + static_cast<size_t>(std::countr_zero(word));
+	}
+
+	void ClearUnusedBits()
+	{
+		if (m_Size % WordBits != 0)
+		{
+			m_Words.Back() &= ~(~uint64_t(0) << (m_Size % WordBits));
+		}
+	}
+
+	Vector<uint64_t, Allocator> m_Words;
+	size_t m_Size{0};
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/*
+* Hash functions for the hash containers, based on wyhash
+* The containers take the 7 low bits of the hash as a fingerprint and the rest to pick the first slot,
+* so every bit of the result has to be well mixed, an identity hash would make them very slow
+*/
+namespace HashDetail
+{
+	inline constexpr uint64_t Secret[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+	// Full 128 bits product of a and b, low half in a and high half in b
+	inline void Multiply(uint64_t& a, uint64_t& b)
+	{
+#if defined(__SIZEOF_INT128__)
+		const __uint128_t product = static_cast<__uint128_t>(a) * b;
+		a = static_cast<uint64_t>(product);
+		b = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		a = _umul128(a, b, &b);
+#else
+		const uint64_t aHigh = a >> 32, aLow = static_cast<uint32_t>(a);
+		const uint64_t bHigh = b >> 32, bLow = static_cast<uint32_t>(b);
+		const uint64_t high = aHigh * bHigh, middle0 = aHigh * bLow, middle1 = aLow * bHigh, low = aLow * bLow;
+		const uint64_t carry = ((low >> 32) + static_cast<uint32_t>(middle0) + static_cast<uint32_t>(middle1)) >> 32;
+		a = low + (middle0 << 32) + (middle1 << 32);
+		b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+	}
+
+	inline uint64_t Mix(uint64_t a, uint64_t b)
+	{
+		Multiply(a, b);
+		return a ^ b;
+	}
+
+	inline uint64_t Read8(const uint8_t* data)
+	{
+		uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	inline uint64_t Read4(const uint8_t* data)
+	{
+		uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	inline uint64_t Read3(const uint8_t* data, size_t size)
+	{
+		return (static_cast<uint64_t>(data[0]) << 16) | (static_cast<uint64_t>(data[size >> 1]) << 8) | data[size - 1];
+	}
+}
+
+// wyhash of a block of memory
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0)
+{
+	using namespace HashDetail;
+
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	seed ^= Mix(seed ^ Secret[0], Secret[1]);
+
+	uint64_t a;
+	uint64_t b;
+	if (size <= 16)
+	{
+		if (size >= 4)
+		{
+			const size_t middle = (size >> 3) << 2;
+			a = (Read4(bytes) << 32) | Read4(bytes + middle);
+			b = (Read4(bytes + size - 4) << 32) | Read4(bytes + size - 4 - middle);
+		}
+		else if (size > 0)
+		{
+			a = Read3(bytes, size);
+			b = 0;
+		}
+		else
+		{
+			a = b = 0;
+		}
+	}
+	else
+	{
+		size_t remaining = size;
+		if (remaining > 48)
+		{
+			uint64_t seed1 = seed;
+			uint64_t seed2 = seed;
+			do
+			{
+				seed = Mix(Read8(bytes) ^ Secret[1], Read8(bytes + 8) ^ seed);
+				seed1 = Mix(Read8(bytes + 16) ^ Secret[2], Read8(bytes + 24) ^ seed1);
+				seed2 = Mix(Read8(bytes + 32) ^ Secret[3], Read8(bytes + 40) ^ seed2);
+				bytes += 48;
+				remaining -= 48;
+			} while (remaining > 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while (remaining > 16)
+		{
+			seed = Mix(Read8(bytes) ^ Secret[1], Read8(bytes + 8) ^ seed);
+			bytes += 16;
+			remaining -= 16;
+		}
+		a = Read8(bytes + remaining - 16);
+		b = Read8(bytes + remaining - 8);
+	}
+
+	a ^= Secret[1];
+	b ^= seed;
+	Multiply(a, b);
+	return Mix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+}
+
+// wyhash of a single 64 bits value
+inline uint64_t HashInteger(uint64_t value)
+{
+	return HashDetail::Mix(value ^ HashDetail::Secret[0], HashDetail::Secret[1]);
+}
+
+template<typename T, typename = void>
+struct Hash;
+
+template<typename T>
+struct Hash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+{
+	[[nodiscard]] uint64_t operator()(T value) const { return HashInteger(static_cast<uint64_t>(value)); }
+};
+
+template<typename T>
+struct Hash<T*>
+{
+	[[nodiscard]] uint64_t operator()(const T* value) const { return HashInteger(reinterpret_cast<uintptr_t>(value)); }
+};
+
+// Every string type hashes the same, a map keyed by std::string can be searched with a string_view or a literal
+struct StringHash
+{
+	using is_transparent = void;
+
+	[[nodiscard]] uint64_t operator()(std::string_view value) const { return HashBytes(value.data(), value.size()); }
+};
+
+template<>
+struct Hash<std::string> : StringHash
+{
+};
+
+template<>
+struct Hash<std::string_view> : StringHash
+{
+};
+
+// Equality that accepts any pair of types that compare, needed by the heterogeneous lookups
+struct EqualTo
+{
+	using is_transparent = void;
+
+	template<typename A, typename B>
+	[[nodiscard]] bool operator()(const A& a, const B& b) const { return a == b; }
+};
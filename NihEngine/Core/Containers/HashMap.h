@@ -0,0 +1,127 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Hash.h"
+#include "Core/Containers/HashTable.h"
+#include "Core/Memory/Allocator.h"
+
+// One slot of a HashMap, the key must never be changed through it
+template<typename K, typename V>
+struct HashMapEntry
+{
+	template<typename KeyArg, typename... Args> requires (!std::is_same_v<std::decay_t<KeyArg>, HashMapEntry>)
+	explicit HashMapEntry(KeyArg&& key, Args&&... args)
+		: m_Key(std::forward<KeyArg>(key))
+		, m_Value(std::forward<Args>(args)...)
+	{
+	}
+
+	K m_Key;
+	V m_Value;
+};
+
+template<typename K, typename V>
+struct IsTriviallyRelocatable<HashMapEntry<K, V>> : std::bool_constant<IsTriviallyRelocatableV<K> && IsTriviallyRelocatableV<V>>
+{
+};
+
+/*
+* Flat hash map, see HashTable for the layout
+* Entries live in the table itself: pointers to them are invalidated whenever the map grows or is rehashed.
+* Lookups take anything the hash and the equality accept, a HashMap<std::string, V> can be searched with a literal
+*/
+template<typename K, typename V, typename HashFunction = Hash<K>, typename KeyEqual = EqualTo, typename Allocator = HeapAllocator>
+class HashMap
+{
+	struct Policy
+	{
+		using Key = K;
+		using Slot = HashMapEntry<K, V>;
+
+		static const K& GetKey(const Slot& slot) { return slot.m_Key; }
+	};
+
+	using Table = HashTable<Policy, HashFunction, KeyEqual, Allocator>;
+
+	template<typename KeyLike>
+	static constexpr bool IsLookupKey = Table::template IsLookupKey<KeyLike>;
+
+public:
+	using Entry = HashMapEntry<K, V>;
+	using Iterator = typename Table::Iterator;
+	using ConstIterator = typename Table::ConstIterator;
+
+	HashMap() = default;
+	explicit HashMap(const Allocator& allocator) : m_Table(allocator) {}
+	explicit HashMap(const HashFunction& hash, const KeyEqual& equal = KeyEqual{}, const Allocator& allocator = Allocator{}) : m_Table(hash, equal, allocator) {}
+
+	[[nodiscard]] size_t GetSize() const { return m_Table.GetSize(); }
+	[[nodiscard]] bool IsEmpty() const { return m_Table.IsEmpty(); }
+	[[nodiscard]] size_t GetCapacity() const { return m_Table.GetCapacity(); }
+	[[nodiscard]] const HashFunction& GetHashFunction() const { return m_Table.GetHashFunction(); }
+
+	[[nodiscard]] Iterator begin() { return m_Table.begin(); }
+	[[nodiscard]] Iterator end() { return m_Table.end(); }
+	[[nodiscard]] ConstIterator begin() const { return m_Table.begin(); }
+	[[nodiscard]] ConstIterator end() const { return m_Table.end(); }
+
+	void Reserve(size_t count) { m_Table.Reserve(count); }
+	void Clear() { m_Table.Clear(); }
+
+	// nullptr when the key is not in the map
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] V* Find(const KeyLike& key)
+	{
+		Entry* entry = m_Table.Find(key);
+		return entry != nullptr ? &entry->m_Value : nullptr;
+	}
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] const V* Find(const KeyLike& key) const
+	{
+		const Entry* entry = m_Table.Find(key);
+		return entry != nullptr ? &entry->m_Value : nullptr;
+	}
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] bool Contains(const KeyLike& key) const { return m_Table.Find(key) != nullptr; }
+
+	// Insert the value built from args unless the key is already there, in which case args are left untouched
+	// Returns the value in the map and whether it was inserted
+	template<typename... Args>
+	std::pair<V*, bool> TryEmplace(const K& key, Args&&... args)
+	{
+		auto [entry, inserted] = m_Table.FindOrEmplace(key, key, std::forward<Args>(args)...);
+		return { &entry->m_Value, inserted };
+	}
+
+	template<typename... Args>
+	std::pair<V*, bool> TryEmplace(K&& key, Args&&... args)
+	{
+		// the key is only moved in once we know it is not there yet
+		auto [entry, inserted] = m_Table.FindOrEmplace(key, std::move(key), std::forward<Args>(args)...);
+		return { &entry->m_Value, inserted };
+	}
+
+	template<typename Value>
+	std::pair<V*, bool> InsertOrAssign(const K& key, Value&& value)
+	{
+		auto [entry, inserted] = TryEmplace(key, std::forward<Value>(value));
+		if (!inserted)
+		{
+			*entry = std::forward<Value>(value);
+		}
+		return { entry, inserted };
+	}
+
+	// Default constructs the value when the key is not there yet
+	V& operator[](const K& key) { return *TryEmplace(key).first; }
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	bool Erase(const KeyLike& key) { return m_Table.Erase(key); }
+
+private:
+	Table m_Table;
+};
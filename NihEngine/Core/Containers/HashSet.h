@@ -0,0 +1,64 @@
+#pragma once
+
+#include <utility>
+
+#include "Core/Containers/Hash.h"
+#include "Core/Containers/HashTable.h"
+#include "Core/Memory/Allocator.h"
+
+/*
+* Flat hash set, see HashTable for the layout
+* Keys live in the table itself: pointers to them are invalidated whenever the set grows or is rehashed
+*/
+template<typename K, typename HashFunction = Hash<K>, typename KeyEqual = EqualTo, typename Allocator = HeapAllocator>
+class HashSet
+{
+	struct Policy
+	{
+		using Key = K;
+		using Slot = K;
+
+		static const K& GetKey(const Slot& slot) { return slot; }
+	};
+
+	using Table = HashTable<Policy, HashFunction, KeyEqual, Allocator>;
+
+	template<typename KeyLike>
+	static constexpr bool IsLookupKey = Table::template IsLookupKey<KeyLike>;
+
+public:
+	// Keys must not be changed in place, only const iteration is exposed
+	using ConstIterator = typename Table::ConstIterator;
+
+	HashSet() = default;
+	explicit HashSet(const Allocator& allocator) : m_Table(allocator) {}
+	explicit HashSet(const HashFunction& hash, const KeyEqual& equal = KeyEqual{}, const Allocator& allocator = Allocator{}) : m_Table(hash, equal, allocator) {}
+
+	[[nodiscard]] size_t GetSize() const { return m_Table.GetSize(); }
+	[[nodiscard]] bool IsEmpty() const { return m_Table.IsEmpty(); }
+	[[nodiscard]] size_t GetCapacity() const { return m_Table.GetCapacity(); }
+	[[nodiscard]] const HashFunction& GetHashFunction() const { return m_Table.GetHashFunction(); }
+
+	[[nodiscard]] ConstIterator begin() const { return m_Table.begin(); }
+	[[nodiscard]] ConstIterator end() const { return m_Table.end(); }
+
+	void Reserve(size_t count) { m_Table.Reserve(count); }
+	void Clear() { m_Table.Clear(); }
+
+	// nullptr when the key is not in the set
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] const K* Find(const KeyLike& key) const { return m_Table.Find(key); }
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] bool Contains(const KeyLike& key) const { return m_Table.Find(key) != nullptr; }
+
+	// Returns false when the key was already there
+	bool Insert(const K& key) { return m_Table.FindOrEmplace(key, key).second; }
+	bool Insert(K&& key) { return m_Table.FindOrEmplace(key, std::move(key)).second; }
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	bool Erase(const KeyLike& key) { return m_Table.Erase(key); }
+
+private:
+	Table m_Table;
+};
@@ -0,0 +1,544 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Config.h"
+#include "Core/Containers/Hash.h"
+#include "Core/Memory/Allocator.h"
+#include "System/Assert.h"
+
+#if defined(NIH_SSE2)
+#include <emmintrin.h>
+#endif
+
+/*
+* Open addressing hash table shared by HashMap and HashSet, laid out like a SwissTable
+* Every slot has one control byte: empty, deleted, or the 7 low bits of the hash of its key.
+* A lookup loads a whole group of control bytes and compares them with the fingerprint at once,
+* only the slots whose fingerprint matches are compared with the key, so most lookups touch one cache line
+* of control bytes and one slot. Slots are stored contiguously in a single allocation with the control bytes
+*/
+namespace HashTableDetail
+{
+	using Control = int8_t;
+
+	inline constexpr Control Empty = -128;
+	inline constexpr Control Deleted = -2;
+
+	// Bits set for every matching byte of a group of Width bytes, Shift turns a bit index into a slot index
+	template<typename Mask, uint32_t Width, uint32_t Shift>
+	class BitMask
+	{
+	public:
+		explicit BitMask(Mask mask) : m_Mask(mask) {}
+
+		explicit operator bool() const { return m_Mask != 0; }
+
+		[[nodiscard]] uint32_t GetLowest() const
+		{
+			return static_cast<uint32_t>(std::countr_zero(m_Mask)) >> Shift;
+		}
+
+		// Bytes before the first match, starting from the first byte or from the last one
+		[[nodiscard]] uint32_t GetTrailingZeros() const { return GetLowest(); }
+		[[nodiscard]] uint32_t GetLeadingZeros() const
+		{
+			constexpr uint32_t UnusedBits = sizeof(Mask) * 8 - (Width << Shift);
+			return (static_cast<uint32_t>(std::countl_zero(m_Mask)) - UnusedBits) >> Shift;
+		}
+
+		void ClearLowest() { m_Mask &= m_Mask - 1; }
+
+	private:
+		Mask m_Mask;
+	};
+
+#if defined(NIH_SSE2)
+	struct Group
+	{
+		static constexpr size_t Width = 16;
+
+		explicit Group(const Control* control) : m_Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+		[[nodiscard]] BitMask<uint32_t, 16, 0> Match(Control fingerprint) const
+		{
+			const __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8(fingerprint), m_Control);
+			return BitMask<uint32_t, 16, 0>(static_cast<uint32_t>(_mm_movemask_epi8(match)));
+		}
+
+		[[nodiscard]] BitMask<uint32_t, 16, 0> MatchEmpty() const
+		{
+			return Match(Empty);
+		}
+
+		// Empty and deleted are the only negative values below -1
+		[[nodiscard]] BitMask<uint32_t, 16, 0> MatchEmptyOrDeleted() const
+		{
+			const __m128i match = _mm_cmpgt_epi8(_mm_set1_epi8(-1), m_Control);
+			return BitMask<uint32_t, 16, 0>(static_cast<uint32_t>(_mm_movemask_epi8(match)));
+		}
+
+		__m128i m_Control;
+	};
+#else
+	// Eight control bytes in a register, compared with bit tricks
+	struct Group
+	{
+		static constexpr size_t Width = 8;
+		static constexpr uint64_t Lsbs = 0x0101010101010101ull;
+		static constexpr uint64_t Msbs = 0x8080808080808080ull;
+
+		explicit Group(const Control* control) { std::memcpy(&m_Control, control, sizeof(m_Control)); }
+
+		// Can report a byte next to a real match by mistake, the keys are compared afterwards anyway
+		[[nodiscard]] BitMask<uint64_t, 8, 3> Match(Control fingerprint) const
+		{
+			const uint64_t x = m_Control ^ (Lsbs * static_cast<uint8_t>(fingerprint));
+			return BitMask<uint64_t, 8, 3>((x - Lsbs) & ~x & Msbs);
+		}
+
+		[[nodiscard]] BitMask<uint64_t, 8, 3> MatchEmpty() const
+		{
+			return BitMask<uint64_t, 8, 3>(m_Control & (~m_Control << 6) & Msbs);
+		}
+
+		[[nodiscard]] BitMask<uint64_t, 8, 3> MatchEmptyOrDeleted() const
+		{
+			return BitMask<uint64_t, 8, 3>(m_Control & (~m_Control << 7) & Msbs);
+		}
+
+		uint64_t m_Control;
+	};
+#endif
+
+	inline uint64_t GetPosition(uint64_t hash) { return hash >> 7; }
+	inline Control GetFingerprint(uint64_t hash) { return static_cast<Control>(hash & 0x7F); }
+}
+
+/*
+* Policy gives the slot type and how to get the key out of it:
+*	using Key, using Slot, static const Key& GetKey(const Slot& slot)
+*/
+template<typename Policy, typename HashFunction, typename KeyEqual, typename Allocator>
+class HashTable
+{
+	using Control = HashTableDetail::Control;
+	using Group = HashTableDetail::Group;
+
+public:
+	using Key = typename Policy::Key;
+	using Slot = typename Policy::Slot;
+
+	// Keys can be looked up through any type the hash and the equality accept, like a string_view for a string
+	template<typename KeyLike>
+	static constexpr bool IsLookupKey = std::is_convertible_v<const KeyLike&, const Key&>
+		|| (requires { typename HashFunction::is_transparent; typename KeyEqual::is_transparent; });
+
+	template<typename SlotType>
+	class IteratorBase
+	{
+	public:
+		IteratorBase(const Control* control, SlotType* slot, const Control* end)
+			: m_Control(control), m_Slot(slot), m_End(end)
+		{
+			SkipFree();
+		}
+
+		SlotType& operator*() const { return *m_Slot; }
+		SlotType* operator->() const { return m_Slot; }
+
+		IteratorBase& operator++()
+		{
+			++m_Control;
+			++m_Slot;
+			SkipFree();
+			return *this;
+		}
+
+		bool operator==(const IteratorBase& other) const { return m_Control == other.m_Control; }
+
+	private:
+		void SkipFree()
+		{
+			while (m_Control != m_End && *m_Control < 0)
+			{
+				++m_Control;
+				++m_Slot;
+			}
+		}
+
+		const Control* m_Control;
+		SlotType* m_Slot;
+		const Control* m_End;
+	};
+
+	using Iterator = IteratorBase<Slot>;
+	using ConstIterator = IteratorBase<const Slot>;
+
+	HashTable() = default;
+	explicit HashTable(const Allocator& allocator) : m_Allocator(allocator) {}
+	explicit HashTable(const HashFunction& hash, const KeyEqual& equal = KeyEqual{}, const Allocator& allocator = Allocator{})
+		: m_Allocator(allocator)
+		, m_Hash(hash)
+		, m_Equal(equal)
+	{
+	}
+
+	HashTable(const HashTable& other)
+		: m_Allocator(other.m_Allocator)
+		, m_Hash(other.m_Hash)
+		, m_Equal(other.m_Equal)
+	{
+		Reserve(other.m_Size);
+		for (const Slot& slot : other)
+		{
+			InsertUnique(HashKey(Policy::GetKey(slot)), slot);
+		}
+	}
+
+	HashTable(HashTable&& other) noexcept
+		: m_Allocator(other.m_Allocator)
+		, m_Hash(other.m_Hash)
+		, m_Equal(other.m_Equal)
+	{
+		TakeStorage(other);
+	}
+
+	~HashTable()
+	{
+		Destroy();
+	}
+
+	// Like the copy constructor the allocator, hash and equality are copied, the storage is kept when the allocators are equal
+	HashTable& operator=(const HashTable& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			if (!(m_Allocator == other.m_Allocator))
+			{
+				Destroy();
+				m_Allocator = other.m_Allocator;
+			}
+			m_Hash = other.m_Hash;
+			m_Equal = other.m_Equal;
+			Reserve(other.m_Size);
+			for (const Slot& slot : other)
+			{
+				InsertUnique(HashKey(Policy::GetKey(slot)), slot);
+			}
+		}
+		return *this;
+	}
+
+	// The allocator, hash and equality move along with the storage, the slots were placed with that hash
+	HashTable& operator=(HashTable&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Destroy();
+			m_Allocator = other.m_Allocator;
+			m_Hash = other.m_Hash;
+			m_Equal = other.m_Equal;
+			TakeStorage(other);
+		}
+		return *this;
+	}
+
+	[[nodiscard]] size_t GetSize() const { return m_Size; }
+	[[nodiscard]] bool IsEmpty() const { return m_Size == 0; }
+	[[nodiscard]] size_t GetCapacity() const { return m_Capacity; }
+	[[nodiscard]] const HashFunction& GetHashFunction() const { return m_Hash; }
+
+	[[nodiscard]] Iterator begin() { return Iterator(m_Control, m_Slots, m_Control + m_Capacity); }
+	[[nodiscard]] Iterator end() { return Iterator(m_Control + m_Capacity, m_Slots + m_Capacity, m_Control + m_Capacity); }
+	[[nodiscard]] ConstIterator begin() const { return ConstIterator(m_Control, m_Slots, m_Control + m_Capacity); }
+	[[nodiscard]] ConstIterator end() const { return ConstIterator(m_Control + m_Capacity, m_Slots + m_Capacity, m_Control + m_Capacity); }
+
+	// Make room for count elements without growing again
+	void Reserve(size_t count)
+	{
+		const size_t capacity = GetCapacityFor(count);
+		if (capacity > m_Capacity)
+		{
+			Rehash(capacity);
+		}
+	}
+
+	// Destroy every element, the storage is kept
+	void Clear()
+	{
+		if (m_Capacity == 0)
+		{
+			return;
+		}
+		DestroySlots();
+		std::memset(m_Control, HashTableDetail::Empty, m_Capacity + Group::Width);
+		m_Size = 0;
+		m_GrowthLeft = GetMaxLoad(m_Capacity);
+	}
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] Slot* Find(const KeyLike& key)
+	{
+		return FindSlot(key, HashKey(key));
+	}
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	[[nodiscard]] const Slot* Find(const KeyLike& key) const
+	{
+		return const_cast<HashTable*>(this)->FindSlot(key, HashKey(key));
+	}
+
+	// Slot of the key, constructed from args when the key is not there yet
+	template<typename KeyLike, typename... Args>
+	std::pair<Slot*, bool> FindOrEmplace(const KeyLike& key, Args&&... args)
+	{
+		const uint64_t hash = HashKey(key);
+		if (Slot* slot = FindSlot(key, hash))
+		{
+			return { slot, false };
+		}
+		return { InsertUnique(hash, std::forward<Args>(args)...), true };
+	}
+
+	template<typename KeyLike> requires IsLookupKey<KeyLike>
+	bool Erase(const KeyLike& key)
+	{
+		Slot* slot = FindSlot(key, HashKey(key));
+		if (slot == nullptr)
+		{
+			return false;
+		}
+
+		const size_t index = static_cast<size_t>(slot - m_Slots);
+		slot->~Slot();
+		m_Size--;
+
+		// when no group holding this slot was ever full, no probe went past it and it can go back to empty
+		const auto emptyAfter = Group(m_Control + index).MatchEmpty();
+		const auto emptyBefore = Group(m_Control + ((index - Group::Width) & (m_Capacity - 1))).MatchEmpty();
+		const bool wasNeverFull = emptyAfter && emptyBefore && emptyAfter.GetTrailingZeros() + emptyBefore.GetLeadingZeros() < Group::Width;
+		SetControl(index, wasNeverFull ? HashTableDetail::Empty : HashTableDetail::Deleted);
+		if (wasNeverFull)
+		{
+			m_GrowthLeft++;
+		}
+		return true;
+	}
+
+private:
+	// 7/8 of the slots can be used before growing
+	static size_t GetMaxLoad(size_t capacity) { return capacity - capacity / 8; }
+
+	static size_t GetCapacityFor(size_t count)
+	{
+		size_t capacity = Group::Width;
+		while (GetMaxLoad(capacity) < count)
+		{
+			capacity *= 2;
+		}
+		return capacity;
+	}
+
+	template<typename KeyLike>
+	uint64_t HashKey(const KeyLike& key) const
+	{
+		return static_cast<uint64_t>(m_Hash(key));
+	}
+
+	template<typename KeyLike>
+	Slot* FindSlot(const KeyLike& key, uint64_t hash)
+	{
+		if (m_Capacity == 0)
+		{
+			return nullptr;
+		}
+
+		const size_t mask = m_Capacity - 1;
+		const Control fingerprint = HashTableDetail::GetFingerprint(hash);
+		size_t position = HashTableDetail::GetPosition(hash) & mask;
+		size_t step = 0;
+		while (true)
+		{
+			const Group group(m_Control + position);
+			for (auto match = group.Match(fingerprint); match; match.ClearLowest())
+			{
+				Slot& slot = m_Slots[(position + match.GetLowest()) & mask];
+				if (m_Equal(Policy::GetKey(slot), key))
+				{
+					return &slot;
+				}
+			}
+			if (group.MatchEmpty())
+			{
+				return nullptr;
+			}
+
+			// triangular probing visits every group once the table is a power of two groups
+			step += Group::Width;
+			position = (position + step) & mask;
+			NIH_ASSERT(step <= m_Capacity);
+		}
+	}
+
+	size_t FindFreeIndex(uint64_t hash) const
+	{
+		const size_t mask = m_Capacity - 1;
+		size_t position = HashTableDetail::GetPosition(hash) & mask;
+		size_t step = 0;
+		while (true)
+		{
+			const auto match = Group(m_Control + position).MatchEmptyOrDeleted();
+			if (match)
+			{
+				return (position + match.GetLowest()) & mask;
+			}
+			step += Group::Width;
+			position = (position + step) & mask;
+		}
+	}
+
+	// The key must not be in the table yet
+	template<typename... Args>
+	Slot* InsertUnique(uint64_t hash, Args&&... args)
+	{
+		if (m_Capacity == 0)
+		{
+			Rehash(Group::Width);
+		}
+
+		size_t index = FindFreeIndex(hash);
+		if (m_GrowthLeft == 0 && m_Control[index] == HashTableDetail::Empty)
+		{
+			// when most of the used slots are tombstones a rehash at the same size is enough
+			Rehash(m_Size * 2 < GetMaxLoad(m_Capacity) ? m_Capacity : m_Capacity * 2);
+			index = FindFreeIndex(hash);
+		}
+
+		if (m_Control[index] == HashTableDetail::Empty)
+		{
+			m_GrowthLeft--;
+		}
+		SetControl(index, HashTableDetail::GetFingerprint(hash));
+		m_Size++;
+		return new (m_Slots + index) Slot(std::forward<Args>(args)...);
+	}
+
+	// The control bytes past the capacity mirror the first group, so a group can be loaded from any slot
+	void SetControl(size_t index, Control control)
+	{
+		m_Control[index] = control;
+		if (index < Group::Width)
+		{
+			m_Control[m_Capacity + index] = control;
+		}
+	}
+
+	void Rehash(size_t capacity)
+	{
+		Control* oldControl = m_Control;
+		Slot* oldSlots = m_Slots;
+		const size_t oldCapacity = m_Capacity;
+
+		Allocate(capacity);
+		for (size_t i = 0; i < oldCapacity; ++i)
+		{
+			if (oldControl[i] >= 0)
+			{
+				Slot& slot = oldSlots[i];
+				const uint64_t hash = HashKey(Policy::GetKey(slot));
+				const size_t index = FindFreeIndex(hash);
+				SetControl(index, HashTableDetail::GetFingerprint(hash));
+				if constexpr (IsTriviallyRelocatableV<Slot>)
+				{
+					std::memcpy(static_cast<void*>(m_Slots + index), static_cast<const void*>(&slot), sizeof(Slot));
+				}
+				else
+				{
+					new (m_Slots + index) Slot(std::move(slot));
+					slot.~Slot();
+				}
+			}
+		}
+		m_GrowthLeft = GetMaxLoad(m_Capacity) - m_Size;
+
+		if (oldCapacity > 0)
+		{
+			m_Allocator.Free(oldControl, GetAllocationSize(oldCapacity), GetAllocationAlignment());
+		}
+	}
+
+	static size_t GetSlotsOffset(size_t capacity)
+	{
+		return (capacity + Group::Width + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+	}
+
+	static size_t GetAllocationSize(size_t capacity) { return GetSlotsOffset(capacity) + capacity * sizeof(Slot); }
+	static size_t GetAllocationAlignment() { return alignof(Slot) > Group::Width ? alignof(Slot) : Group::Width; }
+
+	// Control bytes first then the slots, in one block
+	void Allocate(size_t capacity)
+	{
+		std::byte* memory = static_cast<std::byte*>(m_Allocator.Allocate(GetAllocationSize(capacity), GetAllocationAlignment()));
+		m_Control = reinterpret_cast<Control*>(memory);
+		m_Slots = reinterpret_cast<Slot*>(memory + GetSlotsOffset(capacity));
+		m_Capacity = capacity;
+		std::memset(m_Control, HashTableDetail::Empty, capacity + Group::Width);
+	}
+
+	void DestroySlots()
+	{
+		if constexpr (!std::is_trivially_destructible_v<Slot>)
+		{
+			for (size_t i = 0; i < m_Capacity; ++i)
+			{
+				if (m_Control[i] >= 0)
+				{
+					m_Slots[i].~Slot();
+				}
+			}
+		}
+	}
+
+	void Destroy()
+	{
+		if (m_Capacity == 0)
+		{
+			return;
+		}
+		DestroySlots();
+		m_Allocator.Free(m_Control, GetAllocationSize(m_Capacity), GetAllocationAlignment());
+		m_Control = nullptr;
+		m_Slots = nullptr;
+		m_Capacity = 0;
+		m_Size = 0;
+		m_GrowthLeft = 0;
+	}
+
+	void TakeStorage(HashTable& other)
+	{
+		m_Control = std::exchange(other.m_Control, nullptr);
+		m_Slots = std::exchange(other.m_Slots, nullptr);
+		m_Capacity = std::exchange(other.m_Capacity, 0);
+		m_Size = std::exchange(other.m_Size, 0);
+		m_GrowthLeft = std::exchange(other.m_GrowthLeft, 0);
+	}
+
+	[[no_unique_address]] Allocator m_Allocator{};
+	[[no_unique_address]] HashFunction m_Hash{};
+	[[no_unique_address]] KeyEqual m_Equal{};
+
+	Control* m_Control{nullptr};
+	Slot* m_Slots{nullptr};
+	size_t m_Capacity{0};
+	size_t m_Size{0};
+	// Empty slots that can still be filled before the load factor is reached, deleted ones do not count
+	size_t m_GrowthLeft{0};
+};
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "Core/Memory/CacheLine.h"
+#include "Core/NonCopyable.h"
+
+/*
+* Bounded lock free queue for any number of producers and consumers, after Dmitry Vyukov's design
+* Every cell carries a sequence number that tells whose turn it is: a producer can fill cell i when its
+* sequence is i, a consumer can empty it when it is i + 1. Claiming a position is a single CAS on the
+* shared index, so threads only contend on the index and on the cells they actually touch
+*/
+template<typename T, size_t Capacity>
+class MpmcQueue : private NonCopyable
+{
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	MpmcQueue()
+	{
+		for (size_t i = 0; i < Capacity; ++i)
+		{
+			m_Cells[i].m_Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	~MpmcQueue()
+	{
+		// nobody pushes or pops anymore, every claimed cell between the indices holds an item
+		const size_t end = m_EnqueuePosition.load(std::memory_order_acquire);
+		for (size_t position = m_DequeuePosition.load(std::memory_order_acquire); position != end; ++position)
+		{
+			m_Cells[position & Mask].GetItem()->~T();
+		}
+	}
+
+	// Returns false when the queue is full
+	template<typename Item>
+	bool TryPush(Item&& item)
+	{
+		size_t position;
+		if (ClaimPush(1, position) == 0)
+		{
+			return false;
+		}
+		Publish(m_Cells[position & Mask], position, std::forward<Item>(item));
+		return true;
+	}
+
+	// Claims up to count consecutive cells with one CAS, returns how many items were pushed
+	size_t TryPushBatch(const T* items, size_t count)
+	{
+		size_t position;
+		const size_t pushCount = ClaimPush(count, position);
+		for (size_t i = 0; i < pushCount; ++i)
+		{
+			Publish(m_Cells[(position + i) & Mask], position + i, items[i]);
+		}
+		return pushCount;
+	}
+
+	// Returns false when the queue is empty
+	bool TryPop(T& item)
+	{
+		size_t position;
+		if (ClaimPop(1, position) == 0)
+		{
+			return false;
+		}
+		Consume(m_Cells[position & Mask], position, item);
+		return true;
+	}
+
+	// Claims up to maxCount consecutive cells with one CAS, returns how many items were popped
+	size_t TryPopBatch(T* items, size_t maxCount)
+	{
+		size_t position;
+		const size_t popCount = ClaimPop(maxCount, position);
+		for (size_t i = 0; i < popCount; ++i)
+		{
+			Consume(m_Cells[(position + i) & Mask], position + i, items[i]);
+		}
+		return popCount;
+	}
+
+	// Approximation only, the value can be stale as soon as it is returned
+	[[nodiscard]] size_t GetSize() const
+	{
+		const size_t enqueue = m_EnqueuePosition.load(std::memory_order_relaxed);
+		const size_t dequeue = m_DequeuePosition.load(std::memory_order_relaxed);
+		return enqueue > dequeue ? enqueue - dequeue : 0;
+	}
+
+	[[nodiscard]] bool IsEmpty() const { return GetSize() == 0; }
+	[[nodiscard]] static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	static constexpr size_t Mask = Capacity - 1;
+
+	struct alignas(CacheLineSize) Cell
+	{
+		std::atomic<size_t> m_Sequence;
+		alignas(T) std::byte m_Storage[sizeof(T)];
+
+		T* GetItem() { return std::launder(reinterpret_cast<T*>(m_Storage)); }
+	};
+
+	// Number of consecutive cells starting at the current position whose sequence is position + offset
+	size_t CountReady(size_t position, size_t maxCount, size_t offset) const
+	{
+		size_t count = 0;
+		while (count < maxCount && m_Cells[(position + count) & Mask].m_Sequence.load(std::memory_order_acquire) == position + count + offset)
+		{
+			count++;
+		}
+		return count;
+	}
+
+	size_t Claim(std::atomic<size_t>& index, size_t maxCount, size_t offset, size_t& position)
+	{
+		position = index.load(std::memory_order_relaxed);
+		while (true)
+		{
+			const size_t sequence = m_Cells[position & Mask].m_Sequence.load(std::memory_order_acquire);
+			const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + offset);
+			if (difference < 0)
+			{
+				// the cell is still used by the previous lap, the queue is full (push) or empty (pop)
+				return 0;
+			}
+			if (difference > 0)
+			{
+				// another thread claimed this position already
+				position = index.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			// once the CAS succeeds nobody else can change the sequences of the claimed cells
+			const size_t count = CountReady(position, maxCount, offset);
+			if (index.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+			{
+				return count;
+			}
+		}
+	}
+
+	size_t ClaimPush(size_t maxCount, size_t& position) { return Claim(m_EnqueuePosition, maxCount, 0, position); }
+	size_t ClaimPop(size_t maxCount, size_t& position) { return Claim(m_DequeuePosition, maxCount, 1, position); }
+
+	template<typename Item>
+	void Publish(Cell& cell, size_t position, Item&& item)
+	{
+		new (cell.m_Storage) T(std::forward<Item>(item));
+		cell.m_Sequence.store(position + 1, std::memory_order_release);
+	}
+
+	void Consume(Cell& cell, size_t position, T& item)
+	{
+		T* stored = cell.GetItem();
+		item = std::move(*stored);
+		stored->~T();
+		// the cell is free again for the producer of the next lap
+		cell.m_Sequence.store(position + Capacity, std::memory_order_release);
+	}
+
+	alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePosition{0};
+	alignas(CacheLineSize) std::atomic<size_t> m_DequeuePosition{0};
+	Cell m_Cells[Capacity];
+};
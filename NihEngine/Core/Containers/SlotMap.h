@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/Allocator.h"
+#include "System/Assert.h"
+
+/*
+* Index of a slot plus the generation of the slot when the handle was made
+* A slot gets a new generation every time its element is erased, so an old handle never reaches the next element
+* 32 bits handles have 20 bits of index and 12 of generation, 64 bits handles 32 of each
+*/
+template<typename Storage>
+class GenerationalHandle
+{
+	static_assert(std::is_same_v<Storage, uint32_t> || std::is_same_v<Storage, uint64_t>, "Handles are 32 or 64 bits");
+
+public:
+	static constexpr uint32_t IndexBits = sizeof(Storage) == 4 ? 20 : 32;
+	static constexpr uint32_t GenerationBits = sizeof(Storage) * 8 - IndexBits;
+	static constexpr uint32_t MaxIndex = static_cast<uint32_t>((Storage(1) << IndexBits) - 2);
+	static constexpr uint32_t MaxGeneration = static_cast<uint32_t>((Storage(1) << GenerationBits) - 1);
+
+	constexpr GenerationalHandle() = default;
+	constexpr GenerationalHandle(uint32_t index, uint32_t generation)
+		: m_Value((static_cast<Storage>(generation) << IndexBits) | index)
+	{
+	}
+
+	[[nodiscard]] constexpr uint32_t GetIndex() const { return static_cast<uint32_t>(m_Value & ((Storage(1) << IndexBits) - 1)); }
+	[[nodiscard]] constexpr uint32_t GetGeneration() const { return static_cast<uint32_t>(m_Value >> IndexBits); }
+	[[nodiscard]] constexpr Storage GetValue() const { return m_Value; }
+
+	// A default handle never refers to anything
+	[[nodiscard]] constexpr bool IsValid() const { return m_Value != std::numeric_limits<Storage>::max(); }
+
+	[[nodiscard]] constexpr bool operator==(const GenerationalHandle&) const = default;
+
+private:
+	Storage m_Value{std::numeric_limits<Storage>::max()};
+};
+
+using Handle32 = GenerationalHandle<uint32_t>;
+using Handle64 = GenerationalHandle<uint64_t>;
+
+/*
+* Elements packed in a dense array and reached through generational handles
+* Iterating goes straight over the dense array. Erasing moves the last element in the hole,
+* so the order of the elements changes but every handle stays valid, and handles to an erased element
+* are detected as stale instead of reaching whatever took its slot
+*/
+template<typename T, typename Handle = Handle64, typename Allocator = HeapAllocator>
+class SlotMap
+{
+public:
+	using Iterator = T*;
+	using ConstIterator = const T*;
+
+	SlotMap() = default;
+	explicit SlotMap(const Allocator& allocator)
+		: m_Values(allocator)
+		, m_DenseToSlot(allocator)
+		, m_Slots(allocator)
+	{
+	}
+
+	[[nodiscard]] size_t GetSize() const { return m_Values.GetSize(); }
+	[[nodiscard]] bool IsEmpty() const { return m_Values.IsEmpty(); }
+
+	// Dense storage, the order changes when elements are erased
+	[[nodiscard]] T* GetData() { return m_Values.GetData(); }
+	[[nodiscard]] const T* GetData() const { return m_Values.GetData(); }
+	[[nodiscard]] Iterator begin() { return m_Values.begin(); }
+	[[nodiscard]] Iterator end() { return m_Values.end(); }
+	[[nodiscard]] ConstIterator begin() const { return m_Values.begin(); }
+	[[nodiscard]] ConstIterator end() const { return m_Values.end(); }
+
+	// Handle of the element at this position of the dense storage
+	[[nodiscard]] Handle GetHandleAt(size_t denseIndex) const
+	{
+		const uint32_t slotIndex = m_DenseToSlot[denseIndex];
+		return Handle(slotIndex, m_Slots[slotIndex].m_Generation);
+	}
+
+	void Reserve(size_t count)
+	{
+		m_Values.Reserve(count);
+		m_DenseToSlot.Reserve(count);
+		m_Slots.Reserve(count);
+	}
+
+	Handle Insert(const T& value) { return Emplace(value); }
+	Handle Insert(T&& value) { return Emplace(std::move(value)); }
+
+	template<typename... Args>
+	Handle Emplace(Args&&... args)
+	{
+		uint32_t slotIndex;
+		if (m_FreeHead != InvalidIndex)
+		{
+			slotIndex = m_FreeHead;
+			m_FreeHead = m_Slots[slotIndex].m_DenseIndex;
+		}
+		else
+		{
+			NIH_ASSERT(m_Slots.GetSize() <= Handle::MaxIndex);
+			slotIndex = static_cast<uint32_t>(m_Slots.GetSize());
+			m_Slots.PushBack(Slot{});
+		}
+
+		Slot& slot = m_Slots[slotIndex];
+		slot.m_DenseIndex = static_cast<uint32_t>(m_Values.GetSize());
+		slot.m_IsUsed = true;
+		m_Values.EmplaceBack(std::forward<Args>(args)...);
+		m_DenseToSlot.PushBack(slotIndex);
+		return Handle(slotIndex, slot.m_Generation);
+	}
+
+	// nullptr when the handle is stale
+	[[nodiscard]] T* Get(Handle handle)
+	{
+		const Slot* slot = FindSlot(handle);
+		return slot != nullptr ? &m_Values[slot->m_DenseIndex] : nullptr;
+	}
+
+	[[nodiscard]] const T* Get(Handle handle) const
+	{
+		const Slot* slot = FindSlot(handle);
+		return slot != nullptr ? &m_Values[slot->m_DenseIndex] : nullptr;
+	}
+
+	[[nodiscard]] bool Contains(Handle handle) const { return FindSlot(handle) != nullptr; }
+
+	// O(1), the last element takes the place of the erased one, returns false for a stale handle
+	bool Erase(Handle handle)
+	{
+		if (FindSlot(handle) == nullptr)
+		{
+			return false;
+		}
+
+		const uint32_t slotIndex = handle.GetIndex();
+		Slot& slot = m_Slots[slotIndex];
+		const uint32_t denseIndex = slot.m_DenseIndex;
+		const uint32_t lastIndex = static_cast<uint32_t>(m_Values.GetSize() - 1);
+		if (denseIndex != lastIndex)
+		{
+			m_Values[denseIndex] = std::move(m_Values[lastIndex]);
+			m_DenseToSlot[denseIndex] = m_DenseToSlot[lastIndex];
+			m_Slots[m_DenseToSlot[denseIndex]].m_DenseIndex = denseIndex;
+		}
+		m_Values.PopBack();
+		m_DenseToSlot.PopBack();
+
+		Release(slotIndex);
+		return true;
+	}
+
+	void Clear()
+	{
+		for (uint32_t slotIndex : m_DenseToSlot)
+		{
+			Release(slotIndex);
+		}
+		m_Values.Clear();
+		m_DenseToSlot.Clear();
+	}
+
+private:
+	static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+	struct Slot
+	{
+		// position in the dense storage, or next free slot once released
+		uint32_t m_DenseIndex{InvalidIndex};
+		uint32_t m_Generation{0};
+		bool m_IsUsed{false};
+	};
+
+	const Slot* FindSlot(Handle handle) const
+	{
+		const uint32_t slotIndex = handle.GetIndex();
+		if (!handle.IsValid() || slotIndex >= m_Slots.GetSize())
+		{
+			return nullptr;
+		}
+		const Slot& slot = m_Slots[slotIndex];
+		return slot.m_IsUsed && slot.m_Generation == handle.GetGeneration() ? &slot : nullptr;
+	}
+
+	void Release(uint32_t slotIndex)
+	{
+		Slot& slot = m_Slots[slotIndex];
+		slot.m_IsUsed = false;
+
+		// a slot that ran out of generations is retired, reusing it would make old handles valid again
+		if (slot.m_Generation == Handle::MaxGeneration)
+		{
+			return;
+		}
+		slot.m_Generation++;
+		slot.m_DenseIndex = m_FreeHead;
+		m_FreeHead = slotIndex;
+	}
+
+	Vector<T, Allocator> m_Values;
+	Vector<uint32_t, Allocator> m_DenseToSlot;
+	Vector<Slot, Allocator> m_Slots;
+	uint32_t m_FreeHead{InvalidIndex};
+};
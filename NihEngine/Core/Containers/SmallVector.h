@@ -0,0 +1,346 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Memory/Allocator.h"
+#include "System/Assert.h"
+
+/*
+* Vector that keeps up to InlineCapacity elements inside itself and only goes to the allocator past that
+* Same interface as Vector, meant for the many short lists that would otherwise cost a heap allocation each.
+* Moving a small vector that still uses its inline storage moves the elements one by one
+*/
+template<typename T, size_t InlineCapacity, typename Allocator = HeapAllocator>
+class SmallVector
+{
+	static_assert(InlineCapacity > 0, "Use Vector when there is no inline storage");
+
+public:
+	using ValueType = T;
+	using Iterator = T*;
+	using ConstIterator = const T*;
+
+	static constexpr float DefaultGrowthFactor = 2.0f;
+
+	SmallVector() = default;
+	explicit SmallVector(const Allocator& allocator) : m_Allocator(allocator) {}
+
+	explicit SmallVector(size_t count, const Allocator& allocator = Allocator())
+		: m_Allocator(allocator)
+	{
+		Resize(count);
+	}
+
+	SmallVector(size_t count, const T& value, const Allocator& allocator = Allocator())
+		: m_Allocator(allocator)
+	{
+		Resize(count, value);
+	}
+
+	SmallVector(std::initializer_list<T> values, const Allocator& allocator = Allocator())
+		: m_Allocator(allocator)
+	{
+		Reserve(values.size());
+		for (const T& value : values)
+		{
+			PushBackUnchecked(value);
+		}
+	}
+
+	SmallVector(const SmallVector& other)
+		: m_Allocator(other.m_Allocator)
+		, m_GrowthFactor(other.m_GrowthFactor)
+	{
+		CopyFrom(other);
+	}
+
+	SmallVector(SmallVector&& other) noexcept
+		: m_Allocator(other.m_Allocator)
+		, m_GrowthFactor(other.m_GrowthFactor)
+	{
+		MoveFrom(other);
+	}
+
+	~SmallVector()
+	{
+		Clear();
+		Deallocate();
+	}
+
+	// Like the copy constructor the allocator and growth factor are copied, the storage is kept when the allocators are equal
+	SmallVector& operator=(const SmallVector& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			if (!(m_Allocator == other.m_Allocator))
+			{
+				Deallocate();
+				m_Allocator = other.m_Allocator;
+			}
+			m_GrowthFactor = other.m_GrowthFactor;
+			CopyFrom(other);
+		}
+		return *this;
+	}
+
+	// The allocator and growth factor move along with the storage
+	SmallVector& operator=(SmallVector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			Deallocate();
+			m_Allocator = other.m_Allocator;
+			m_GrowthFactor = other.m_GrowthFactor;
+			MoveFrom(other);
+		}
+		return *this;
+	}
+
+	[[nodiscard]] size_t GetSize() const { return m_Size; }
+	[[nodiscard]] size_t GetCapacity() const { return m_Capacity; }
+	[[nodiscard]] bool IsEmpty() const { return m_Size == 0; }
+	[[nodiscard]] bool IsInline() const { return m_Data == GetInlineData(); }
+	[[nodiscard]] T* GetData() { return m_Data; }
+	[[nodiscard]] const T* GetData() const { return m_Data; }
+	[[nodiscard]] const Allocator& GetAllocator() const { return m_Allocator; }
+
+	// Capacity is multiplied by this factor once the inline storage is full, it must be greater than 1
+	[[nodiscard]] float GetGrowthFactor() const { return m_GrowthFactor; }
+	void SetGrowthFactor(float growthFactor)
+	{
+		NIH_ASSERT(growthFactor > 1.0f);
+		m_GrowthFactor = growthFactor;
+	}
+
+	[[nodiscard]] T& At(size_t pos)
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] const T& At(size_t pos) const
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] T& operator[](size_t pos)
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] const T& operator[](size_t pos) const
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] T& Front() { return At(0); }
+	[[nodiscard]] const T& Front() const { return At(0); }
+	[[nodiscard]] T& Back() { return At(m_Size - 1); }
+	[[nodiscard]] const T& Back() const { return At(m_Size - 1); }
+
+	[[nodiscard]] Iterator begin() { return m_Data; }
+	[[nodiscard]] Iterator end() { return m_Data + m_Size; }
+	[[nodiscard]] ConstIterator begin() const { return m_Data; }
+	[[nodiscard]] ConstIterator end() const { return m_Data + m_Size; }
+
+	void Reserve(size_t capacity)
+	{
+		if (capacity > m_Capacity)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	void Resize(size_t size)
+	{
+		Reserve(size);
+		for (size_t i = m_Size; i < size; ++i)
+		{
+			new (m_Data + i) T();
+		}
+		DestroyRange(std::min(size, m_Size), m_Size);
+		m_Size = size;
+	}
+
+	void Resize(size_t size, const T& value)
+	{
+		Reserve(size);
+		for (size_t i = m_Size; i < size; ++i)
+		{
+			new (m_Data + i) T(value);
+		}
+		DestroyRange(std::min(size, m_Size), m_Size);
+		m_Size = size;
+	}
+
+	void Assign(size_t count, const T& value)
+	{
+		Clear();
+		Resize(count, value);
+	}
+
+	// Keeps the heap storage if there is one, use ShrinkToFit to go back inline
+	void Clear()
+	{
+		DestroyRange(0, m_Size);
+		m_Size = 0;
+	}
+
+	// Give the heap storage back when the elements fit inline again
+	void ShrinkToFit()
+	{
+		if (!IsInline() && m_Size <= InlineCapacity)
+		{
+			T* data = m_Data;
+			const size_t capacity = m_Capacity;
+			m_Data = GetInlineData();
+			m_Capacity = InlineCapacity;
+			Relocate(data, m_Data, m_Size);
+			m_Allocator.Free(data, capacity * sizeof(T), alignof(T));
+		}
+	}
+
+	void PushBack(const T& value) { EmplaceBack(value); }
+	void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+	template<typename... Args>
+	T& EmplaceBack(Args&&... args)
+	{
+		if (m_Size == m_Capacity)
+		{
+			// the arguments can point inside the vector, build the element before the old storage goes away
+			T value(std::forward<Args>(args)...);
+			Reallocate(std::max(m_Size + 1, static_cast<size_t>(static_cast<float>(m_Capacity) * m_GrowthFactor)));
+			return *new (m_Data + m_Size++) T(std::move(value));
+		}
+		return *new (m_Data + m_Size++) T(std::forward<Args>(args)...);
+	}
+
+	// The capacity must already be there, e.g. after a Reserve, no check is done in release
+	void PushBackUnchecked(const T& value)
+	{
+		NIH_ASSERT(m_Size < m_Capacity);
+		new (m_Data + m_Size++) T(value);
+	}
+	void PushBackUnchecked(T&& value)
+	{
+		NIH_ASSERT(m_Size < m_Capacity);
+		new (m_Data + m_Size++) T(std::move(value));
+	}
+
+	void PopBack()
+	{
+		NIH_ASSERT(m_Size > 0);
+		m_Data[--m_Size].~T();
+	}
+
+	Iterator Erase(ConstIterator first, ConstIterator last)
+	{
+		T* const begin = m_Data + (first - m_Data);
+		T* const end = m_Data + (last - m_Data);
+		T* const newEnd = std::move(end, m_Data + m_Size, begin);
+		DestroyRange(static_cast<size_t>(newEnd - m_Data), m_Size);
+		m_Size = static_cast<size_t>(newEnd - m_Data);
+		return begin;
+	}
+
+	Iterator Erase(ConstIterator position) { return Erase(position, position + 1); }
+
+	[[nodiscard]] bool operator==(const SmallVector& other) const
+	{
+		return m_Size == other.m_Size && std::equal(begin(), end(), other.begin());
+	}
+
+private:
+	[[nodiscard]] T* GetInlineData() { return reinterpret_cast<T*>(m_InlineStorage); }
+	[[nodiscard]] const T* GetInlineData() const { return reinterpret_cast<const T*>(m_InlineStorage); }
+
+	// Move count elements to uninitialized storage and end the lifetime of the source ones
+	static void Relocate(T* source, T* destination, size_t count)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (count > 0)
+			{
+				std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				new (destination + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+
+	void Reallocate(size_t capacity)
+	{
+		T* data = static_cast<T*>(m_Allocator.Allocate(capacity * sizeof(T), alignof(T)));
+		Relocate(m_Data, data, m_Size);
+		Deallocate();
+		m_Data = data;
+		m_Capacity = capacity;
+	}
+
+	// Back to the inline storage, the elements must already be gone
+	void Deallocate()
+	{
+		if (!IsInline())
+		{
+			m_Allocator.Free(m_Data, m_Capacity * sizeof(T), alignof(T));
+			m_Data = GetInlineData();
+			m_Capacity = InlineCapacity;
+		}
+	}
+
+	void DestroyRange(size_t first, size_t last)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_t i = first; i < last; ++i)
+			{
+				m_Data[i].~T();
+			}
+		}
+	}
+
+	void CopyFrom(const SmallVector& other)
+	{
+		Reserve(other.m_Size);
+		for (const T& value : other)
+		{
+			PushBackUnchecked(value);
+		}
+	}
+
+	// This vector must be empty and inline
+	void MoveFrom(SmallVector& other)
+	{
+		if (other.IsInline())
+		{
+			Relocate(other.m_Data, m_Data, other.m_Size);
+			m_Size = std::exchange(other.m_Size, 0);
+			return;
+		}
+
+		m_Data = std::exchange(other.m_Data, other.GetInlineData());
+		m_Size = std::exchange(other.m_Size, 0);
+		m_Capacity = std::exchange(other.m_Capacity, InlineCapacity);
+	}
+
+	[[no_unique_address]] Allocator m_Allocator{};
+	T* m_Data{GetInlineData()};
+	size_t m_Size{0};
+	size_t m_Capacity{InlineCapacity};
+	float m_GrowthFactor{DefaultGrowthFactor};
+	alignas(T) std::byte m_InlineStorage[InlineCapacity * sizeof(T)];
+};
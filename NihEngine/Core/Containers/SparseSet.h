@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/Allocator.h"
+#include "System/Assert.h"
+
+/*
+* Set of small unsigned integer ids with O(1) insert, erase and lookup, and iteration over a packed array
+* The sparse array maps an id to its position in the dense array, so it grows up to the biggest id inserted:
+* meant for ids that are indices already (entities, slots), not for hashes
+* Erasing moves the last id in the hole, the dense order is not the insertion order
+*/
+template<typename T = uint32_t, typename Allocator = HeapAllocator>
+class SparseSet
+{
+	static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>, "SparseSet stores unsigned integer ids");
+
+public:
+	using Iterator = const T*;
+
+	SparseSet() = default;
+	explicit SparseSet(const Allocator& allocator)
+		: m_Dense(allocator)
+		, m_Sparse(allocator)
+	{
+	}
+
+	[[nodiscard]] size_t GetSize() const { return m_Dense.GetSize(); }
+	[[nodiscard]] bool IsEmpty() const { return m_Dense.IsEmpty(); }
+	[[nodiscard]] const T* GetData() const { return m_Dense.GetData(); }
+	[[nodiscard]] Iterator begin() const { return m_Dense.begin(); }
+	[[nodiscard]] Iterator end() const { return m_Dense.end(); }
+
+	// Makes room for ids below maxId without growing the sparse array later
+	void Reserve(size_t count, size_t maxId)
+	{
+		m_Dense.Reserve(count);
+		if (m_Sparse.GetSize() < maxId)
+		{
+			m_Sparse.Resize(maxId, InvalidPosition);
+		}
+	}
+
+	[[nodiscard]] bool Contains(T id) const
+	{
+		return id < m_Sparse.GetSize() && m_Sparse[id] != InvalidPosition;
+	}
+
+	// Position of the id in the dense array, GetSize() when it is not in the set
+	[[nodiscard]] size_t IndexOf(T id) const
+	{
+		return Contains(id) ? m_Sparse[id] : GetSize();
+	}
+
+	// Returns false when the id was already in the set
+	bool Insert(T id)
+	{
+		NIH_ASSERT(id != InvalidPosition);
+		if (id >= m_Sparse.GetSize())
+		{
+			m_Sparse.Resize(static_cast<size_t>(id) + 1, InvalidPosition);
+		}
+		else if (m_Sparse[id] != InvalidPosition)
+		{
+			return false;
+		}
+
+		m_Sparse[id] = static_cast<T>(m_Dense.GetSize());
+		m_Dense.PushBack(id);
+		return true;
+	}
+
+	// Returns false when the id was not in the set
+	bool Erase(T id)
+	{
+		if (!Contains(id))
+		{
+			return false;
+		}
+
+		const T position = m_Sparse[id];
+		const T last = m_Dense.Back();
+		m_Dense[position] = last;
+		m_Sparse[last] = position;
+		m_Dense.PopBack();
+		m_Sparse[id] = InvalidPosition;
+		return true;
+	}
+
+	// O(size), only the ids in the set are touched
+	void Clear()
+	{
+		for (T id : m_Dense)
+		{
+			m_Sparse[id] = InvalidPosition;
+		}
+		m_Dense.Clear();
+	}
+
+private:
+	static constexpr T InvalidPosition = std::numeric_limits<T>::max();
+
+	Vector<T, Allocator> m_Dense;
+	Vector<T, Allocator> m_Sparse;
+};
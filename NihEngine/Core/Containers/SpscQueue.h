@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "Core/Memory/CacheLine.h"
+#include "Core/NonCopyable.h"
+
+/*
+* Bounded wait free queue between exactly one producer thread and one consumer thread
+* Each side owns its index on its own cache line and keeps a cached copy of the other side's index,
+* so the shared line is only read again when the queue looks full (producer) or empty (consumer)
+*/
+template<typename T, size_t Capacity>
+class SpscQueue : private NonCopyable
+{
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	SpscQueue() = default;
+
+	~SpscQueue()
+	{
+		// destroyed in place, T does not need a default constructor
+		const size_t tail = m_Tail.load(std::memory_order_acquire);
+		for (size_t head = m_Head.load(std::memory_order_acquire); head != tail; ++head)
+		{
+			GetCell(head)->~T();
+		}
+	}
+
+	// Producer only, returns false when the queue is full
+	template<typename Item>
+	bool TryPush(Item&& item)
+	{
+		const size_t tail = m_Tail.load(std::memory_order_relaxed);
+		if (tail - m_CachedHead == Capacity)
+		{
+			m_CachedHead = m_Head.load(std::memory_order_acquire);
+			if (tail - m_CachedHead == Capacity)
+			{
+				return false;
+			}
+		}
+
+		new (GetCell(tail)) T(std::forward<Item>(item));
+		m_Tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Producer only, pushes as many items as there is room for and returns how many
+	size_t TryPushBatch(const T* items, size_t count)
+	{
+		const size_t tail = m_Tail.load(std::memory_order_relaxed);
+		size_t room = Capacity - (tail - m_CachedHead);
+		if (room < count)
+		{
+			m_CachedHead = m_Head.load(std::memory_order_acquire);
+			room = Capacity - (tail - m_CachedHead);
+		}
+
+		const size_t pushCount = count < room ? count : room;
+		for (size_t i = 0; i < pushCount; ++i)
+		{
+			new (GetCell(tail + i)) T(items[i]);
+		}
+		// a single release publishes the whole batch
+		m_Tail.store(tail + pushCount, std::memory_order_release);
+		return pushCount;
+	}
+
+	// Consumer only, returns false when the queue is empty
+	bool TryPop(T& item)
+	{
+		const size_t head = m_Head.load(std::memory_order_relaxed);
+		if (head == m_CachedTail)
+		{
+			m_CachedTail = m_Tail.load(std::memory_order_acquire);
+			if (head == m_CachedTail)
+			{
+				return false;
+			}
+		}
+
+		T* cell = GetCell(head);
+		item = std::move(*cell);
+		cell->~T();
+		m_Head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer only, pops up to maxCount items and returns how many
+	size_t TryPopBatch(T* items, size_t maxCount)
+	{
+		const size_t head = m_Head.load(std::memory_order_relaxed);
+		size_t available = m_CachedTail - head;
+		if (available < maxCount)
+		{
+			m_CachedTail = m_Tail.load(std::memory_order_acquire);
+			available = m_CachedTail - head;
+		}
+
+		const size_t popCount = maxCount < available ? maxCount : available;
+		for (size_t i = 0; i < popCount; ++i)
+		{
+			T* cell = GetCell(head + i);
+			items[i] = std::move(*cell);
+			cell->~T();
+		}
+		m_Head.store(head + popCount, std::memory_order_release);
+		return popCount;
+	}
+
+	// Approximation only, the value can be stale as soon as it is returned
+	[[nodiscard]] size_t GetSize() const
+	{
+		return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]] bool IsEmpty() const { return GetSize() == 0; }
+	[[nodiscard]] static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	static constexpr size_t Mask = Capacity - 1;
+
+	T* GetCell(size_t index) { return std::launder(reinterpret_cast<T*>(m_Buffer + (index & Mask) * sizeof(T))); }
+
+	// consumer side
+	alignas(CacheLineSize) std::atomic<size_t> m_Head{0};
+	size_t m_CachedTail{0};
+
+	// producer side
+	alignas(CacheLineSize) std::atomic<size_t> m_Tail{0};
+	size_t m_CachedHead{0};
+
+	alignas(CacheLineSize) alignas(T) std::byte m_Buffer[Capacity * sizeof(T)];
+};
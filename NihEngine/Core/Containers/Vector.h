@@ -1,6 +1,323 @@
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
 
+#include "Core/Memory/Allocator.h"
+#include "System/Assert.h"
+
+/*
+* Dynamic array on top of an engine allocator
+* Growing a trivially relocatable type moves its bytes with a memcpy instead of moving element by element.
+* Iterators are plain pointers, they are invalidated whenever the vector reallocates
+*/
+template<typename T, typename Allocator = HeapAllocator>
+class Vector
+{
+public:
+	using ValueType = T;
+	using Iterator = T*;
+	using ConstIterator = const T*;
+
+	static constexpr float DefaultGrowthFactor = 2.0f;
+	// First allocation of a growing vector, so a few pushes do not reallocate every time
+	static constexpr size_t MinGrowthCapacity = 4;
+
+	Vector() = default;
+	explicit Vector(const Allocator& allocator) : m_Allocator(allocator) {}
+
+	explicit Vector(size_t count, const Allocator& allocator = Allocator())
+		: m_Allocator(allocator)
+	{
+		Resize(count);
+	}
+
+	Vector(size_t count, const T& value, const Allocator& allocator = Allocator())
+		: m_Allocator(allocator)
+	{
+		Resize(count, value);
+	}
+
+	Vector(std::initializer_list<T> values, const Allocator& allocator = Allocator())
+		: m_Allocator(allocator)
+	{
+		Reserve(values.size());
+		for (const T& value : values)
+		{
+			PushBackUnchecked(value);
+		}
+	}
+
+	Vector(const Vector& other)
+		: m_Allocator(other.m_Allocator)
+		, m_GrowthFactor(other.m_GrowthFactor)
+	{
+		CopyFrom(other);
+	}
+
+	Vector(Vector&& other) noexcept
+		: m_Allocator(other.m_Allocator)
+		, m_Data(std::exchange(other.m_Data, nullptr))
+		, m_Size(std::exchange(other.m_Size, 0))
+		, m_Capacity(std::exchange(other.m_Capacity, 0))
+		, m_GrowthFactor(other.m_GrowthFactor)
+	{
+	}
+
+	~Vector()
+	{
+		Clear();
+		Deallocate();
+	}
+
+	// Like the copy constructor the allocator and growth factor are copied, the storage is kept when the allocators are equal
+	Vector& operator=(const Vector& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			if (!(m_Allocator == other.m_Allocator))
+			{
+				Deallocate();
+				m_Allocator = other.m_Allocator;
+			}
+			m_GrowthFactor = other.m_GrowthFactor;
+			CopyFrom(other);
+		}
+		return *this;
+	}
+
+	// The allocator and growth factor move along with the storage
+	Vector& operator=(Vector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			Deallocate();
+			m_Allocator = other.m_Allocator;
+			m_Data = std::exchange(other.m_Data, nullptr);
+			m_Size = std::exchange(other.m_Size, 0);
+			m_Capacity = std::exchange(other.m_Capacity, 0);
+			m_GrowthFactor = other.m_GrowthFactor;
+		}
+		return *this;
+	}
+
+	[[nodiscard]] size_t GetSize() const { return m_Size; }
+	[[nodiscard]] size_t GetCapacity() const { return m_Capacity; }
+	[[nodiscard]] bool IsEmpty() const { return m_Size == 0; }
+	[[nodiscard]] T* GetData() { return m_Data; }
+	[[nodiscard]] const T* GetData() const { return m_Data; }
+	[[nodiscard]] const Allocator& GetAllocator() const { return m_Allocator; }
+
+	// Capacity is multiplied by this factor when the vector runs out of room, it must be greater than 1
+	[[nodiscard]] float GetGrowthFactor() const { return m_GrowthFactor; }
+	void SetGrowthFactor(float growthFactor)
+	{
+		NIH_ASSERT(growthFactor > 1.0f);
+		m_GrowthFactor = growthFactor;
+	}
+
+	[[nodiscard]] T& At(size_t pos)
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] const T& At(size_t pos) const
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] T& operator[](size_t pos)
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] const T& operator[](size_t pos) const
+	{
+		NIH_ASSERT(pos < m_Size);
+		return m_Data[pos];
+	}
+	[[nodiscard]] T& Front() { return At(0); }
+	[[nodiscard]] const T& Front() const { return At(0); }
+	[[nodiscard]] T& Back() { return At(m_Size - 1); }
+	[[nodiscard]] const T& Back() const { return At(m_Size - 1); }
+
+	// Lower case so range based for loops and the standard algorithms work
+	[[nodiscard]] Iterator begin() { return m_Data; }
+	[[nodiscard]] Iterator end() { return m_Data + m_Size; }
+	[[nodiscard]] ConstIterator begin() const { return m_Data; }
+	[[nodiscard]] ConstIterator end() const { return m_Data + m_Size; }
+
+	// Make room for at least capacity elements, a good hint saves every reallocation of a push loop
+	void Reserve(size_t capacity)
+	{
+		if (capacity > m_Capacity)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	void Resize(size_t size)
+	{
+		Reserve(size);
+		for (size_t i = m_Size; i < size; ++i)
+		{
+			new (m_Data + i) T();
+		}
+		DestroyRange(std::min(size, m_Size), m_Size);
+		m_Size = size;
+	}
+
+	void Resize(size_t size, const T& value)
+	{
+		Reserve(size);
+		for (size_t i = m_Size; i < size; ++i)
+		{
+			new (m_Data + i) T(value);
+		}
+		DestroyRange(std::min(size, m_Size), m_Size);
+		m_Size = size;
+	}
+
+	// Replace the content by count copies of value
+	void Assign(size_t count, const T& value)
+	{
+		Clear();
+		Resize(count, value);
+	}
+
+	void Clear()
+	{
+		DestroyRange(0, m_Size);
+		m_Size = 0;
+	}
+
+	void PushBack(const T& value) { EmplaceBack(value); }
+	void PushBack(T&& value) { EmplaceBack(std::move(value)); }
+
+	template<typename... Args>
+	T& EmplaceBack(Args&&... args)
+	{
+		if (m_Size == m_Capacity)
+		{
+			// the arguments can point inside the vector, build the element before the old storage goes away
+			T value(std::forward<Args>(args)...);
+			Reallocate(GetGrowCapacity(m_Size + 1));
+			return *new (m_Data + m_Size++) T(std::move(value));
+		}
+		return *new (m_Data + m_Size++) T(std::forward<Args>(args)...);
+	}
+
+	// The capacity must already be there, e.g. after a Reserve, no check is done in release
+	void PushBackUnchecked(const T& value)
+	{
+		NIH_ASSERT(m_Size < m_Capacity);
+		new (m_Data + m_Size++) T(value);
+	}
+	void PushBackUnchecked(T&& value)
+	{
+		NIH_ASSERT(m_Size < m_Capacity);
+		new (m_Data + m_Size++) T(std::move(value));
+	}
+
+	void PopBack()
+	{
+		NIH_ASSERT(m_Size > 0);
+		m_Data[--m_Size].~T();
+	}
+
+	// Remove [first, last) and shift the rest down, returns the element that took the place of first
+	Iterator Erase(ConstIterator first, ConstIterator last)
+	{
+		T* const begin = m_Data + (first - m_Data);
+		T* const end = m_Data + (last - m_Data);
+		T* const newEnd = std::move(end, m_Data + m_Size, begin);
+		DestroyRange(static_cast<size_t>(newEnd - m_Data), m_Size);
+		m_Size = static_cast<size_t>(newEnd - m_Data);
+		return begin;
+	}
+
+	Iterator Erase(ConstIterator position) { return Erase(position, position + 1); }
+
+	[[nodiscard]] bool operator==(const Vector& other) const
+	{
+		return m_Size == other.m_Size && std::equal(begin(), end(), other.begin());
+	}
+
+private:
+	size_t GetGrowCapacity(size_t requiredCapacity) const
+	{
+		const size_t grownCapacity = static_cast<size_t>(static_cast<float>(m_Capacity) * m_GrowthFactor);
+		return std::max({ requiredCapacity, grownCapacity, MinGrowthCapacity });
+	}
+
+	void Reallocate(size_t capacity)
+	{
+		T* data = static_cast<T*>(m_Allocator.Allocate(capacity * sizeof(T), alignof(T)));
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (m_Size > 0)
+			{
+				std::memcpy(static_cast<void*>(data), static_cast<const void*>(m_Data), m_Size * sizeof(T));
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < m_Size; ++i)
+			{
+				new (data + i) T(std::move(m_Data[i]));
+				m_Data[i].~T();
+			}
+		}
+
+		Deallocate();
+		m_Data = data;
+		m_Capacity = capacity;
+	}
+
+	void Deallocate()
+	{
+		if (m_Data != nullptr)
+		{
+			m_Allocator.Free(m_Data, m_Capacity * sizeof(T), alignof(T));
+			m_Data = nullptr;
+			m_Capacity = 0;
+		}
+	}
+
+	void DestroyRange(size_t first, size_t last)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_t i = first; i < last; ++i)
+			{
+				m_Data[i].~T();
+			}
+		}
+	}
+
+	void CopyFrom(const Vector& other)
+	{
+		Reserve(other.m_Size);
+		for (const T& value : other)
+		{
+			PushBackUnchecked(value);
+		}
+	}
+
+	[[no_unique_address]] Allocator m_Allocator{};
+	T* m_Data{nullptr};
+	size_t m_Size{0};
+	size_t m_Capacity{0};
+	float m_GrowthFactor{DefaultGrowthFactor};
+};
+
+// Vector allocating from a memory resource, e.g. FrameArena::GetResource() for per frame scratch data
 template<typename T>
-using Vector = std::vector<T>;
\ No newline at end of file
+using PmrVector = Vector<T, ResourceAllocator>;
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cmath>
+
+#include "Core/Math/Mat4.h"
+#include "Core/Math/Vec3.h"
+
+// Axis aligned bounding box, m_Min <= m_Max on every axis
+struct Aabb
+{
+	[[nodiscard]] static constexpr Aabb FromCenterExtents(const Vec3& center, const Vec3& extents) { return Aabb{ center - extents, center + extents }; }
+
+	[[nodiscard]] constexpr Vec3 GetCenter() const { return (m_Min + m_Max) * 0.5f; }
+	// Half size on every axis
+	[[nodiscard]] constexpr Vec3 GetExtents() const { return (m_Max - m_Min) * 0.5f; }
+
+	[[nodiscard]] constexpr bool Contains(const Vec3& point) const
+	{
+		return point.m_X >= m_Min.m_X && point.m_X <= m_Max.m_X && point.m_Y >= m_Min.m_Y && point.m_Y <= m_Max.m_Y && point.m_Z >= m_Min.m_Z && point.m_Z <= m_Max.m_Z;
+	}
+
+	[[nodiscard]] constexpr bool operator==(const Aabb& other) const = default;
+
+	Vec3 m_Min;
+	Vec3 m_Max;
+};
+
+/*
+* Smallest box holding the transformed box, without transforming its 8 corners (Arvo):
+* the center goes through the matrix, the extents through the absolute value of its 3x3 part
+*/
+[[nodiscard]] inline Aabb Transform(const Aabb& box, const Mat4& matrix)
+{
+	const Vec3 center = matrix.TransformPoint(box.GetCenter());
+	const Vec3 extents = box.GetExtents();
+	const Vec4* rows = matrix.m_Rows;
+	const Vec3 worldExtents(
+		std::fabs(rows[0].m_X) * extents.m_X + std::fabs(rows[1].m_X) * extents.m_Y + std::fabs(rows[2].m_X) * extents.m_Z,
+		std::fabs(rows[0].m_Y) * extents.m_X + std::fabs(rows[1].m_Y) * extents.m_Y + std::fabs(rows[2].m_Y) * extents.m_Z,
+		std::fabs(rows[0].m_Z) * extents.m_X + std::fabs(rows[1].m_Z) * extents.m_Y + std::fabs(rows[2].m_Z) * extents.m_Z);
+	return Aabb::FromCenterExtents(center, worldExtents);
+}
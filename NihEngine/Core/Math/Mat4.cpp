@@ -0,0 +1,90 @@
+#include "Core/Math/Mat4.h"
+
+#include <cmath>
+
+Mat4 Mat4::CreateLookAt(const Vec3& eye, const Vec3& target, const Vec3& up)
+{
+	// right handed: the camera looks down its -Z axis
+	const Vec3 zAxis = Normalize(eye - target);
+	const Vec3 xAxis = Normalize(Cross(up, zAxis));
+	const Vec3 yAxis = Cross(zAxis, xAxis);
+	return Mat4(
+		Vec4(xAxis.m_X, yAxis.m_X, zAxis.m_X, 0.0f),
+		Vec4(xAxis.m_Y, yAxis.m_Y, zAxis.m_Y, 0.0f),
+		Vec4(xAxis.m_Z, yAxis.m_Z, zAxis.m_Z, 0.0f),
+		Vec4(-Dot(xAxis, eye), -Dot(yAxis, eye), -Dot(zAxis, eye), 1.0f));
+}
+
+Mat4 Mat4::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlane, float farPlane)
+{
+	const float height = 1.0f / std::tan(fieldOfView * 0.5f);
+	const float width = height / aspectRatio;
+	const float range = farPlane / (nearPlane - farPlane);
+	return Mat4(
+		Vec4(width, 0.0f, 0.0f, 0.0f),
+		Vec4(0.0f, height, 0.0f, 0.0f),
+		Vec4(0.0f, 0.0f, range, -1.0f),
+		Vec4(0.0f, 0.0f, range * nearPlane, 0.0f));
+}
+
+Mat4 Transpose(const Mat4& matrix)
+{
+	const Vec4* rows = matrix.m_Rows;
+	return Mat4(
+		Vec4(rows[0].m_X, rows[1].m_X, rows[2].m_X, rows[3].m_X),
+		Vec4(rows[0].m_Y, rows[1].m_Y, rows[2].m_Y, rows[3].m_Y),
+		Vec4(rows[0].m_Z, rows[1].m_Z, rows[2].m_Z, rows[3].m_Z),
+		Vec4(rows[0].m_W, rows[1].m_W, rows[2].m_W, rows[3].m_W));
+}
+
+Mat4 Inverse(const Mat4& matrix)
+{
+	float m[16];
+	for (int row = 0; row < 4; ++row)
+	{
+		m[row * 4 + 0] = matrix.m_Rows[row].m_X;
+		m[row * 4 + 1] = matrix.m_Rows[row].m_Y;
+		m[row * 4 + 2] = matrix.m_Rows[row].m_Z;
+		m[row * 4 + 3] = matrix.m_Rows[row].m_W;
+	}
+
+	// 2x2 sub determinants of the two upper rows and of the two lower rows
+	const float s0 = m[0] * m[5] - m[4] * m[1];
+	const float s1 = m[0] * m[6] - m[4] * m[2];
+	const float s2 = m[0] * m[7] - m[4] * m[3];
+	const float s3 = m[1] * m[6] - m[5] * m[2];
+	const float s4 = m[1] * m[7] - m[5] * m[3];
+	const float s5 = m[2] * m[7] - m[6] * m[3];
+
+	const float c5 = m[10] * m[15] - m[14] * m[11];
+	const float c4 = m[9] * m[15] - m[13] * m[11];
+	const float c3 = m[9] * m[14] - m[13] * m[10];
+	const float c2 = m[8] * m[15] - m[12] * m[11];
+	const float c1 = m[8] * m[14] - m[12] * m[10];
+	const float c0 = m[8] * m[13] - m[12] * m[9];
+
+	const float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (std::fabs(determinant) < 1e-12f)
+	{
+		return Mat4::Identity();
+	}
+	const float invert = 1.0f / determinant;
+
+	return Mat4(
+		Vec4((m[5] * c5 - m[6] * c4 + m[7] * c3) * invert,
+			(-m[1] * c5 + m[2] * c4 - m[3] * c3) * invert,
+			(m[13] * s5 - m[14] * s4 + m[15] * s3) * invert,
+			(-m[9] * s5 + m[10] * s4 - m[11] * s3) * invert),
+		Vec4((-m[4] * c5 + m[6] * c2 - m[7] * c1) * invert,
+			(m[0] * c5 - m[2] * c2 + m[3] * c1) * invert,
+			(-m[12] * s5 + m[14] * s2 - m[15] * s1) * invert,
+			(m[8] * s5 - m[10] * s2 + m[11] * s1) * invert),
+		Vec4((m[4] * c4 - m[5] * c2 + m[7] * c0) * invert,
+			(-m[0] * c4 + m[1] * c2 - m[3] * c0) * invert,
+			(m[12] * s4 - m[13] * s2 + m[15] * s0) * invert,
+			(-m[8] * s4 + m[9] * s2 - m[11] * s0) * invert),
+		Vec4((-m[4] * c3 + m[5] * c1 - m[6] * c0) * invert,
+			(m[0] * c3 - m[1] * c1 + m[2] * c0) * invert,
+			(-m[12] * s3 + m[13] * s1 - m[14] * s0) * invert,
+			(m[8] * s3 - m[9] * s1 + m[10] * s0) * invert));
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Core/Math/Quat.h"
+#include "Core/Math/Simd.h"
+#include "Core/Math/Vec3.h"
+#include "Core/Math/Vec4.h"
+
+/*
+* 4x4 matrix with the conventions of DirectXMath / SimpleMath so both convert by copying the 16 floats:
+* row major storage, row vectors (p' = p * M) and the translation in the last row
+* a * b applies a first, then b. The Create functions build right handed matrices like SimpleMath's
+*/
+struct alignas(16) Mat4
+{
+	constexpr Mat4() = default;
+	constexpr Mat4(const Vec4& row0, const Vec4& row1, const Vec4& row2, const Vec4& row3) : m_Rows{ row0, row1, row2, row3 } {}
+
+	[[nodiscard]] static constexpr Mat4 Identity() { return Mat4(); }
+
+	[[nodiscard]] static constexpr Mat4 CreateTranslation(const Vec3& translation)
+	{
+		return Mat4(Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 1.0f, 0.0f), Vec4(translation, 1.0f));
+	}
+
+	[[nodiscard]] static constexpr Mat4 CreateScale(const Vec3& scale)
+	{
+		return Mat4(Vec4(scale.m_X, 0.0f, 0.0f, 0.0f), Vec4(0.0f, scale.m_Y, 0.0f, 0.0f), Vec4(0.0f, 0.0f, scale.m_Z, 0.0f), Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+	}
+
+	[[nodiscard]] static constexpr Mat4 CreateFromQuaternion(const Quat& rotation)
+	{
+		const float x = rotation.m_X, y = rotation.m_Y, z = rotation.m_Z, w = rotation.m_W;
+		return Mat4(
+			Vec4(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w), 0.0f),
+			Vec4(2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w), 0.0f),
+			Vec4(2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y), 0.0f),
+			Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+	}
+
+	// Scale, then rotation, then translation, the usual local to parent transform
+	[[nodiscard]] static constexpr Mat4 CreateAffine(const Vec3& scale, const Quat& rotation, const Vec3& translation)
+	{
+		Mat4 matrix = CreateFromQuaternion(rotation);
+		matrix.m_Rows[0] = Vec4(matrix.m_Rows[0].m_X * scale.m_X, matrix.m_Rows[0].m_Y * scale.m_X, matrix.m_Rows[0].m_Z * scale.m_X, 0.0f);
+		matrix.m_Rows[1] = Vec4(matrix.m_Rows[1].m_X * scale.m_Y, matrix.m_Rows[1].m_Y * scale.m_Y, matrix.m_Rows[1].m_Z * scale.m_Y, 0.0f);
+		matrix.m_Rows[2] = Vec4(matrix.m_Rows[2].m_X * scale.m_Z, matrix.m_Rows[2].m_Y * scale.m_Z, matrix.m_Rows[2].m_Z * scale.m_Z, 0.0f);
+		matrix.m_Rows[3] = Vec4(translation, 1.0f);
+		return matrix;
+	}
+
+	// View matrix of a camera at eye looking at target, right handed (XMMatrixLookAtRH)
+	[[nodiscard]] static Mat4 CreateLookAt(const Vec3& eye, const Vec3& target, const Vec3& up);
+
+	// Vertical field of view in radians, right handed with depth in [0, 1] (XMMatrixPerspectiveFovRH)
+	[[nodiscard]] static Mat4 CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlane, float farPlane);
+
+	[[nodiscard]] Mat4 operator*(const Mat4& other) const
+	{
+		Mat4 result;
+		const Simd::Float4 otherRows[4] = { other.m_Rows[0].ToSimd(), other.m_Rows[1].ToSimd(), other.m_Rows[2].ToSimd(), other.m_Rows[3].ToSimd() };
+		for (int i = 0; i < 4; ++i)
+		{
+			result.m_Rows[i] = Vec4::FromSimd(TransformRow(m_Rows[i].ToSimd(), otherRows));
+		}
+		return result;
+	}
+
+	Mat4& operator*=(const Mat4& other) { return *this = *this * other; }
+
+	[[nodiscard]] Vec4 Transform(const Vec4& vector) const
+	{
+		const Simd::Float4 rows[4] = { m_Rows[0].ToSimd(), m_Rows[1].ToSimd(), m_Rows[2].ToSimd(), m_Rows[3].ToSimd() };
+		return Vec4::FromSimd(TransformRow(vector.ToSimd(), rows));
+	}
+
+	// Point with w = 1, the last column is ignored (affine matrices)
+	[[nodiscard]] Vec3 TransformPoint(const Vec3& point) const { return Transform(Vec4(point, 1.0f)).GetXYZ(); }
+	// Direction with w = 0, the translation does not apply
+	[[nodiscard]] Vec3 TransformVector(const Vec3& vector) const { return Transform(Vec4(vector, 0.0f)).GetXYZ(); }
+
+	[[nodiscard]] constexpr Vec3 GetTranslation() const { return m_Rows[3].GetXYZ(); }
+
+	[[nodiscard]] constexpr bool operator==(const Mat4& other) const = default;
+
+	Vec4 m_Rows[4]{ Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 1.0f, 0.0f), Vec4(0.0f, 0.0f, 0.0f, 1.0f) };
+
+private:
+	// row * matrix, as the sum of the matrix rows weighted by the lanes of row
+	static Simd::Float4 TransformRow(Simd::Float4 row, const Simd::Float4 rows[4])
+	{
+		Simd::Float4 result = Simd::Mul(Simd::SplatLane<0>(row), rows[0]);
+		result = Simd::MulAdd(Simd::SplatLane<1>(row), rows[1], result);
+		result = Simd::MulAdd(Simd::SplatLane<2>(row), rows[2], result);
+		return Simd::MulAdd(Simd::SplatLane<3>(row), rows[3], result);
+	}
+};
+
+[[nodiscard]] Mat4 Transpose(const Mat4& matrix);
+
+// General inverse by cofactors, returns the identity when the matrix is singular
+[[nodiscard]] Mat4 Inverse(const Mat4& matrix);
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Core/Math/Mat4.h"
+#include "Core/Math/Quat.h"
+#include "Core/Math/Vec3.h"
+#include "Core/Math/Vec3Packet.h"
+#include "Core/Math/Vec4.h"
+
+namespace Math
+{
+	inline constexpr float Pi = 3.14159265358979323846f;
+
+	[[nodiscard]] constexpr float ToRadians(float degrees) { return degrees * (Pi / 180.0f); }
+	[[nodiscard]] constexpr float ToDegrees(float radians) { return radians * (180.0f / Pi); }
+}
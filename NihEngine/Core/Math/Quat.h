@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cmath>
+
+#include "Core/Math/Vec3.h"
+#include "Core/Math/Vec4.h"
+
+/*
+* Unit quaternion for rotations, x y z is the vector part and w the scalar part (same layout as SimpleMath)
+* a * b rotates by a first, then by b, like Mat4 and SimpleMath's Quaternion: it is the Hamilton product b a
+*/
+struct alignas(16) Quat
+{
+	constexpr Quat() = default;
+	constexpr Quat(float x, float y, float z, float w) : m_X(x), m_Y(y), m_Z(z), m_W(w) {}
+
+	[[nodiscard]] static constexpr Quat Identity() { return Quat(); }
+
+	// Angle in radians, counter clockwise when looking down the axis, which must be normalized
+	[[nodiscard]] static Quat CreateFromAxisAngle(const Vec3& axis, float angle)
+	{
+		const float halfAngle = angle * 0.5f;
+		const float sine = std::sin(halfAngle);
+		return Quat(axis.m_X * sine, axis.m_Y * sine, axis.m_Z * sine, std::cos(halfAngle));
+	}
+
+	[[nodiscard]] Vec4 ToVec4() const { return Vec4(m_X, m_Y, m_Z, m_W); }
+	[[nodiscard]] static Quat FromVec4(const Vec4& vector) { return Quat(vector.m_X, vector.m_Y, vector.m_Z, vector.m_W); }
+
+	[[nodiscard]] constexpr Quat operator*(const Quat& other) const
+	{
+		return Quat(
+			other.m_W * m_X + other.m_X * m_W + other.m_Y * m_Z - other.m_Z * m_Y,
+			other.m_W * m_Y - other.m_X * m_Z + other.m_Y * m_W + other.m_Z * m_X,
+			other.m_W * m_Z + other.m_X * m_Y - other.m_Y * m_X + other.m_Z * m_W,
+			other.m_W * m_W - other.m_X * m_X - other.m_Y * m_Y - other.m_Z * m_Z);
+	}
+
+	[[nodiscard]] constexpr bool operator==(const Quat& other) const = default;
+
+	float m_X{0.0f};
+	float m_Y{0.0f};
+	float m_Z{0.0f};
+	float m_W{1.0f};
+};
+
+// Inverse of a unit quaternion
+[[nodiscard]] constexpr Quat Conjugate(const Quat& rotation) { return Quat(-rotation.m_X, -rotation.m_Y, -rotation.m_Z, rotation.m_W); }
+
+[[nodiscard]] inline float Dot(const Quat& a, const Quat& b) { return Dot(a.ToVec4(), b.ToVec4()); }
+
+[[nodiscard]] inline Quat Normalize(const Quat& rotation)
+{
+	const float length = Length(rotation.ToVec4());
+	return length > 0.0f ? Quat::FromVec4(rotation.ToVec4() * (1.0f / length)) : Quat::Identity();
+}
+
+// v' = q v q*, expanded as v + 2w (u x v) + 2 u x (u x v) with u the vector part
+[[nodiscard]] constexpr Vec3 Rotate(const Quat& rotation, const Vec3& vector)
+{
+	const Vec3 axis(rotation.m_X, rotation.m_Y, rotation.m_Z);
+	const Vec3 twiceCross = Cross(axis, vector) * 2.0f;
+	return vector + twiceCross * rotation.m_W + Cross(axis, twiceCross);
+}
+
+// Shortest path spherical interpolation, falls back to a normalized lerp when the rotations are very close
+[[nodiscard]] inline Quat Slerp(const Quat& a, const Quat& b, float t)
+{
+	float cosine = Dot(a, b);
+	Quat target = b;
+	if (cosine < 0.0f)
+	{
+		cosine = -cosine;
+		target = Quat(-b.m_X, -b.m_Y, -b.m_Z, -b.m_W);
+	}
+
+	if (cosine > 0.9995f)
+	{
+		return Normalize(Quat::FromVec4(Lerp(a.ToVec4(), target.ToVec4(), t)));
+	}
+
+	const float angle = std::acos(cosine);
+	const float sine = std::sin(angle);
+	const float weightA = std::sin((1.0f - t) * angle) / sine;
+	const float weightB = std::sin(t * angle) / sine;
+	return Quat::FromVec4(a.ToVec4() * weightA + target.ToVec4() * weightB);
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cmath>
+
+#include "Config.h"
+
+#if defined(NIH_MATH_SSE)
+#include <immintrin.h>
+#elif defined(NIH_MATH_NEON)
+#include <arm_neon.h>
+#endif
+
+/*
+* Thin layer over the vector registers of the target, the math types are written against it only
+* Float4 is an SSE or NEON register, or four floats with the portable backend
+* Float8 is an AVX register when the build enables AVX, two Float4 otherwise
+* Every function is a single instruction or close to it, loads and stores do not need any alignment
+*/
+namespace Simd
+{
+#if defined(NIH_MATH_SSE)
+	using Float4 = __m128;
+
+	inline Float4 Load(const float* values) { return _mm_loadu_ps(values); }
+	inline void Store(float* values, Float4 value) { _mm_storeu_ps(values, value); }
+	inline Float4 Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+	inline Float4 Splat(float value) { return _mm_set1_ps(value); }
+	inline Float4 Zero() { return _mm_setzero_ps(); }
+
+	inline Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+	inline Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+	inline Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+	inline Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+	// a * b + c, fused when the target has FMA
+	inline Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+	{
+#if defined(__FMA__)
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+	inline Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+	inline Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+	inline Float4 Sqrt(Float4 a) { return _mm_sqrt_ps(a); }
+
+	template<int Lane>
+	inline Float4 SplatLane(Float4 value) { return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+	inline float GetX(Float4 value) { return _mm_cvtss_f32(value); }
+
+	// Sum of the four lanes
+	inline float HorizontalAdd(Float4 value)
+	{
+		const Float4 pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+		return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+	}
+#elif defined(NIH_MATH_NEON)
+	using Float4 = float32x4_t;
+
+	inline Float4 Load(const float* values) { return vld1q_f32(values); }
+	inline void Store(float* values, Float4 value) { vst1q_f32(values, value); }
+	inline Float4 Set(float x, float y, float z, float w)
+	{
+		const float values[4] = { x, y, z, w };
+		return vld1q_f32(values);
+	}
+	inline Float4 Splat(float value) { return vdupq_n_f32(value); }
+	inline Float4 Zero() { return vdupq_n_f32(0.0f); }
+
+	inline Float4 Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+	inline Float4 Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+	inline Float4 Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+	inline Float4 Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+	inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return vfmaq_f32(c, a, b); }
+	inline Float4 Min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+	inline Float4 Max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+	inline Float4 Sqrt(Float4 a) { return vsqrtq_f32(a); }
+
+	template<int Lane>
+	inline Float4 SplatLane(Float4 value) { return vdupq_laneq_f32(value, Lane); }
+	inline float GetX(Float4 value) { return vgetq_lane_f32(value, 0); }
+	inline float HorizontalAdd(Float4 value) { return vaddvq_f32(value); }
+#else
+	struct Float4
+	{
+		float m_Values[4];
+	};
+
+	inline Float4 Load(const float* values) { return { { values[0], values[1], values[2], values[3] } }; }
+	inline void Store(float* values, Float4 value)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			values[i] = value.m_Values[i];
+		}
+	}
+	inline Float4 Set(float x, float y, float z, float w) { return { { x, y, z, w } }; }
+	inline Float4 Splat(float value) { return { { value, value, value, value } }; }
+	inline Float4 Zero() { return Splat(0.0f); }
+
+	template<typename Operation>
+	inline Float4 PerLane(Float4 a, Float4 b, Operation operation)
+	{
+		return { { operation(a.m_Values[0], b.m_Values[0]), operation(a.m_Values[1], b.m_Values[1]), operation(a.m_Values[2], b.m_Values[2]), operation(a.m_Values[3], b.m_Values[3]) } };
+	}
+
+	inline Float4 Add(Float4 a, Float4 b) { return PerLane(a, b, [](float x, float y) { return x + y; }); }
+	inline Float4 Sub(Float4 a, Float4 b) { return PerLane(a, b, [](float x, float y) { return x - y; }); }
+	inline Float4 Mul(Float4 a, Float4 b) { return PerLane(a, b, [](float x, float y) { return x * y; }); }
+	inline Float4 Div(Float4 a, Float4 b) { return PerLane(a, b, [](float x, float y) { return x / y; }); }
+	inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return Add(Mul(a, b), c); }
+	inline Float4 Min(Float4 a, Float4 b) { return PerLane(a, b, [](float x, float y) { return y < x ? y : x; }); }
+	inline Float4 Max(Float4 a, Float4 b) { return PerLane(a, b, [](float x, float y) { return x < y ? y : x; }); }
+	inline Float4 Sqrt(Float4 a) { return PerLane(a, a, [](float x, float) { return std::sqrt(x); }); }
+
+	template<int Lane>
+	inline Float4 SplatLane(Float4 value) { return Splat(value.m_Values[Lane]); }
+	inline float GetX(Float4 value) { return value.m_Values[0]; }
+	inline float HorizontalAdd(Float4 value) { return (value.m_Values[0] + value.m_Values[1]) + (value.m_Values[2] + value.m_Values[3]); }
+#endif
+
+	// Dot product of the four lanes
+	inline float Dot4(Float4 a, Float4 b) { return HorizontalAdd(Mul(a, b)); }
+
+#if defined(NIH_MATH_AVX)
+	using Float8 = __m256;
+
+	inline Float8 Load8(const float* values) { return _mm256_loadu_ps(values); }
+	inline void Store(float* values, Float8 value) { _mm256_storeu_ps(values, value); }
+	inline Float8 Splat8(float value) { return _mm256_set1_ps(value); }
+
+	inline Float8 Add(Float8 a, Float8 b) { return _mm256_add_ps(a, b); }
+	inline Float8 Sub(Float8 a, Float8 b) { return _mm256_sub_ps(a, b); }
+	inline Float8 Mul(Float8 a, Float8 b) { return _mm256_mul_ps(a, b); }
+	inline Float8 Div(Float8 a, Float8 b) { return _mm256_div_ps(a, b); }
+	inline Float8 MulAdd(Float8 a, Float8 b, Float8 c)
+	{
+#if defined(__FMA__)
+		return _mm256_fmadd_ps(a, b, c);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+	}
+	inline Float8 Min(Float8 a, Float8 b) { return _mm256_min_ps(a, b); }
+	inline Float8 Max(Float8 a, Float8 b) { return _mm256_max_ps(a, b); }
+	inline Float8 Sqrt(Float8 a) { return _mm256_sqrt_ps(a); }
+#else
+	struct Float8
+	{
+		Float4 m_Low;
+		Float4 m_High;
+	};
+
+	inline Float8 Load8(const float* values) { return { Load(values), Load(values + 4) }; }
+	inline void Store(float* values, Float8 value)
+	{
+		Store(values, value.m_Low);
+		Store(values + 4, value.m_High);
+	}
+	inline Float8 Splat8(float value) { return { Splat(value), Splat(value) }; }
+
+	inline Float8 Add(Float8 a, Float8 b) { return { Add(a.m_Low, b.m_Low), Add(a.m_High, b.m_High) }; }
+	inline Float8 Sub(Float8 a, Float8 b) { return { Sub(a.m_Low, b.m_Low), Sub(a.m_High, b.m_High) }; }
+	inline Float8 Mul(Float8 a, Float8 b) { return { Mul(a.m_Low, b.m_Low), Mul(a.m_High, b.m_High) }; }
+	inline Float8 Div(Float8 a, Float8 b) { return { Div(a.m_Low, b.m_Low), Div(a.m_High, b.m_High) }; }
+	inline Float8 MulAdd(Float8 a, Float8 b, Float8 c) { return { MulAdd(a.m_Low, b.m_Low, c.m_Low), MulAdd(a.m_High, b.m_High, c.m_High) }; }
+	inline Float8 Min(Float8 a, Float8 b) { return { Min(a.m_Low, b.m_Low), Min(a.m_High, b.m_High) }; }
+	inline Float8 Max(Float8 a, Float8 b) { return { Max(a.m_Low, b.m_Low), Max(a.m_High, b.m_High) }; }
+	inline Float8 Sqrt(Float8 a) { return { Sqrt(a.m_Low), Sqrt(a.m_High) }; }
+#endif
+
+	// Register of a given width, so the packet types can be written once for Float4 and Float8
+	template<int Width>
+	struct FloatN;
+
+	template<>
+	struct FloatN<4>
+	{
+		using Type = Float4;
+		static Float4 Load(const float* values) { return Simd::Load(values); }
+		static Float4 Splat(float value) { return Simd::Splat(value); }
+	};
+
+	template<>
+	struct FloatN<8>
+	{
+		using Type = Float8;
+		static Float8 Load(const float* values) { return Simd::Load8(values); }
+		static Float8 Splat(float value) { return Simd::Splat8(value); }
+	};
+}
@@ -0,0 +1,241 @@
+#include "Core/Math/TransformBatch.h"
+
+#include <atomic>
+#include <cmath>
+
+#include "Core/Math/Vec3Packet.h"
+
+#if defined(NIH_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	struct Kernels
+	{
+		SimdLevel m_Level;
+		void (*m_MultiplyByParent)(const Mat4*, const Mat4&, Mat4*, size_t);
+		void (*m_MultiplyByParents)(const Mat4*, const Mat4*, Mat4*, size_t);
+		void (*m_TransformPoints)(const Mat4&, ConstSoAPoints, SoAPoints, size_t);
+		void (*m_TransformBounds)(const Mat4*, ConstSoABounds, SoABounds, size_t);
+	};
+
+	// The math library types, 4 wide on the baseline SIMD of the target
+	namespace Baseline
+	{
+		void MultiplyByParent(const Mat4* locals, const Mat4& parent, Mat4* worlds, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				worlds[i] = locals[i] * parent;
+			}
+		}
+
+		void MultiplyByParents(const Mat4* locals, const Mat4* parents, Mat4* worlds, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				worlds[i] = locals[i] * parents[i];
+			}
+		}
+
+		void TransformPoints(const Mat4& matrix, ConstSoAPoints points, SoAPoints results, size_t count)
+		{
+			size_t i = 0;
+			for (; i + Vec3x4::Width <= count; i += Vec3x4::Width)
+			{
+				const Vec3x4 packet = Vec3x4::LoadSoA(points.m_X + i, points.m_Y + i, points.m_Z + i);
+				TransformPoints(matrix, packet).StoreSoA(results.m_X + i, results.m_Y + i, results.m_Z + i);
+			}
+			for (; i < count; ++i)
+			{
+				const Vec3 result = matrix.TransformPoint(Vec3(points.m_X[i], points.m_Y[i], points.m_Z[i]));
+				results.m_X[i] = result.m_X;
+				results.m_Y[i] = result.m_Y;
+				results.m_Z[i] = result.m_Z;
+			}
+		}
+
+		void TransformBounds(const Mat4* matrices, ConstSoABounds localBounds, SoABounds worldBounds, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Vec4* rows = matrices[i].m_Rows;
+				const float centerX = localBounds.m_Centers.m_X[i], centerY = localBounds.m_Centers.m_Y[i], centerZ = localBounds.m_Centers.m_Z[i];
+				const float extentX = localBounds.m_Extents.m_X[i], extentY = localBounds.m_Extents.m_Y[i], extentZ = localBounds.m_Extents.m_Z[i];
+
+				worldBounds.m_Centers.m_X[i] = centerX * rows[0].m_X + centerY * rows[1].m_X + centerZ * rows[2].m_X + rows[3].m_X;
+				worldBounds.m_Centers.m_Y[i] = centerX * rows[0].m_Y + centerY * rows[1].m_Y + centerZ * rows[2].m_Y + rows[3].m_Y;
+				worldBounds.m_Centers.m_Z[i] = centerX * rows[0].m_Z + centerY * rows[1].m_Z + centerZ * rows[2].m_Z + rows[3].m_Z;
+
+				worldBounds.m_Extents.m_X[i] = extentX * std::fabs(rows[0].m_X) + extentY * std::fabs(rows[1].m_X) + extentZ * std::fabs(rows[2].m_X);
+				worldBounds.m_Extents.m_Y[i] = extentX * std::fabs(rows[0].m_Y) + extentY * std::fabs(rows[1].m_Y) + extentZ * std::fabs(rows[2].m_Y);
+				worldBounds.m_Extents.m_Z[i] = extentX * std::fabs(rows[0].m_Z) + extentY * std::fabs(rows[1].m_Z) + extentZ * std::fabs(rows[2].m_Z);
+			}
+		}
+
+		constexpr Kernels Table{ TransformBatch::BaselineSimdLevel, MultiplyByParent, MultiplyByParents, TransformPoints, TransformBounds };
+	}
+
+#if defined(NIH_SSE2)
+	namespace Avx2
+	{
+		// Two rows of the left matrix per register, each 128 bits half is multiplied by the same right matrix
+		NIH_TARGET_AVX2 inline __m256 MultiplyRowPair(__m256 rows, const __m256 right[4])
+		{
+			__m256 result = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), right[0]);
+			result = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), right[1], result);
+			result = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), right[2], result);
+			return _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), right[3], result);
+		}
+
+		NIH_TARGET_AVX2 inline void LoadRight(const Mat4& matrix, __m256 right[4])
+		{
+			for (int row = 0; row < 4; ++row)
+			{
+				right[row] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.m_Rows[row]));
+			}
+		}
+
+		NIH_TARGET_AVX2 inline void Multiply(const Mat4& left, const __m256 right[4], Mat4& result)
+		{
+			const float* values = &left.m_Rows[0].m_X;
+			// both halves are loaded before anything is stored, so result can be left
+			const __m256 rows01 = _mm256_loadu_ps(values);
+			const __m256 rows23 = _mm256_loadu_ps(values + 8);
+			float* output = &result.m_Rows[0].m_X;
+			_mm256_storeu_ps(output, MultiplyRowPair(rows01, right));
+			_mm256_storeu_ps(output + 8, MultiplyRowPair(rows23, right));
+		}
+
+		NIH_TARGET_AVX2 void MultiplyByParent(const Mat4* locals, const Mat4& parent, Mat4* worlds, size_t count)
+		{
+			__m256 right[4];
+			LoadRight(parent, right);
+			for (size_t i = 0; i < count; ++i)
+			{
+				Multiply(locals[i], right, worlds[i]);
+			}
+		}
+
+		NIH_TARGET_AVX2 void MultiplyByParents(const Mat4* locals, const Mat4* parents, Mat4* worlds, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				__m256 right[4];
+				LoadRight(parents[i], right);
+				Multiply(locals[i], right, worlds[i]);
+			}
+		}
+
+		NIH_TARGET_AVX2 void TransformPoints(const Mat4& matrix, ConstSoAPoints points, SoAPoints results, size_t count)
+		{
+			const Vec4* rows = matrix.m_Rows;
+			const __m256 m00 = _mm256_set1_ps(rows[0].m_X), m01 = _mm256_set1_ps(rows[0].m_Y), m02 = _mm256_set1_ps(rows[0].m_Z);
+			const __m256 m10 = _mm256_set1_ps(rows[1].m_X), m11 = _mm256_set1_ps(rows[1].m_Y), m12 = _mm256_set1_ps(rows[1].m_Z);
+			const __m256 m20 = _mm256_set1_ps(rows[2].m_X), m21 = _mm256_set1_ps(rows[2].m_Y), m22 = _mm256_set1_ps(rows[2].m_Z);
+			const __m256 m30 = _mm256_set1_ps(rows[3].m_X), m31 = _mm256_set1_ps(rows[3].m_Y), m32 = _mm256_set1_ps(rows[3].m_Z);
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(points.m_X + i);
+				const __m256 y = _mm256_loadu_ps(points.m_Y + i);
+				const __m256 z = _mm256_loadu_ps(points.m_Z + i);
+				_mm256_storeu_ps(results.m_X + i, _mm256_fmadd_ps(z, m20, _mm256_fmadd_ps(y, m10, _mm256_fmadd_ps(x, m00, m30))));
+				_mm256_storeu_ps(results.m_Y + i, _mm256_fmadd_ps(z, m21, _mm256_fmadd_ps(y, m11, _mm256_fmadd_ps(x, m01, m31))));
+				_mm256_storeu_ps(results.m_Z + i, _mm256_fmadd_ps(z, m22, _mm256_fmadd_ps(y, m12, _mm256_fmadd_ps(x, m02, m32))));
+			}
+			Baseline::TransformPoints(matrix, points.Advance(i), results.Advance(i), count - i);
+		}
+
+		/*
+		* 8 objects at a time: the matrices are AoS, each of the 12 elements needed is gathered from 8 matrices
+		* (stride of 16 floats) so the math itself runs on full registers
+		*/
+		NIH_TARGET_AVX2 void TransformBounds(const Mat4* matrices, ConstSoABounds localBounds, SoABounds worldBounds, size_t count)
+		{
+			const __m256i stride = _mm256_setr_epi32(0, 16, 32, 48, 64, 80, 96, 112);
+			const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const float* base = &matrices[i].m_Rows[0].m_X;
+				__m256 m[4][3];
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 3; ++column)
+					{
+						m[row][column] = _mm256_i32gather_ps(base + row * 4 + column, stride, 4);
+					}
+				}
+
+				const __m256 centerX = _mm256_loadu_ps(localBounds.m_Centers.m_X + i);
+				const __m256 centerY = _mm256_loadu_ps(localBounds.m_Centers.m_Y + i);
+				const __m256 centerZ = _mm256_loadu_ps(localBounds.m_Centers.m_Z + i);
+				const __m256 extentX = _mm256_loadu_ps(localBounds.m_Extents.m_X + i);
+				const __m256 extentY = _mm256_loadu_ps(localBounds.m_Extents.m_Y + i);
+				const __m256 extentZ = _mm256_loadu_ps(localBounds.m_Extents.m_Z + i);
+
+				float* centers[3] = { worldBounds.m_Centers.m_X + i, worldBounds.m_Centers.m_Y + i, worldBounds.m_Centers.m_Z + i };
+				float* extents[3] = { worldBounds.m_Extents.m_X + i, worldBounds.m_Extents.m_Y + i, worldBounds.m_Extents.m_Z + i };
+				for (int column = 0; column < 3; ++column)
+				{
+					_mm256_storeu_ps(centers[column], _mm256_fmadd_ps(centerZ, m[2][column], _mm256_fmadd_ps(centerY, m[1][column], _mm256_fmadd_ps(centerX, m[0][column], m[3][column]))));
+
+					const __m256 abs0 = _mm256_andnot_ps(signMask, m[0][column]);
+					const __m256 abs1 = _mm256_andnot_ps(signMask, m[1][column]);
+					const __m256 abs2 = _mm256_andnot_ps(signMask, m[2][column]);
+					_mm256_storeu_ps(extents[column], _mm256_fmadd_ps(extentZ, abs2, _mm256_fmadd_ps(extentY, abs1, _mm256_mul_ps(extentX, abs0))));
+				}
+			}
+			Baseline::TransformBounds(matrices + i, localBounds.Advance(i), worldBounds.Advance(i), count - i);
+		}
+
+		constexpr Kernels Table{ SimdLevel::Avx2, MultiplyByParent, MultiplyByParents, TransformPoints, TransformBounds };
+	}
+#endif
+
+	const Kernels* SelectKernels(SimdLevel level)
+	{
+#if defined(NIH_SSE2)
+		if (level >= SimdLevel::Avx2 && GetSupportedSimdLevel() >= SimdLevel::Avx2)
+		{
+			return &Avx2::Table;
+		}
+#endif
+		return &Baseline::Table;
+	}
+
+	std::atomic<const Kernels*> s_Kernels{nullptr};
+
+	const Kernels& GetKernels()
+	{
+		const Kernels* kernels = s_Kernels.load(std::memory_order_acquire);
+		if (kernels == nullptr)
+		{
+			kernels = SelectKernels(GetSupportedSimdLevel());
+			s_Kernels.store(kernels, std::memory_order_release);
+		}
+		return *kernels;
+	}
+}
+
+namespace TransformBatch
+{
+	void MultiplyMatrices(const Mat4* locals, const Mat4& parent, Mat4* worlds, size_t count) { GetKernels().m_MultiplyByParent(locals, parent, worlds, count); }
+	void MultiplyMatrices(const Mat4* locals, const Mat4* parents, Mat4* worlds, size_t count) { GetKernels().m_MultiplyByParents(locals, parents, worlds, count); }
+	void TransformPoints(const Mat4& matrix, ConstSoAPoints points, SoAPoints results, size_t count) { GetKernels().m_TransformPoints(matrix, points, results, count); }
+	void TransformBounds(const Mat4* matrices, ConstSoABounds localBounds, SoABounds worldBounds, size_t count) { GetKernels().m_TransformBounds(matrices, localBounds, worldBounds, count); }
+
+	SimdLevel GetSimdLevel()
+	{
+		return GetKernels().m_Level;
+	}
+
+	void SetSimdLevel(SimdLevel level)
+	{
+		s_Kernels.store(SelectKernels(level), std::memory_order_release);
+	}
+}
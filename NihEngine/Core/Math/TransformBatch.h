@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Core/Math/Mat4.h"
+#include "System/CpuFeatures.h"
+
+// Points stored as three component arrays
+struct SoAPoints
+{
+	[[nodiscard]] SoAPoints Advance(size_t count) const { return { m_X + count, m_Y + count, m_Z + count }; }
+
+	float* m_X{nullptr};
+	float* m_Y{nullptr};
+	float* m_Z{nullptr};
+};
+
+struct ConstSoAPoints
+{
+	ConstSoAPoints() = default;
+	ConstSoAPoints(const float* x, const float* y, const float* z) : m_X(x), m_Y(y), m_Z(z) {}
+	ConstSoAPoints(const SoAPoints& points) : m_X(points.m_X), m_Y(points.m_Y), m_Z(points.m_Z) {}
+
+	[[nodiscard]] ConstSoAPoints Advance(size_t count) const { return { m_X + count, m_Y + count, m_Z + count }; }
+
+	const float* m_X{nullptr};
+	const float* m_Y{nullptr};
+	const float* m_Z{nullptr};
+};
+
+// Boxes stored as center and extents (half sizes) component arrays, the form the transform needs
+struct SoABounds
+{
+	[[nodiscard]] SoABounds Advance(size_t count) const { return { m_Centers.Advance(count), m_Extents.Advance(count) }; }
+
+	SoAPoints m_Centers;
+	SoAPoints m_Extents;
+};
+
+struct ConstSoABounds
+{
+	ConstSoABounds() = default;
+	ConstSoABounds(const ConstSoAPoints& centers, const ConstSoAPoints& extents) : m_Centers(centers), m_Extents(extents) {}
+	ConstSoABounds(const SoABounds& bounds) : m_Centers(bounds.m_Centers), m_Extents(bounds.m_Extents) {}
+
+	[[nodiscard]] ConstSoABounds Advance(size_t count) const { return { m_Centers.Advance(count), m_Extents.Advance(count) }; }
+
+	ConstSoAPoints m_Centers;
+	ConstSoAPoints m_Extents;
+};
+
+/*
+* Transform kernels over many objects per call
+* They run as 8 wide AVX2 code when the CPU has it and on the baseline SIMD of the math library otherwise,
+* the level is picked on first use like ArrayOps. Every kernel only touches [0, count) of its arrays,
+* so a range of objects can be handed to each job of a ParallelFor (see Tasks/ParallelTransforms.h)
+* Inputs and outputs must not overlap, except worlds and locals which may be the same array
+*/
+namespace TransformBatch
+{
+	// worlds[i] = locals[i] * parent, local first then parent
+	void MultiplyMatrices(const Mat4* locals, const Mat4& parent, Mat4* worlds, size_t count);
+
+	// worlds[i] = locals[i] * parents[i]
+	void MultiplyMatrices(const Mat4* locals, const Mat4* parents, Mat4* worlds, size_t count);
+
+	// Every point with w = 1 through the affine part of matrix
+	void TransformPoints(const Mat4& matrix, ConstSoAPoints points, SoAPoints results, size_t count);
+
+	// World box of every object from its local box and its world matrix
+	void TransformBounds(const Mat4* matrices, ConstSoABounds localBounds, SoABounds worldBounds, size_t count);
+
+	// Level of the baseline kernels, the one the math library is compiled for (see NIH_MATH_* in Config.h)
+#if defined(NIH_MATH_SSE)
+	inline constexpr SimdLevel BaselineSimdLevel = SimdLevel::Sse2;
+#elif defined(NIH_MATH_NEON)
+	inline constexpr SimdLevel BaselineSimdLevel = SimdLevel::Neon;
+#else
+	inline constexpr SimdLevel BaselineSimdLevel = SimdLevel::Scalar;
+#endif
+
+	[[nodiscard]] SimdLevel GetSimdLevel();
+	// Forces the baseline kernels (any level below Avx2), for tests and benchmarks
+	void SetSimdLevel(SimdLevel level);
+}
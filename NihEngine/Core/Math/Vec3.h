@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cmath>
+
+/*
+* 3 floats, for positions, directions and scales
+* Kept scalar on purpose: 12 bytes do not fill a register and the loads would cost more than the math,
+* use Vec3x4 / Vec3x8 to work on many vectors at once
+*/
+struct Vec3
+{
+	constexpr Vec3() = default;
+	constexpr Vec3(float x, float y, float z) : m_X(x), m_Y(y), m_Z(z) {}
+	constexpr explicit Vec3(float value) : m_X(value), m_Y(value), m_Z(value) {}
+
+	[[nodiscard]] static constexpr Vec3 Zero() { return Vec3(0.0f); }
+	[[nodiscard]] static constexpr Vec3 One() { return Vec3(1.0f); }
+	[[nodiscard]] static constexpr Vec3 UnitX() { return Vec3(1.0f, 0.0f, 0.0f); }
+	[[nodiscard]] static constexpr Vec3 UnitY() { return Vec3(0.0f, 1.0f, 0.0f); }
+	[[nodiscard]] static constexpr Vec3 UnitZ() { return Vec3(0.0f, 0.0f, 1.0f); }
+
+	[[nodiscard]] constexpr Vec3 operator-() const { return Vec3(-m_X, -m_Y, -m_Z); }
+	[[nodiscard]] constexpr Vec3 operator+(const Vec3& other) const { return Vec3(m_X + other.m_X, m_Y + other.m_Y, m_Z + other.m_Z); }
+	[[nodiscard]] constexpr Vec3 operator-(const Vec3& other) const { return Vec3(m_X - other.m_X, m_Y - other.m_Y, m_Z - other.m_Z); }
+	[[nodiscard]] constexpr Vec3 operator*(const Vec3& other) const { return Vec3(m_X * other.m_X, m_Y * other.m_Y, m_Z * other.m_Z); }
+	[[nodiscard]] constexpr Vec3 operator*(float scale) const { return Vec3(m_X * scale, m_Y * scale, m_Z * scale); }
+	[[nodiscard]] constexpr Vec3 operator/(float scale) const { return *this * (1.0f / scale); }
+
+	constexpr Vec3& operator+=(const Vec3& other) { return *this = *this + other; }
+	constexpr Vec3& operator-=(const Vec3& other) { return *this = *this - other; }
+	constexpr Vec3& operator*=(float scale) { return *this = *this * scale; }
+
+	[[nodiscard]] constexpr bool operator==(const Vec3& other) const = default;
+
+	float m_X{0.0f};
+	float m_Y{0.0f};
+	float m_Z{0.0f};
+};
+
+[[nodiscard]] constexpr Vec3 operator*(float scale, const Vec3& vector) { return vector * scale; }
+
+[[nodiscard]] constexpr float Dot(const Vec3& a, const Vec3& b) { return a.m_X * b.m_X + a.m_Y * b.m_Y + a.m_Z * b.m_Z; }
+
+[[nodiscard]] constexpr Vec3 Cross(const Vec3& a, const Vec3& b)
+{
+	return Vec3(a.m_Y * b.m_Z - a.m_Z * b.m_Y, a.m_Z * b.m_X - a.m_X * b.m_Z, a.m_X * b.m_Y - a.m_Y * b.m_X);
+}
+
+[[nodiscard]] constexpr float LengthSquared(const Vec3& vector) { return Dot(vector, vector); }
+[[nodiscard]] inline float Length(const Vec3& vector) { return std::sqrt(LengthSquared(vector)); }
+
+// The zero vector stays zero
+[[nodiscard]] inline Vec3 Normalize(const Vec3& vector)
+{
+	const float length = Length(vector);
+	return length > 0.0f ? vector / length : vector;
+}
+
+[[nodiscard]] constexpr Vec3 Lerp(const Vec3& a, const Vec3& b, float t) { return a + (b - a) * t; }
+[[nodiscard]] constexpr Vec3 Min(const Vec3& a, const Vec3& b) { return Vec3(b.m_X < a.m_X ? b.m_X : a.m_X, b.m_Y < a.m_Y ? b.m_Y : a.m_Y, b.m_Z < a.m_Z ? b.m_Z : a.m_Z); }
+[[nodiscard]] constexpr Vec3 Max(const Vec3& a, const Vec3& b) { return Vec3(a.m_X < b.m_X ? b.m_X : a.m_X, a.m_Y < b.m_Y ? b.m_Y : a.m_Y, a.m_Z < b.m_Z ? b.m_Z : a.m_Z); }
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Core/Math/Mat4.h"
+#include "Core/Math/Simd.h"
+#include "Core/Math/Vec3.h"
+
+/*
+* Structure of arrays packet of 4 (Vec3x4) or 8 (Vec3x8) vectors: one register per component, lane i is vector i
+* Every operation works on the whole packet with no shuffles, which is where SIMD pays off for 3D math
+* LoadSoA/StoreSoA read and write component arrays directly, Load/Store convert from and to arrays of Vec3
+*/
+template<int PacketWidth>
+struct Vec3Packet
+{
+	using Traits = Simd::FloatN<PacketWidth>;
+	using Float = typename Traits::Type;
+	static constexpr int Width = PacketWidth;
+
+	[[nodiscard]] static Vec3Packet Splat(const Vec3& vector) { return { Traits::Splat(vector.m_X), Traits::Splat(vector.m_Y), Traits::Splat(vector.m_Z) }; }
+
+	[[nodiscard]] static Vec3Packet LoadSoA(const float* xs, const float* ys, const float* zs) { return { Traits::Load(xs), Traits::Load(ys), Traits::Load(zs) }; }
+
+	void StoreSoA(float* xs, float* ys, float* zs) const
+	{
+		Simd::Store(xs, m_X);
+		Simd::Store(ys, m_Y);
+		Simd::Store(zs, m_Z);
+	}
+
+	[[nodiscard]] static Vec3Packet Load(const Vec3* vectors)
+	{
+		float xs[Width];
+		float ys[Width];
+		float zs[Width];
+		for (int i = 0; i < Width; ++i)
+		{
+			xs[i] = vectors[i].m_X;
+			ys[i] = vectors[i].m_Y;
+			zs[i] = vectors[i].m_Z;
+		}
+		return LoadSoA(xs, ys, zs);
+	}
+
+	void Store(Vec3* vectors) const
+	{
+		float xs[Width];
+		float ys[Width];
+		float zs[Width];
+		StoreSoA(xs, ys, zs);
+		for (int i = 0; i < Width; ++i)
+		{
+			vectors[i] = Vec3(xs[i], ys[i], zs[i]);
+		}
+	}
+
+	[[nodiscard]] Vec3Packet operator+(const Vec3Packet& other) const { return { Simd::Add(m_X, other.m_X), Simd::Add(m_Y, other.m_Y), Simd::Add(m_Z, other.m_Z) }; }
+	[[nodiscard]] Vec3Packet operator-(const Vec3Packet& other) const { return { Simd::Sub(m_X, other.m_X), Simd::Sub(m_Y, other.m_Y), Simd::Sub(m_Z, other.m_Z) }; }
+	[[nodiscard]] Vec3Packet operator*(const Vec3Packet& other) const { return { Simd::Mul(m_X, other.m_X), Simd::Mul(m_Y, other.m_Y), Simd::Mul(m_Z, other.m_Z) }; }
+	[[nodiscard]] Vec3Packet operator*(Float scale) const { return { Simd::Mul(m_X, scale), Simd::Mul(m_Y, scale), Simd::Mul(m_Z, scale) }; }
+	[[nodiscard]] Vec3Packet operator*(float scale) const { return *this * Traits::Splat(scale); }
+
+	Float m_X;
+	Float m_Y;
+	Float m_Z;
+};
+
+using Vec3x4 = Vec3Packet<4>;
+using Vec3x8 = Vec3Packet<8>;
+
+template<int Width>
+[[nodiscard]] typename Vec3Packet<Width>::Float Dot(const Vec3Packet<Width>& a, const Vec3Packet<Width>& b)
+{
+	return Simd::MulAdd(a.m_Z, b.m_Z, Simd::MulAdd(a.m_Y, b.m_Y, Simd::Mul(a.m_X, b.m_X)));
+}
+
+template<int Width>
+[[nodiscard]] Vec3Packet<Width> Cross(const Vec3Packet<Width>& a, const Vec3Packet<Width>& b)
+{
+	return {
+		Simd::Sub(Simd::Mul(a.m_Y, b.m_Z), Simd::Mul(a.m_Z, b.m_Y)),
+		Simd::Sub(Simd::Mul(a.m_Z, b.m_X), Simd::Mul(a.m_X, b.m_Z)),
+		Simd::Sub(Simd::Mul(a.m_X, b.m_Y), Simd::Mul(a.m_Y, b.m_X)) };
+}
+
+template<int Width>
+[[nodiscard]] typename Vec3Packet<Width>::Float Length(const Vec3Packet<Width>& vectors) { return Simd::Sqrt(Dot(vectors, vectors)); }
+
+// Vectors of length zero give NaNs, unlike the scalar Normalize
+template<int Width>
+[[nodiscard]] Vec3Packet<Width> Normalize(const Vec3Packet<Width>& vectors)
+{
+	return vectors * Simd::Div(Simd::FloatN<Width>::Splat(1.0f), Length(vectors));
+}
+
+// Every point with w = 1 times the matrix, the affine part only
+template<int Width>
+[[nodiscard]] Vec3Packet<Width> TransformPoints(const Mat4& matrix, const Vec3Packet<Width>& points)
+{
+	using Traits = Simd::FloatN<Width>;
+	const Vec4* rows = matrix.m_Rows;
+	Vec3Packet<Width> result;
+	result.m_X = Simd::MulAdd(points.m_Z, Traits::Splat(rows[2].m_X), Simd::MulAdd(points.m_Y, Traits::Splat(rows[1].m_X), Simd::MulAdd(points.m_X, Traits::Splat(rows[0].m_X), Traits::Splat(rows[3].m_X))));
+	result.m_Y = Simd::MulAdd(points.m_Z, Traits::Splat(rows[2].m_Y), Simd::MulAdd(points.m_Y, Traits::Splat(rows[1].m_Y), Simd::MulAdd(points.m_X, Traits::Splat(rows[0].m_Y), Traits::Splat(rows[3].m_Y))));
+	result.m_Z = Simd::MulAdd(points.m_Z, Traits::Splat(rows[2].m_Z), Simd::MulAdd(points.m_Y, Traits::Splat(rows[1].m_Z), Simd::MulAdd(points.m_X, Traits::Splat(rows[0].m_Z), Traits::Splat(rows[3].m_Z))));
+	return result;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cmath>
+
+#include "Core/Math/Simd.h"
+#include "Core/Math/Vec3.h"
+
+/*
+* 4 floats aligned on 16 bytes, each operation is one register operation
+* Also the rows of Mat4 and the storage of Quat
+*/
+struct alignas(16) Vec4
+{
+	constexpr Vec4() = default;
+	constexpr Vec4(float x, float y, float z, float w) : m_X(x), m_Y(y), m_Z(z), m_W(w) {}
+	constexpr Vec4(const Vec3& xyz, float w) : m_X(xyz.m_X), m_Y(xyz.m_Y), m_Z(xyz.m_Z), m_W(w) {}
+	constexpr explicit Vec4(float value) : m_X(value), m_Y(value), m_Z(value), m_W(value) {}
+
+	[[nodiscard]] static Vec4 FromSimd(Simd::Float4 value)
+	{
+		Vec4 vector;
+		Simd::Store(&vector.m_X, value);
+		return vector;
+	}
+
+	[[nodiscard]] Simd::Float4 ToSimd() const { return Simd::Load(&m_X); }
+	[[nodiscard]] constexpr Vec3 GetXYZ() const { return Vec3(m_X, m_Y, m_Z); }
+
+	[[nodiscard]] Vec4 operator-() const { return FromSimd(Simd::Sub(Simd::Zero(), ToSimd())); }
+	[[nodiscard]] Vec4 operator+(const Vec4& other) const { return FromSimd(Simd::Add(ToSimd(), other.ToSimd())); }
+	[[nodiscard]] Vec4 operator-(const Vec4& other) const { return FromSimd(Simd::Sub(ToSimd(), other.ToSimd())); }
+	[[nodiscard]] Vec4 operator*(const Vec4& other) const { return FromSimd(Simd::Mul(ToSimd(), other.ToSimd())); }
+	[[nodiscard]] Vec4 operator*(float scale) const { return FromSimd(Simd::Mul(ToSimd(), Simd::Splat(scale))); }
+
+	Vec4& operator+=(const Vec4& other) { return *this = *this + other; }
+	Vec4& operator-=(const Vec4& other) { return *this = *this - other; }
+	Vec4& operator*=(float scale) { return *this = *this * scale; }
+
+	[[nodiscard]] constexpr bool operator==(const Vec4& other) const = default;
+
+	float m_X{0.0f};
+	float m_Y{0.0f};
+	float m_Z{0.0f};
+	float m_W{0.0f};
+};
+
+[[nodiscard]] inline float Dot(const Vec4& a, const Vec4& b) { return Simd::Dot4(a.ToSimd(), b.ToSimd()); }
+[[nodiscard]] inline float Length(const Vec4& vector) { return std::sqrt(Dot(vector, vector)); }
+[[nodiscard]] inline Vec4 Lerp(const Vec4& a, const Vec4& b, float t) { return Vec4::FromSimd(Simd::MulAdd(Simd::Sub(b.ToSimd(), a.ToSimd()), Simd::Splat(t), a.ToSimd())); }
+[[nodiscard]] inline Vec4 Min(const Vec4& a, const Vec4& b) { return Vec4::FromSimd(Simd::Min(a.ToSimd(), b.ToSimd())); }
+[[nodiscard]] inline Vec4 Max(const Vec4& a, const Vec4& b) { return Vec4::FromSimd(Simd::Max(a.ToSimd(), b.ToSimd())); }
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+/*
+* Allocators used by the engine containers
+* An allocator is a small copyable object with
+*	void* Allocate(size_t size, size_t alignment);
+*	void Free(void* memory, size_t size, size_t alignment);
+* Two allocators compare equal when memory allocated by one can be freed by the other
+*/
+
+// Global heap, the default of every container
+struct HeapAllocator
+{
+	[[nodiscard]] void* Allocate(size_t size, size_t alignment)
+	{
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			return ::operator new(size, std::align_val_t{alignment});
+		}
+		return ::operator new(size);
+	}
+
+	void Free(void* memory, size_t size, size_t alignment)
+	{
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			::operator delete(memory, size, std::align_val_t{alignment});
+			return;
+		}
+		::operator delete(memory, size);
+	}
+
+	[[nodiscard]] bool operator==(const HeapAllocator&) const { return true; }
+};
+
+// Any standard memory resource, e.g. FrameArena::GetResource()
+class ResourceAllocator
+{
+public:
+	ResourceAllocator() : m_Resource(std::pmr::get_default_resource()) {}
+	ResourceAllocator(std::pmr::memory_resource* resource) : m_Resource(resource) {}
+
+	[[nodiscard]] void* Allocate(size_t size, size_t alignment) { return m_Resource->allocate(size, alignment); }
+	void Free(void* memory, size_t size, size_t alignment) { m_Resource->deallocate(memory, size, alignment); }
+
+	[[nodiscard]] std::pmr::memory_resource* GetResource() const { return m_Resource; }
+	[[nodiscard]] bool operator==(const ResourceAllocator& other) const { return m_Resource->is_equal(*other.m_Resource); }
+
+private:
+	std::pmr::memory_resource* m_Resource;
+};
+
+/*
+* A type is trivially relocatable when moving it to a new address and forgetting the old one
+* is the same as copying its bytes, containers then grow with a memcpy
+* Trivially copyable types always are, specialize it for the other types that qualify
+*/
+template<typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+// Only holds a pointer, nothing refers back to the unique_ptr itself
+template<typename T>
+struct IsTriviallyRelocatable<std::unique_ptr<T>> : std::true_type
+{
+};
+
+template<typename T>
+inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstddef>
+
+// Size used to pad data shared between threads so that two hot atomics never live on the same cache line
+inline constexpr size_t CacheLineSize = 64;
@@ -0,0 +1,181 @@
+#include "Core/Memory/FrameArena.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "System/Assert.h"
+
+namespace
+{
+	// Every block is aligned on a cache line, bigger alignments are not supported
+	constexpr std::align_val_t BlockAlignment{CacheLineSize};
+
+	std::atomic<uint64_t> s_NextArenaId{1};
+
+	// Last region used by this thread, ids are never reused so a stale entry can never match another arena
+	struct RegionCache
+	{
+		uint64_t m_ArenaId{0};
+		void* m_Region{nullptr};
+	};
+	thread_local RegionCache t_RegionCache;
+
+	std::byte* AlignUp(std::byte* pointer, size_t alignment)
+	{
+		const uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+		return pointer + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+	}
+}
+
+FrameArena::FrameArena(size_t blockSize)
+	: m_Id(s_NextArenaId.fetch_add(1, std::memory_order_relaxed))
+	, m_BlockSize(blockSize)
+	, m_Resource(*this)
+{
+}
+
+FrameArena::~FrameArena()
+{
+	for (UniquePtr<ThreadRegion>& region : m_Regions)
+	{
+		for (Block& block : region->m_Blocks)
+		{
+			::operator delete(block.m_Data, BlockAlignment);
+		}
+	}
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment)
+{
+	NIH_ASSERT(alignment <= CacheLineSize && (alignment & (alignment - 1)) == 0);
+
+	ThreadRegion& region = GetThreadRegion();
+	std::byte* const start = AlignUp(region.m_Cursor, alignment);
+	if (region.m_Cursor == nullptr || start + size > region.m_End)
+	{
+		return AllocateSlow(region, size);
+	}
+
+	region.m_UsedBytes += static_cast<size_t>(start + size - region.m_Cursor);
+	region.m_Cursor = start + size;
+	return start;
+}
+
+void* FrameArena::AllocateSlow(ThreadRegion& region, size_t size)
+{
+	// the rest of the current block is lost for this frame, move to the next block big enough
+	if (region.m_Cursor != nullptr)
+	{
+		region.m_UsedBytes += static_cast<size_t>(region.m_End - region.m_Cursor);
+		region.m_BlockIndex++;
+	}
+
+	while (region.m_BlockIndex < region.m_Blocks.GetSize() && region.m_Blocks[region.m_BlockIndex].m_Size < size)
+	{
+		region.m_BlockIndex++;
+	}
+
+	if (region.m_BlockIndex == region.m_Blocks.GetSize())
+	{
+		Block block;
+		block.m_Size = std::max(m_BlockSize, size);
+		block.m_Data = static_cast<std::byte*>(::operator new(block.m_Size, BlockAlignment));
+		region.m_Blocks.PushBack(block);
+	}
+
+	const Block& block = region.m_Blocks[region.m_BlockIndex];
+	region.m_Cursor = block.m_Data;
+	region.m_End = block.m_Data + block.m_Size;
+
+	// a block starts on a cache line which covers any supported alignment
+	region.m_UsedBytes += size;
+	region.m_Cursor += size;
+	return block.m_Data;
+}
+
+FrameArena::ThreadRegion& FrameArena::GetThreadRegion()
+{
+	if (t_RegionCache.m_ArenaId == m_Id)
+	{
+		return *static_cast<ThreadRegion*>(t_RegionCache.m_Region);
+	}
+
+	// the thread used another arena in between, or it is the first time it allocates here
+	const std::thread::id threadId = std::this_thread::get_id();
+	std::lock_guard lock(m_RegionMutex);
+
+	ThreadRegion* threadRegion = nullptr;
+	for (UniquePtr<ThreadRegion>& region : m_Regions)
+	{
+		if (region->m_Owner == threadId)
+		{
+			threadRegion = region.get();
+			break;
+		}
+	}
+
+	if (threadRegion == nullptr)
+	{
+		m_Regions.PushBack(std::make_unique<ThreadRegion>());
+		threadRegion = m_Regions.Back().get();
+		threadRegion->m_Owner = threadId;
+	}
+
+	t_RegionCache.m_ArenaId = m_Id;
+	t_RegionCache.m_Region = threadRegion;
+	return *threadRegion;
+}
+
+void FrameArena::Reset()
+{
+	m_HighWaterMark = std::max(m_HighWaterMark, GetUsedBytes());
+
+	std::lock_guard lock(m_RegionMutex);
+	for (UniquePtr<ThreadRegion>& region : m_Regions)
+	{
+		region->m_BlockIndex = 0;
+		region->m_UsedBytes = 0;
+		if (region->m_Blocks.IsEmpty())
+		{
+			continue;
+		}
+		region->m_Cursor = region->m_Blocks[0].m_Data;
+		region->m_End = region->m_Cursor + region->m_Blocks[0].m_Size;
+	}
+}
+
+size_t FrameArena::GetUsedBytes() const
+{
+	std::lock_guard lock(m_RegionMutex);
+	size_t usedBytes = 0;
+	for (const UniquePtr<ThreadRegion>& region : m_Regions)
+	{
+		usedBytes += region->m_UsedBytes;
+	}
+	return usedBytes;
+}
+
+size_t FrameArena::GetHighWaterMark() const
+{
+	return std::max(m_HighWaterMark, GetUsedBytes());
+}
+
+size_t FrameArena::GetReservedBytes() const
+{
+	std::lock_guard lock(m_RegionMutex);
+	size_t reservedBytes = 0;
+	for (const UniquePtr<ThreadRegion>& region : m_Regions)
+	{
+		for (const Block& block : region->m_Blocks)
+		{
+			reservedBytes += block.m_Size;
+		}
+	}
+	return reservedBytes;
+}
+
+size_t FrameArena::GetThreadCount() const
+{
+	std::lock_guard lock(m_RegionMutex);
+	return m_Regions.GetSize();
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/CacheLine.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Core/NonCopyable.h"
+
+/*
+* Linear allocator for memory that only lives until the end of the frame
+* Every thread bumps a pointer in its own region, so allocating never takes a lock once the thread has its region.
+* Nothing is freed one by one: Reset rewinds every region at once and keeps the blocks for the next frame.
+* Reset and the stats must only be called while no thread allocates, e.g. between two frames
+*/
+class FrameArena : private NonCopyable
+{
+public:
+	static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+	explicit FrameArena(size_t blockSize = DefaultBlockSize);
+	~FrameArena();
+
+	[[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	// Storage for count objects, they are not constructed and their destructor is never called
+	template<typename T>
+	[[nodiscard]] T* Allocate(size_t count)
+	{
+		return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	void Reset();
+
+	// Bytes handed out since the last Reset, padding included
+	[[nodiscard]] size_t GetUsedBytes() const;
+	// Most bytes used during a single frame since the arena was created
+	[[nodiscard]] size_t GetHighWaterMark() const;
+	// Bytes reserved from the heap, every region included
+	[[nodiscard]] size_t GetReservedBytes() const;
+	[[nodiscard]] size_t GetThreadCount() const;
+
+	// Adapter for the standard containers, deallocating through it does nothing
+	[[nodiscard]] std::pmr::memory_resource* GetResource() { return &m_Resource; }
+
+private:
+	struct Block
+	{
+		std::byte* m_Data{nullptr};
+		size_t m_Size{0};
+	};
+
+	struct alignas(CacheLineSize) ThreadRegion
+	{
+		std::thread::id m_Owner{};
+		Vector<Block> m_Blocks;
+		size_t m_BlockIndex{0};
+		std::byte* m_Cursor{nullptr};
+		std::byte* m_End{nullptr};
+		size_t m_UsedBytes{0};
+	};
+
+	class Resource : public std::pmr::memory_resource
+	{
+	public:
+		explicit Resource(FrameArena& arena) : m_Arena(arena) {}
+
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override { return m_Arena.Allocate(bytes, alignment); }
+		void do_deallocate(void*, size_t, size_t) override {}
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+		FrameArena& m_Arena;
+	};
+
+	ThreadRegion& GetThreadRegion();
+	void* AllocateSlow(ThreadRegion& region, size_t size);
+
+	const uint64_t m_Id;
+	const size_t m_BlockSize;
+
+	// regions are only added under the mutex and never removed before the arena dies
+	mutable std::mutex m_RegionMutex;
+	Vector<UniquePtr<ThreadRegion>> m_Regions;
+
+	size_t m_HighWaterMark{0};
+	Resource m_Resource;
+};
+
+
+// Container allocator bumping in a frame arena, freeing does nothing and the memory goes away on Reset
+class FrameArenaAllocator
+{
+public:
+	FrameArenaAllocator(FrameArena& arena) : m_Arena(&arena) {}
+
+	[[nodiscard]] void* Allocate(size_t size, size_t alignment) { return m_Arena->Allocate(size, alignment); }
+	void Free(void*, size_t, size_t) {}
+
+	[[nodiscard]] bool operator==(const FrameArenaAllocator& other) const { return m_Arena == other.m_Arena; }
+
+private:
+	FrameArena* m_Arena;
+};
+
+template<typename T>
+using FrameVector = Vector<T, FrameArenaAllocator>;
@@ -0,0 +1,98 @@
+#include "Core/Memory/PoolAllocator.h"
+
+#include <algorithm>
+
+#include "System/Assert.h"
+
+namespace
+{
+	// A chunk always holds a few blocks, even when they are bigger than a page
+	constexpr size_t MinBlocksPerChunk = 8;
+
+	size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+PoolAllocator::PoolAllocator(size_t blockSize, size_t blockAlignment, bool alignToCacheLine)
+	: m_Owner(std::this_thread::get_id())
+{
+	NIH_ASSERT((blockAlignment & (blockAlignment - 1)) == 0);
+
+	// a free block stores the next pointer in place
+	m_BlockAlignment = std::max(blockAlignment, alignof(FreeBlock));
+	if (alignToCacheLine)
+	{
+		m_BlockAlignment = std::max(m_BlockAlignment, CacheLineSize);
+	}
+	m_BlockSize = AlignUp(std::max(blockSize, sizeof(FreeBlock)), m_BlockAlignment);
+	m_ChunkSize = AlignUp(std::max(PageSize, m_BlockSize * MinBlocksPerChunk), PageSize);
+}
+
+PoolAllocator::~PoolAllocator()
+{
+	for (std::byte* chunk : m_Chunks)
+	{
+		::operator delete(chunk, std::align_val_t{m_BlockAlignment});
+	}
+}
+
+void* PoolAllocator::Allocate()
+{
+	NIH_ASSERT(std::this_thread::get_id() == m_Owner);
+
+	if (m_LocalFreeList == nullptr)
+	{
+		// take every block freed by the other threads at once
+		m_LocalFreeList = m_RemoteFreeList.exchange(nullptr, std::memory_order_acquire);
+	}
+
+	m_AllocatedCount++;
+
+	if (m_LocalFreeList != nullptr)
+	{
+		FreeBlock* block = m_LocalFreeList;
+		m_LocalFreeList = block->m_Next;
+		return block;
+	}
+	return AllocateFromChunk();
+}
+
+void PoolAllocator::Free(void* block)
+{
+	NIH_ASSERT(block != nullptr);
+
+	FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+	if (std::this_thread::get_id() == m_Owner)
+	{
+		freeBlock->m_Next = m_LocalFreeList;
+		m_LocalFreeList = freeBlock;
+		m_LocalFreeCount++;
+		return;
+	}
+
+	FreeBlock* head = m_RemoteFreeList.load(std::memory_order_relaxed);
+	do
+	{
+		freeBlock->m_Next = head;
+	} while (!m_RemoteFreeList.compare_exchange_weak(head, freeBlock, std::memory_order_release, std::memory_order_relaxed));
+
+	m_RemoteFreeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* PoolAllocator::AllocateFromChunk()
+{
+	// blocks are carved lazily, a new chunk costs nothing until its blocks are used
+	if (m_ChunkCursor == m_ChunkEnd)
+	{
+		std::byte* chunk = static_cast<std::byte*>(::operator new(m_ChunkSize, std::align_val_t{m_BlockAlignment}));
+		m_Chunks.PushBack(chunk);
+		m_ChunkCursor = chunk;
+		m_ChunkEnd = chunk + m_ChunkSize / m_BlockSize * m_BlockSize;
+	}
+
+	void* block = m_ChunkCursor;
+	m_ChunkCursor += m_BlockSize;
+	return block;
+}
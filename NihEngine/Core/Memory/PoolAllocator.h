@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/CacheLine.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Core/NonCopyable.h"
+
+/*
+* Allocator of fixed size blocks, carved out of page sized chunks
+* Free blocks are chained through their own storage, so allocating and freeing are O(1) and cost no memory.
+* Allocate must be called from the thread that created the allocator, Free can be called from any thread without
+* a lock: blocks freed by the owner go straight back to its free list, the others go to a lock free list
+* that the owner takes over in one go when it runs dry.
+* Chunks are only given back to the heap when the allocator dies
+*/
+class PoolAllocator : private NonCopyable
+{
+public:
+	static constexpr size_t PageSize = 4096;
+
+	// With alignToCacheLine every block starts on its own cache line, so two blocks never share one
+	PoolAllocator(size_t blockSize, size_t blockAlignment, bool alignToCacheLine = false);
+	~PoolAllocator();
+
+	[[nodiscard]] void* Allocate();
+	void Free(void* block);
+
+	[[nodiscard]] size_t GetBlockSize() const { return m_BlockSize; }
+	[[nodiscard]] size_t GetChunkSize() const { return m_ChunkSize; }
+	[[nodiscard]] size_t GetChunkCount() const { return m_Chunks.GetSize(); }
+	// Blocks allocated and not freed yet, only exact once the other threads are done freeing
+	[[nodiscard]] size_t GetLiveCount() const { return m_AllocatedCount - m_LocalFreeCount - m_RemoteFreeCount.load(std::memory_order_relaxed); }
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock* m_Next;
+	};
+
+	void* AllocateFromChunk();
+
+	size_t m_BlockSize;
+	size_t m_BlockAlignment;
+	size_t m_ChunkSize;
+
+	// only touched by the owner thread
+	std::thread::id m_Owner;
+	FreeBlock* m_LocalFreeList{nullptr};
+	size_t m_AllocatedCount{0};
+	size_t m_LocalFreeCount{0};
+	std::byte* m_ChunkCursor{nullptr};
+	std::byte* m_ChunkEnd{nullptr};
+	Vector<std::byte*> m_Chunks;
+
+	// pushed by any thread, emptied at once by the owner thread so it never suffers from ABA
+	alignas(CacheLineSize) std::atomic<FreeBlock*> m_RemoteFreeList{nullptr};
+	std::atomic<size_t> m_RemoteFreeCount{0};
+};
+
+/*
+* Typed front of the pool allocator, constructs and destroys the objects
+* Same threading rules: New from the thread that created the pool, Delete from anywhere
+*/
+template<typename T>
+class Pool : private NonCopyable
+{
+public:
+	class Deleter
+	{
+	public:
+		Deleter() = default;
+		explicit Deleter(Pool& pool) : m_Pool(&pool) {}
+
+		void operator()(T* object) const { m_Pool->Delete(object); }
+
+	private:
+		Pool* m_Pool{nullptr};
+	};
+
+	using Ptr = UniquePtr<T, Deleter>;
+
+	explicit Pool(bool alignToCacheLine = false)
+		: m_Allocator(sizeof(T), alignof(T), alignToCacheLine)
+	{
+	}
+
+	template<typename... Args>
+	[[nodiscard]] T* New(Args&&... args)
+	{
+		void* block = m_Allocator.Allocate();
+		return new (block) T(std::forward<Args>(args)...);
+	}
+
+	void Delete(T* object)
+	{
+		if (object == nullptr)
+		{
+			return;
+		}
+		object->~T();
+		m_Allocator.Free(object);
+	}
+
+	// Owning pointer that gives the object back to this pool, the pool must outlive it
+	template<typename... Args>
+	[[nodiscard]] Ptr MakeUnique(Args&&... args)
+	{
+		return Ptr(New(std::forward<Args>(args)...), Deleter(*this));
+	}
+
+	[[nodiscard]] const PoolAllocator& GetAllocator() const { return m_Allocator; }
+
+private:
+	PoolAllocator m_Allocator;
+};
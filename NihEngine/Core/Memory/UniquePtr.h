@@ -2,5 +2,6 @@
 
 #include <memory>
 
-template<typename T>
-using UniquePtr = std::unique_ptr<T>;
\ No newline at end of file
+// The deleter can be swapped to give the object back to where it came from, e.g. Pool<T>::Deleter
+template<typename T, typename Deleter = std::default_delete<T>>
+using UniquePtr = std::unique_ptr<T, Deleter>;
\ No newline at end of file
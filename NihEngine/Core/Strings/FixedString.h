@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/*
+* String with inline storage for up to Capacity characters, always null terminated, never allocates
+* Everything is constexpr so names can be built at compile time
+* Text that does not fit is cut at Capacity characters, Append tells the caller when that happens
+*/
+template<size_t Capacity>
+class FixedString
+{
+	static_assert(Capacity > 0 && Capacity < UINT32_MAX, "Capacity must fit in 32 bits");
+
+public:
+	constexpr FixedString() = default;
+
+	constexpr FixedString(std::string_view text)
+	{
+		Append(text);
+	}
+
+	constexpr FixedString(const char* text)
+		: FixedString(std::string_view(text))
+	{
+	}
+
+	constexpr FixedString& operator=(std::string_view text)
+	{
+		Clear();
+		Append(text);
+		return *this;
+	}
+
+	constexpr FixedString& operator=(const char* text)
+	{
+		return *this = std::string_view(text);
+	}
+
+	// Returns false when the text had to be cut
+	constexpr bool Append(std::string_view text)
+	{
+		const size_t room = Capacity - m_Size;
+		const size_t count = text.size() < room ? text.size() : room;
+		for (size_t i = 0; i < count; ++i)
+		{
+			m_Data[m_Size + i] = text[i];
+		}
+		m_Size += static_cast<uint32_t>(count);
+		m_Data[m_Size] = '\0';
+		return count == text.size();
+	}
+
+	constexpr bool Append(char character)
+	{
+		return Append(std::string_view(&character, 1));
+	}
+
+	constexpr void Clear()
+	{
+		m_Size = 0;
+		m_Data[0] = '\0';
+	}
+
+	[[nodiscard]] constexpr size_t GetSize() const { return m_Size; }
+	[[nodiscard]] constexpr bool IsEmpty() const { return m_Size == 0; }
+	[[nodiscard]] static constexpr size_t GetCapacity() { return Capacity; }
+
+	[[nodiscard]] constexpr const char* CStr() const { return m_Data; }
+	[[nodiscard]] constexpr std::string_view View() const { return std::string_view(m_Data, m_Size); }
+	constexpr operator std::string_view() const { return View(); }
+
+	[[nodiscard]] constexpr char operator[](size_t index) const { return m_Data[index]; }
+
+	[[nodiscard]] constexpr const char* begin() const { return m_Data; }
+	[[nodiscard]] constexpr const char* end() const { return m_Data + m_Size; }
+
+	template<size_t OtherCapacity>
+	[[nodiscard]] constexpr bool operator==(const FixedString<OtherCapacity>& other) const { return View() == other.View(); }
+	[[nodiscard]] constexpr bool operator==(std::string_view other) const { return View() == other; }
+	[[nodiscard]] constexpr bool operator<(std::string_view other) const { return View() < other; }
+
+private:
+	char m_Data[Capacity + 1]{};
+	uint32_t m_Size{0};
+};
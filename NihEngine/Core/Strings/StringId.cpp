@@ -0,0 +1,107 @@
+#include "Core/Strings/StringId.h"
+
+#if defined(NIH_STRINGID_NAMES)
+#include <atomic>
+#include <cstring>
+
+#include "System/Assert.h"
+
+namespace
+{
+	/*
+	* Open addressing table from id to text, lock free so ids can be built from any job
+	* A slot is claimed with a CAS on its id, the text is published right after; a reader that wins the race
+	* against the writer sees a null name, which GetName reports as unknown
+	* The table never shrinks and the copied texts are never freed, it only exists in debug builds
+	*/
+	class InternTable
+	{
+	public:
+		void Register(uint64_t value, std::string_view text)
+		{
+			if (value == 0)
+			{
+				return;
+			}
+
+			for (size_t probe = 0; probe < SlotCount; ++probe)
+			{
+				Slot& slot = m_Slots[(HashInteger(value) + probe) & Mask];
+				uint64_t id = slot.m_Id.load(std::memory_order_acquire);
+				if (id == 0 && slot.m_Id.compare_exchange_strong(id, value, std::memory_order_acq_rel))
+				{
+					char* name = new char[text.size() + 1];
+					std::memcpy(name, text.data(), text.size());
+					name[text.size()] = '\0';
+					slot.m_Name.store(name, std::memory_order_release);
+					return;
+				}
+				if (id == value)
+				{
+					// a different text hashing to the same id would make two resources or events the same
+					[[maybe_unused]] const char* name = slot.m_Name.load(std::memory_order_acquire);
+					NIH_ASSERT(name == nullptr || text == name);
+					return;
+				}
+			}
+			// table full, the id simply stays nameless
+		}
+
+		const char* Find(uint64_t value) const
+		{
+			if (value == 0)
+			{
+				return nullptr;
+			}
+
+			for (size_t probe = 0; probe < SlotCount; ++probe)
+			{
+				const Slot& slot = m_Slots[(HashInteger(value) + probe) & Mask];
+				const uint64_t id = slot.m_Id.load(std::memory_order_acquire);
+				if (id == value)
+				{
+					return slot.m_Name.load(std::memory_order_acquire);
+				}
+				if (id == 0)
+				{
+					return nullptr;
+				}
+			}
+			return nullptr;
+		}
+
+	private:
+		static constexpr size_t SlotCount = 1 << 16;
+		static constexpr size_t Mask = SlotCount - 1;
+
+		struct Slot
+		{
+			std::atomic<uint64_t> m_Id{0};
+			std::atomic<const char*> m_Name{nullptr};
+		};
+
+		Slot m_Slots[SlotCount];
+	};
+
+	InternTable& GetInternTable()
+	{
+		static InternTable* table = new InternTable();
+		return *table;
+	}
+}
+
+void StringId::Register(uint64_t value, std::string_view text)
+{
+	GetInternTable().Register(value, text);
+}
+
+const char* StringId::GetName() const
+{
+	return GetInternTable().Find(m_Value);
+}
+#else
+const char* StringId::GetName() const
+{
+	return nullptr;
+}
+#endif
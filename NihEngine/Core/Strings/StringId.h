@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "Config.h"
+#include "Core/Containers/Hash.h"
+
+/*
+* 64 bits identity of a string, two ids compare and hash as integers
+* The value is the FNV-1a hash of the text, so "Player"_sid is folded to a constant at compile time
+* With NIH_STRINGID_NAMES (debug builds) every id built at run time also records its text in a global table,
+* GetName gives it back for logs and the debugger and two strings hashing to the same id assert
+*/
+class StringId
+{
+public:
+	static constexpr uint64_t FnvOffsetBasis = 0xcbf29ce484222325ull;
+	static constexpr uint64_t FnvPrime = 0x100000001b3ull;
+
+	constexpr StringId() = default;
+
+	constexpr explicit StringId(std::string_view text)
+		: m_Value(HashString(text))
+	{
+#if defined(NIH_STRINGID_NAMES)
+		if (!std::is_constant_evaluated())
+		{
+			Register(m_Value, text);
+		}
+#endif
+	}
+
+	[[nodiscard]] static constexpr StringId FromValue(uint64_t value)
+	{
+		StringId id;
+		id.m_Value = value;
+		return id;
+	}
+
+	[[nodiscard]] static constexpr uint64_t HashString(std::string_view text)
+	{
+		uint64_t hash = FnvOffsetBasis;
+		for (const char character : text)
+		{
+			hash ^= static_cast<uint8_t>(character);
+			hash *= FnvPrime;
+		}
+		return hash;
+	}
+
+	// Text the id was built from, nullptr when it is unknown (release builds, or only ever built at compile time)
+	[[nodiscard]] const char* GetName() const;
+
+	[[nodiscard]] constexpr uint64_t GetValue() const { return m_Value; }
+	[[nodiscard]] constexpr bool IsValid() const { return m_Value != 0; }
+
+	[[nodiscard]] constexpr bool operator==(const StringId& other) const { return m_Value == other.m_Value; }
+	[[nodiscard]] constexpr bool operator!=(const StringId& other) const { return m_Value != other.m_Value; }
+	[[nodiscard]] constexpr bool operator<(const StringId& other) const { return m_Value < other.m_Value; }
+
+private:
+#if defined(NIH_STRINGID_NAMES)
+	static void Register(uint64_t value, std::string_view text);
+#endif
+
+	uint64_t m_Value{0};
+};
+
+constexpr StringId operator""_sid(const char* text, size_t size)
+{
+	return StringId(std::string_view(text, size));
+}
+
+// FNV-1a leaves the low bits poorly mixed, the hash containers need every bit to count
+template<>
+struct Hash<StringId>
+{
+	[[nodiscard]] uint64_t operator()(StringId id) const { return HashInteger(id.GetValue()); }
+};
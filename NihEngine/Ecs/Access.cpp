@@ -0,0 +1,59 @@
+#include "Ecs/Access.h"
+
+#include <atomic>
+
+#include "System/Assert.h"
+#include "System/Log.h"
+
+namespace
+{
+	thread_local const ComponentAccess* t_CurrentAccess = nullptr;
+	std::atomic<size_t> s_ViolationCount{0};
+
+	void AssertOnViolation(ComponentTypeId, bool)
+	{
+		NIH_ASSERT(false);
+	}
+
+	std::atomic<AccessViolationHandler> s_ViolationHandler{&AssertOnViolation};
+}
+
+namespace EcsDetail
+{
+	const ComponentAccess* SetCurrentAccess(const ComponentAccess* access)
+	{
+		const ComponentAccess* previous = t_CurrentAccess;
+		t_CurrentAccess = access;
+		return previous;
+	}
+
+	const ComponentAccess* GetCurrentAccess()
+	{
+		return t_CurrentAccess;
+	}
+
+#if defined(NIH_ECS_VALIDATE_ACCESS)
+	void ValidateAccess(ComponentTypeId type, bool isWrite)
+	{
+		const ComponentAccess* access = t_CurrentAccess;
+		if (access == nullptr || access->m_Writes.Test(type) || (!isWrite && access->m_Reads.Test(type)))
+		{
+			return;
+		}
+
+		NIH_LOG_ERROR("System touched component {} without declaring it, write {}", type, isWrite);
+		s_ViolationCount.fetch_add(1, std::memory_order_relaxed);
+		s_ViolationHandler.load(std::memory_order_acquire)(type, isWrite);
+	}
+#endif
+}
+
+size_t GetAccessViolationCount()
+{
+	return s_ViolationCount.load(std::memory_order_relaxed);
+}
+
+AccessViolationHandler SetAccessViolationHandler(AccessViolationHandler handler)
+{
+	return s_ViolationHandler.exchange(handler != nullptr ? handler : &AssertOnViolation, std::memory_order_acq_rel);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Config.h"
+#include "Ecs/Component.h"
+#include "Tasks/Task.h"
+
+// Components a system declared it reads and writes, writing a component also allows reading it
+struct ComponentAccess
+{
+	ComponentMask m_Reads;
+	ComponentMask m_Writes;
+};
+
+// Resource of the task graph standing for a component type, see Task::DeclareRead
+[[nodiscard]] inline TaskResource GetComponentResource(ComponentTypeId type)
+{
+	return HashInteger((uint64_t(0xEC5) << 32) | type);
+}
+
+/*
+* Access validation, compiled in when NIH_ECS_VALIDATE_ACCESS is defined
+* While a system runs, the thread running it knows the declared access, queries and component lookups made
+* from that thread are checked against it. Every violation is logged and counted, then given to the violation
+* handler, which asserts unless another one was set
+*/
+namespace EcsDetail
+{
+	// Returns the previous access of the calling thread, nullptr when it was not running a system
+	const ComponentAccess* SetCurrentAccess(const ComponentAccess* access);
+	[[nodiscard]] const ComponentAccess* GetCurrentAccess();
+
+#if defined(NIH_ECS_VALIDATE_ACCESS)
+	void ValidateAccess(ComponentTypeId type, bool isWrite);
+
+	template<typename... Ts>
+	void ValidateAccess()
+	{
+		(ValidateAccess(GetComponentTypeId<Ts>(), !std::is_const_v<Ts>), ...);
+	}
+#else
+	template<typename... Ts>
+	void ValidateAccess()
+	{
+	}
+#endif
+}
+
+// Undeclared accesses caught since the start of the program, always 0 when the validation is compiled out
+[[nodiscard]] size_t GetAccessViolationCount();
+
+// Called from the thread that made the access, nullptr restores the default handler
+using AccessViolationHandler = void (*)(ComponentTypeId type, bool isWrite);
+
+// Returns the previous handler
+AccessViolationHandler SetAccessViolationHandler(AccessViolationHandler handler);
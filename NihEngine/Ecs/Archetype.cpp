@@ -0,0 +1,158 @@
+#include "Ecs/Archetype.h"
+
+#include "Core/Memory/CacheLine.h"
+
+namespace
+{
+	constexpr size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+ChunkPool::~ChunkPool()
+{
+	for (std::byte* chunk : m_FreeChunks)
+	{
+		HeapAllocator{}.Free(chunk, ChunkSize, CacheLineSize);
+	}
+}
+
+std::byte* ChunkPool::Allocate(size_t size)
+{
+	if (size != ChunkSize || m_FreeChunks.IsEmpty())
+	{
+		return static_cast<std::byte*>(HeapAllocator{}.Allocate(size, CacheLineSize));
+	}
+	std::byte* chunk = m_FreeChunks.Back();
+	m_FreeChunks.PopBack();
+	return chunk;
+}
+
+void ChunkPool::Free(std::byte* chunk, size_t size)
+{
+	if (size != ChunkSize)
+	{
+		HeapAllocator{}.Free(chunk, size, CacheLineSize);
+		return;
+	}
+	m_FreeChunks.PushBack(chunk);
+}
+
+Archetype::Archetype(const ComponentMask& mask, ChunkPool& chunkPool)
+	: m_Mask(mask)
+	, m_ChunkPool(chunkPool)
+{
+	for (int32_t& column : m_ColumnOfType)
+	{
+		column = InvalidColumn;
+	}
+
+	size_t rowSize = sizeof(Entity);
+	mask.ForEach([this, &rowSize](ComponentTypeId type)
+	{
+		const ComponentInfo& info = GetComponentInfo(type);
+		NIH_ASSERT(info.m_Alignment <= CacheLineSize);
+		m_ColumnOfType[type] = static_cast<int32_t>(m_Columns.GetSize());
+		m_Columns.PushBack(Column{ type, 0, info.m_Size, &info });
+		rowSize += info.m_Size;
+	});
+
+	// as many rows as the chunk holds once every array is padded to a cache line
+	auto getLayoutSize = [this](size_t capacity)
+	{
+		size_t size = AlignUp(sizeof(Entity) * capacity, CacheLineSize);
+		for (const Column& column : m_Columns)
+		{
+			size = AlignUp(size + column.m_Size * capacity, CacheLineSize);
+		}
+		return size;
+	};
+	size_t capacity = ChunkPool::ChunkSize / rowSize;
+	while (capacity > 1 && getLayoutSize(capacity) > ChunkPool::ChunkSize)
+	{
+		--capacity;
+	}
+	// a row too large for a chunk gets a chunk of its own instead of overlapping arrays
+	if (capacity == 0 || getLayoutSize(capacity) > ChunkPool::ChunkSize)
+	{
+		capacity = 1;
+		m_ChunkSize = getLayoutSize(1);
+	}
+	m_ChunkCapacity = static_cast<uint32_t>(capacity);
+	NIH_ASSERT(m_ChunkCapacity > 0 && getLayoutSize(capacity) <= m_ChunkSize);
+
+	size_t offset = AlignUp(sizeof(Entity) * capacity, CacheLineSize);
+	for (Column& column : m_Columns)
+	{
+		column.m_Offset = offset;
+		offset = AlignUp(offset + column.m_Size * capacity, CacheLineSize);
+	}
+}
+
+Archetype::~Archetype()
+{
+	for (const Chunk& chunk : m_Chunks)
+	{
+		for (const Column& column : m_Columns)
+		{
+			if (column.m_Info->m_Destroy == nullptr)
+			{
+				continue;
+			}
+			for (uint32_t row = 0; row < chunk.m_Count; ++row)
+			{
+				column.m_Info->m_Destroy(chunk.m_Data + column.m_Offset + row * column.m_Size);
+			}
+		}
+		m_ChunkPool.Free(chunk.m_Data, m_ChunkSize);
+	}
+}
+
+void Archetype::AllocateRow(Entity entity, uint32_t& chunk, uint32_t& row)
+{
+	if (m_Chunks.IsEmpty() || m_Chunks.Back().m_Count == m_ChunkCapacity)
+	{
+		m_Chunks.PushBack(Chunk{ m_ChunkPool.Allocate(m_ChunkSize), 0 });
+	}
+
+	Chunk& last = m_Chunks.Back();
+	chunk = static_cast<uint32_t>(m_Chunks.GetSize() - 1);
+	row = last.m_Count++;
+	last.GetEntities()[row] = entity;
+	++m_EntityCount;
+}
+
+Entity Archetype::RemoveRow(uint32_t chunk, uint32_t row, bool destroyComponents)
+{
+	NIH_ASSERT(chunk < m_Chunks.GetSize() && row < m_Chunks[chunk].m_Count);
+
+	if (destroyComponents)
+	{
+		for (size_t column = 0; column < m_Columns.GetSize(); ++column)
+		{
+			DestroyComponent(*m_Columns[column].m_Info, GetComponent(chunk, row, column));
+		}
+	}
+
+	const uint32_t lastChunk = static_cast<uint32_t>(m_Chunks.GetSize() - 1);
+	const uint32_t lastRow = m_Chunks[lastChunk].m_Count - 1;
+	Entity moved;
+	if (chunk != lastChunk || row != lastRow)
+	{
+		for (size_t column = 0; column < m_Columns.GetSize(); ++column)
+		{
+			RelocateComponent(*m_Columns[column].m_Info, GetComponent(chunk, row, column), GetComponent(lastChunk, lastRow, column));
+		}
+		moved = m_Chunks[lastChunk].GetEntities()[lastRow];
+		m_Chunks[chunk].GetEntities()[row] = moved;
+	}
+
+	--m_EntityCount;
+	if (--m_Chunks[lastChunk].m_Count == 0)
+	{
+		m_ChunkPool.Free(m_Chunks[lastChunk].m_Data, m_ChunkSize);
+		m_Chunks.PopBack();
+	}
+	return moved;
+}
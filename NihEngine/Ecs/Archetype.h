@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/Containers/HashMap.h"
+#include "Core/Containers/Vector.h"
+#include "Core/NonCopyable.h"
+#include "Ecs/Component.h"
+#include "Ecs/Entity.h"
+#include "System/Assert.h"
+
+/*
+* Fixed size blocks holding the rows of an archetype, the blocks of emptied chunks are kept for the next ones
+* Archetypes whose row does not fit in ChunkSize get larger blocks, those go straight to the heap and are not kept
+* Not thread safe, chunks are only allocated and freed by structural changes which run on one thread
+*/
+class ChunkPool : private NonCopyable
+{
+public:
+	static constexpr size_t ChunkSize = 16 * 1024;
+
+	ChunkPool() = default;
+	~ChunkPool();
+
+	[[nodiscard]] std::byte* Allocate(size_t size);
+	void Free(std::byte* chunk, size_t size);
+
+private:
+	Vector<std::byte*> m_FreeChunks;
+};
+
+/*
+* Block of up to GetChunkCapacity() entities of one archetype, stored as one array per component (SoA)
+* The block starts with the Entity array, each component array starts on its own cache line
+*/
+struct Chunk
+{
+	std::byte* m_Data;
+	uint32_t m_Count;
+
+	[[nodiscard]] Entity* GetEntities() const { return reinterpret_cast<Entity*>(m_Data); }
+};
+
+/*
+* Every entity with exactly the same set of components
+* Rows are kept dense: every chunk is full except the last one, removing a row moves the last row in the hole,
+* so iterating is a linear walk over the arrays of each chunk
+*/
+class Archetype : private NonCopyable
+{
+public:
+	static constexpr int32_t InvalidColumn = -1;
+
+	Archetype(const ComponentMask& mask, ChunkPool& chunkPool);
+	~Archetype();
+
+	[[nodiscard]] const ComponentMask& GetMask() const { return m_Mask; }
+	[[nodiscard]] size_t GetEntityCount() const { return m_EntityCount; }
+	[[nodiscard]] uint32_t GetChunkCapacity() const { return m_ChunkCapacity; }
+	// ChunkPool::ChunkSize, or more when a single row does not fit in it
+	[[nodiscard]] size_t GetChunkSize() const { return m_ChunkSize; }
+	[[nodiscard]] size_t GetChunkCount() const { return m_Chunks.GetSize(); }
+	[[nodiscard]] const Chunk& GetChunk(size_t index) const { return m_Chunks[index]; }
+
+	// Columns are the component types sorted by id
+	[[nodiscard]] size_t GetColumnCount() const { return m_Columns.GetSize(); }
+	[[nodiscard]] ComponentTypeId GetColumnType(size_t column) const { return m_Columns[column].m_Type; }
+	[[nodiscard]] size_t GetColumnOffset(size_t column) const { return m_Columns[column].m_Offset; }
+	[[nodiscard]] int32_t FindColumn(ComponentTypeId type) const { return m_ColumnOfType[type]; }
+
+	[[nodiscard]] void* GetComponent(uint32_t chunk, uint32_t row, size_t column) const
+	{
+		const Column& info = m_Columns[column];
+		return m_Chunks[chunk].m_Data + info.m_Offset + row * info.m_Size;
+	}
+
+	[[nodiscard]] Entity GetEntity(uint32_t chunk, uint32_t row) const { return m_Chunks[chunk].GetEntities()[row]; }
+
+	// New row at the end holding entity, its components are left for the caller to construct
+	void AllocateRow(Entity entity, uint32_t& chunk, uint32_t& row);
+
+	/*
+	* Removes a row, destroying its components or not if they were relocated elsewhere
+	* The last row moves in the hole, returns its entity so the caller can update its location, or an invalid entity
+	* when the removed row was the last one
+	*/
+	Entity RemoveRow(uint32_t chunk, uint32_t row, bool destroyComponents);
+
+	// Archetype reached by adding or removing one component, cached by the world as the transitions are taken
+	[[nodiscard]] Archetype* FindTransition(ComponentTypeId type, bool isAdd) const
+	{
+		Archetype* const* target = (isAdd ? m_AddTransitions : m_RemoveTransitions).Find(type);
+		return target != nullptr ? *target : nullptr;
+	}
+
+	void SetTransition(ComponentTypeId type, bool isAdd, Archetype* target) { (isAdd ? m_AddTransitions : m_RemoveTransitions).InsertOrAssign(type, target); }
+
+private:
+	struct Column
+	{
+		ComponentTypeId m_Type;
+		size_t m_Offset;
+		size_t m_Size;
+		const ComponentInfo* m_Info;
+	};
+
+	ComponentMask m_Mask;
+	ChunkPool& m_ChunkPool;
+	Vector<Column> m_Columns;
+	int32_t m_ColumnOfType[MaxComponentTypes];
+	uint32_t m_ChunkCapacity{0};
+	size_t m_ChunkSize{ChunkPool::ChunkSize};
+	size_t m_EntityCount{0};
+	Vector<Chunk> m_Chunks;
+	HashMap<ComponentTypeId, Archetype*> m_AddTransitions;
+	HashMap<ComponentTypeId, Archetype*> m_RemoveTransitions;
+};
@@ -0,0 +1,114 @@
+#include "Ecs/CommandBuffer.h"
+
+#include "Core/Containers/SmallVector.h"
+#include "Core/Memory/Allocator.h"
+#include "Core/Memory/CacheLine.h"
+#include "Ecs/World.h"
+#include "System/Assert.h"
+
+namespace
+{
+	constexpr size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+CommandBuffer::~CommandBuffer()
+{
+	DestroyPayloads();
+	for (const Page& page : m_Pages)
+	{
+		HeapAllocator{}.Free(page.m_Data, page.m_Size, CacheLineSize);
+	}
+}
+
+void CommandBuffer::Apply(World& world)
+{
+	NIH_ASSERT(!world.IsLocked());
+
+	SmallVector<ComponentTypeId, 8> types;
+	SmallVector<void*, 8> sources;
+	for (const Command& command : m_Commands)
+	{
+		switch (command.m_Type)
+		{
+		case CommandType::Create:
+			types.Clear();
+			sources.Clear();
+			for (uint32_t i = 0; i < command.m_PayloadCount; ++i)
+			{
+				Payload& payload = m_Payloads[command.m_FirstPayload + i];
+				types.PushBack(payload.m_Type);
+				sources.PushBack(payload.m_Data);
+				payload.m_Data = nullptr;
+			}
+			world.CreateEntityFrom(types.GetData(), sources.GetData(), types.GetSize());
+			break;
+
+		case CommandType::Destroy:
+			world.DestroyEntity(command.m_Entity);
+			break;
+
+		case CommandType::Add:
+			if (world.IsAlive(command.m_Entity))
+			{
+				Payload& payload = m_Payloads[command.m_FirstPayload];
+				world.AddComponent(command.m_Entity, payload.m_Type, payload.m_Data);
+				payload.m_Data = nullptr;
+			}
+			break;
+
+		case CommandType::Remove:
+			world.RemoveComponent(command.m_Entity, command.m_RemovedType);
+			break;
+		}
+	}
+	Clear();
+}
+
+void CommandBuffer::Clear()
+{
+	DestroyPayloads();
+	m_Commands.Clear();
+	m_Payloads.Clear();
+	m_CurrentPage = 0;
+	m_PageOffset = 0;
+}
+
+void* CommandBuffer::AllocatePayload(size_t size, size_t alignment)
+{
+	// pages start on a cache line, the largest alignment archetypes accept
+	NIH_ASSERT(alignment <= CacheLineSize);
+
+	while (m_CurrentPage < m_Pages.GetSize())
+	{
+		const Page& page = m_Pages[m_CurrentPage];
+		const size_t offset = AlignUp(m_PageOffset, alignment);
+		if (offset + size <= page.m_Size)
+		{
+			m_PageOffset = offset + size;
+			return page.m_Data + offset;
+		}
+		++m_CurrentPage;
+		m_PageOffset = 0;
+	}
+
+	// pages are kept for the next frames, a component larger than a page gets a page of its own
+	const size_t pageSize = size > PageSize ? size : PageSize;
+	m_Pages.PushBack(Page{ static_cast<std::byte*>(HeapAllocator{}.Allocate(pageSize, CacheLineSize)), pageSize });
+	m_CurrentPage = m_Pages.GetSize() - 1;
+	m_PageOffset = size;
+	return m_Pages.Back().m_Data;
+}
+
+void CommandBuffer::DestroyPayloads()
+{
+	for (const Payload& payload : m_Payloads)
+	{
+		if (payload.m_Data != nullptr)
+		{
+			DestroyComponent(GetComponentInfo(payload.m_Type), payload.m_Data);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/CacheLine.h"
+#include "Core/NonCopyable.h"
+#include "Ecs/Component.h"
+#include "Ecs/Entity.h"
+
+class World;
+
+/*
+* Structural changes recorded while the world is locked by a query, and applied in order once it is not
+* The components given to the buffer are moved into its own pages and relocated into the chunks by Apply.
+* A buffer is used by one thread at a time, each job records into its own buffer
+*/
+class CommandBuffer : private NonCopyable
+{
+public:
+	CommandBuffer() = default;
+	~CommandBuffer();
+
+	// The entity is created when the buffer is applied
+	template<typename... Ts>
+	void CreateEntity(Ts&&... components)
+	{
+		m_Commands.PushBack(Command{ CommandType::Create, Entity{}, static_cast<uint32_t>(m_Payloads.GetSize()), sizeof...(Ts), 0 });
+		(PushPayload(std::forward<Ts>(components)), ...);
+	}
+
+	void DestroyEntity(Entity entity)
+	{
+		m_Commands.PushBack(Command{ CommandType::Destroy, entity, 0, 0, 0 });
+	}
+
+	template<typename T>
+	void AddComponent(Entity entity, T&& component)
+	{
+		m_Commands.PushBack(Command{ CommandType::Add, entity, static_cast<uint32_t>(m_Payloads.GetSize()), 1, 0 });
+		PushPayload(std::forward<T>(component));
+	}
+
+	template<typename T>
+	void RemoveComponent(Entity entity)
+	{
+		m_Commands.PushBack(Command{ CommandType::Remove, entity, 0, 0, GetComponentTypeId<T>() });
+	}
+
+	// Commands on entities destroyed in the meantime are dropped. Leaves the buffer empty
+	void Apply(World& world);
+
+	// Drops the commands without applying them
+	void Clear();
+
+	[[nodiscard]] bool IsEmpty() const { return m_Commands.IsEmpty(); }
+	[[nodiscard]] size_t GetCommandCount() const { return m_Commands.GetSize(); }
+
+private:
+	static constexpr size_t PageSize = 16 * 1024;
+
+	enum class CommandType : uint8_t
+	{
+		Create,
+		Destroy,
+		Add,
+		Remove,
+	};
+
+	struct Command
+	{
+		CommandType m_Type;
+		Entity m_Entity;
+		uint32_t m_FirstPayload;
+		uint32_t m_PayloadCount;
+		ComponentTypeId m_RemovedType;
+	};
+
+	// A component waiting in the pages, m_Data is reset once it has been relocated into the world
+	struct Payload
+	{
+		ComponentTypeId m_Type;
+		void* m_Data;
+	};
+
+	template<typename T>
+	void PushPayload(T&& component)
+	{
+		using Component = std::remove_cvref_t<T>;
+		static_assert(alignof(Component) <= CacheLineSize, "Components cannot be aligned on more than a cache line");
+		void* data = AllocatePayload(sizeof(Component), alignof(Component));
+		new (data) Component(std::forward<T>(component));
+		m_Payloads.PushBack(Payload{ GetComponentTypeId<Component>(), data });
+	}
+
+	void* AllocatePayload(size_t size, size_t alignment);
+	void DestroyPayloads();
+
+	struct Page
+	{
+		std::byte* m_Data;
+		size_t m_Size;
+	};
+
+	Vector<Command> m_Commands;
+	Vector<Payload> m_Payloads;
+	Vector<Page> m_Pages;
+	size_t m_CurrentPage{0};
+	size_t m_PageOffset{0};
+};
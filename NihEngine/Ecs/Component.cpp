@@ -0,0 +1,39 @@
+#include "Ecs/Component.h"
+
+#include <atomic>
+
+#include "System/Assert.h"
+
+namespace
+{
+	ComponentInfo s_Infos[MaxComponentTypes];
+	std::atomic<ComponentTypeId> s_Count{0};
+}
+
+namespace EcsDetail
+{
+	ComponentTypeId RegisterComponentType(const ComponentInfo& info)
+	{
+		const ComponentTypeId id = s_Count.fetch_add(1, std::memory_order_relaxed);
+		NIH_ASSERT(id < MaxComponentTypes);
+		// published to the other threads by the guard of the static that holds the id
+		s_Infos[id] = info;
+		return id;
+	}
+}
+
+const ComponentInfo& GetComponentInfo(ComponentTypeId id)
+{
+	NIH_ASSERT(id < s_Count.load(std::memory_order_relaxed));
+	return s_Infos[id];
+}
+
+uint64_t ComponentMask::GetHash() const
+{
+	uint64_t hash = 0;
+	for (uint64_t word : m_Words)
+	{
+		hash = HashInteger(hash ^ word);
+	}
+	return hash;
+}
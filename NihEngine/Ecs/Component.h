@@ -0,0 +1,184 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Hash.h"
+#include "Core/Memory/Allocator.h"
+
+/*
+* Components are plain structs, any type that is move constructible can be one
+* Each type gets a small id the first time it is used, archetypes are described by the set of ids of their components
+*/
+using ComponentTypeId = uint32_t;
+
+inline constexpr ComponentTypeId MaxComponentTypes = 128;
+
+// What an archetype needs to store a component type it does not know statically
+struct ComponentInfo
+{
+	size_t m_Size;
+	size_t m_Alignment;
+	// moves the component from source to destination and ends the lifetime of source, nullptr when memcpy does it
+	void (*m_Relocate)(void* destination, void* source);
+	// nullptr when trivially destructible
+	void (*m_Destroy)(void* component);
+};
+
+namespace EcsDetail
+{
+	template<typename T>
+	void Relocate(void* destination, void* source)
+	{
+		T* from = static_cast<T*>(source);
+		new (destination) T(std::move(*from));
+		from->~T();
+	}
+
+	template<typename T>
+	void Destroy(void* component)
+	{
+		static_cast<T*>(component)->~T();
+	}
+
+	template<typename T>
+	constexpr ComponentInfo MakeComponentInfo()
+	{
+		return ComponentInfo{
+			sizeof(T),
+			alignof(T),
+			IsTriviallyRelocatableV<T> ? nullptr : &Relocate<T>,
+			std::is_trivially_destructible_v<T> ? nullptr : &Destroy<T>,
+		};
+	}
+
+	// Thread safe, the ids are handed out in the order of the first use
+	ComponentTypeId RegisterComponentType(const ComponentInfo& info);
+}
+
+namespace EcsDetail
+{
+	template<typename T>
+	ComponentTypeId GetTypeId()
+	{
+		static_assert(std::is_move_constructible_v<T>, "Components are moved between chunks");
+		static const ComponentTypeId id = RegisterComponentType(MakeComponentInfo<T>());
+		return id;
+	}
+}
+
+// T, const T and T& are the same component
+template<typename T>
+[[nodiscard]] ComponentTypeId GetComponentTypeId()
+{
+	return EcsDetail::GetTypeId<std::remove_cvref_t<T>>();
+}
+
+[[nodiscard]] const ComponentInfo& GetComponentInfo(ComponentTypeId id);
+
+inline void RelocateComponent(const ComponentInfo& info, void* destination, void* source)
+{
+	if (info.m_Relocate != nullptr)
+	{
+		info.m_Relocate(destination, source);
+	}
+	else
+	{
+		std::memcpy(destination, source, info.m_Size);
+	}
+}
+
+inline void DestroyComponent(const ComponentInfo& info, void* component)
+{
+	if (info.m_Destroy != nullptr)
+	{
+		info.m_Destroy(component);
+	}
+}
+
+// Set of component types, the identity of an archetype
+class ComponentMask
+{
+public:
+	constexpr ComponentMask() = default;
+
+	template<typename... Ts>
+	[[nodiscard]] static ComponentMask Create()
+	{
+		ComponentMask mask;
+		(mask.Set(GetComponentTypeId<Ts>()), ...);
+		return mask;
+	}
+
+	constexpr void Set(ComponentTypeId id) { m_Words[id / 64] |= uint64_t(1) << (id % 64); }
+	constexpr void Reset(ComponentTypeId id) { m_Words[id / 64] &= ~(uint64_t(1) << (id % 64)); }
+	[[nodiscard]] constexpr bool Test(ComponentTypeId id) const { return (m_Words[id / 64] >> (id % 64)) & 1; }
+
+	// Every type of other is also in this mask
+	[[nodiscard]] constexpr bool Contains(const ComponentMask& other) const
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			if ((m_Words[i] & other.m_Words[i]) != other.m_Words[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	[[nodiscard]] constexpr bool Intersects(const ComponentMask& other) const
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			if ((m_Words[i] & other.m_Words[i]) != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	[[nodiscard]] constexpr size_t Count() const
+	{
+		size_t count = 0;
+		for (uint64_t word : m_Words)
+		{
+			count += static_cast<size_t>(std::popcount(word));
+		}
+		return count;
+	}
+
+	// Calls function(ComponentTypeId) for every type, in increasing order
+	template<typename Function>
+	void ForEach(Function&& function) const
+	{
+		for (size_t i = 0; i < WordCount; ++i)
+		{
+			for (uint64_t word = m_Words[i]; word != 0; word &= word - 1)
+			{
+				function(static_cast<ComponentTypeId>(i * 64 + static_cast<size_t>(std::countr_zero(word))));
+			}
+		}
+	}
+
+	[[nodiscard]] uint64_t GetHash() const;
+
+	[[nodiscard]] constexpr bool operator==(const ComponentMask&) const = default;
+
+private:
+	static constexpr size_t WordCount = MaxComponentTypes / 64;
+
+	uint64_t m_Words[WordCount]{};
+};
+
+template<>
+struct Hash<ComponentMask>
+{
+	[[nodiscard]] uint64_t operator()(const ComponentMask& mask) const { return mask.GetHash(); }
+};
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "Core/Containers/SlotMap.h"
+
+// An entity is only an id, its data lives in the chunks of its archetype
+using Entity = Handle64;
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "Core/Containers/Vector.h"
+#include "Ecs/Access.h"
+#include "Ecs/Archetype.h"
+#include "Ecs/Component.h"
+#include "Ecs/Entity.h"
+#include "Ecs/World.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace EcsDetail
+{
+	template<typename T, typename... Ts>
+	constexpr size_t IndexOfComponent()
+	{
+		constexpr bool Matches[] = { std::is_same_v<std::remove_const_t<T>, std::remove_const_t<Ts>>... };
+		for (size_t i = 0; i < sizeof...(Ts); ++i)
+		{
+			if (Matches[i])
+			{
+				return i;
+			}
+		}
+		return sizeof...(Ts);
+	}
+}
+
+/*
+* The arrays of one chunk for the components of a query
+* Components declared const in the query are only readable
+*/
+template<typename... Ts>
+class QueryChunk
+{
+public:
+	QueryChunk(const Chunk& chunk, const size_t* offsets)
+		: m_Entities(chunk.GetEntities())
+		, m_Columns(reinterpret_cast<Ts*>(chunk.m_Data + offsets[EcsDetail::IndexOfComponent<Ts, Ts...>()])...)
+		, m_Count(chunk.m_Count)
+	{
+	}
+
+	[[nodiscard]] size_t GetCount() const { return m_Count; }
+	[[nodiscard]] const Entity* GetEntities() const { return m_Entities; }
+
+	// Array of GetCount() components, T is one of the types of the query with or without its const
+	template<typename T>
+	[[nodiscard]] auto* Get() const
+	{
+		constexpr size_t Index = EcsDetail::IndexOfComponent<T, Ts...>();
+		static_assert(Index < sizeof...(Ts), "The component is not part of the query");
+		return std::get<Index>(m_Columns);
+	}
+
+	[[nodiscard]] const std::tuple<Ts*...>& GetColumns() const { return m_Columns; }
+
+private:
+	const Entity* m_Entities;
+	std::tuple<Ts*...> m_Columns;
+	size_t m_Count;
+};
+
+/*
+* Every entity that has at least the components Ts
+* The matching archetypes are cached, each run only looks at the archetypes created since the last one.
+* Iteration is a linear walk over the chunks of each archetype, the callback gets the components by reference:
+*	Query<const Velocity, Position> query(world);
+*	query.ForEach([](const Velocity& velocity, Position& position) { ... });
+* The callback may take the Entity first. The world is locked while the query runs, structural changes go through
+* a CommandBuffer. Inside a system, the components of the query are checked against its declared access
+*/
+template<typename... Ts>
+class Query
+{
+	static_assert(sizeof...(Ts) > 0, "A query needs at least one component");
+
+public:
+	using View = QueryChunk<Ts...>;
+
+	// Archetype matching the query, with the offsets of the arrays of the components in its chunks
+	struct Match
+	{
+		Archetype* m_Archetype;
+		size_t m_Offsets[sizeof...(Ts)];
+	};
+
+	explicit Query(World& world)
+		: m_World(world)
+		, m_Mask(ComponentMask::Create<Ts...>())
+	{
+	}
+
+	// Excluded components, entities that have any of them are skipped. Must be set before the first run
+	template<typename... Us>
+	Query& Without()
+	{
+		NIH_ASSERT(m_CheckedArchetypeCount == 0);
+		m_Excluded = ComponentMask::Create<Us...>();
+		return *this;
+	}
+
+	[[nodiscard]] World& GetWorld() const { return m_World; }
+
+	// Brings the cache up to date with the archetypes of the world
+	const Vector<Match>& GetMatches()
+	{
+		for (; m_CheckedArchetypeCount < m_World.GetArchetypeCount(); ++m_CheckedArchetypeCount)
+		{
+			Archetype& archetype = m_World.GetArchetype(m_CheckedArchetypeCount);
+			if (!archetype.GetMask().Contains(m_Mask) || archetype.GetMask().Intersects(m_Excluded))
+			{
+				continue;
+			}
+
+			Match match{ &archetype, {} };
+			const ComponentTypeId types[] = { GetComponentTypeId<Ts>()... };
+			for (size_t i = 0; i < sizeof...(Ts); ++i)
+			{
+				match.m_Offsets[i] = archetype.GetColumnOffset(archetype.FindColumn(types[i]));
+			}
+			m_Matches.PushBack(match);
+		}
+		return m_Matches;
+	}
+
+	[[nodiscard]] size_t GetEntityCount()
+	{
+		size_t count = 0;
+		for (const Match& match : GetMatches())
+		{
+			count += match.m_Archetype->GetEntityCount();
+		}
+		return count;
+	}
+
+	// function(const QueryChunk<Ts...>&) for every non empty chunk
+	template<typename Function>
+	void ForEachChunk(Function&& function)
+	{
+		EcsDetail::ValidateAccess<Ts...>();
+		m_World.Lock();
+		for (const Match& match : GetMatches())
+		{
+			for (size_t i = 0; i < match.m_Archetype->GetChunkCount(); ++i)
+			{
+				function(View(match.m_Archetype->GetChunk(i), match.m_Offsets));
+			}
+		}
+		m_World.Unlock();
+	}
+
+	// function(Ts&...) or function(Entity, Ts&...) for every entity
+	template<typename Function>
+	void ForEach(Function&& function)
+	{
+		ForEachChunk([&function](const View& chunk)
+		{
+			ForEachInChunk(chunk, function);
+		});
+	}
+
+	/*
+	* ForEach with the chunks spread over the job system, at most chunksPerJob chunks per job
+	* function is called concurrently for different entities. Not reentrant, the chunks are gathered in the query
+	*/
+	template<typename Function>
+	void ParallelForEach(JobSystem& jobSystem, Function&& function, size_t chunksPerJob = 1)
+	{
+		EcsDetail::ValidateAccess<Ts...>();
+		m_World.Lock();
+		m_Views.Clear();
+		for (const Match& match : GetMatches())
+		{
+			for (size_t i = 0; i < match.m_Archetype->GetChunkCount(); ++i)
+			{
+				m_Views.EmplaceBack(match.m_Archetype->GetChunk(i), match.m_Offsets);
+			}
+		}
+
+		// the workers check what the function touches against the access of the calling system
+		const ComponentAccess* access = EcsDetail::GetCurrentAccess();
+		ParallelFor(jobSystem, IndexRange{ 0, m_Views.GetSize() }, chunksPerJob, [this, &function, access](IndexRange range)
+		{
+			const ComponentAccess* previous = EcsDetail::SetCurrentAccess(access);
+			for (size_t i = range.m_Begin; i < range.m_End; ++i)
+			{
+				ForEachInChunk(m_Views[i], function);
+			}
+			EcsDetail::SetCurrentAccess(previous);
+		});
+		m_World.Unlock();
+	}
+
+	// The inner loop of ForEach, for callers that split the chunks themselves
+	template<typename Function>
+	static void ForEachInChunk(const View& chunk, Function& function)
+	{
+		std::apply([&chunk, &function](Ts*... columns)
+		{
+			const size_t count = chunk.GetCount();
+			if constexpr (std::is_invocable_v<Function&, Entity, Ts&...>)
+			{
+				const Entity* entities = chunk.GetEntities();
+				for (size_t i = 0; i < count; ++i)
+				{
+					function(entities[i], columns[i]...);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					function(columns[i]...);
+				}
+			}
+		}, chunk.GetColumns());
+	}
+
+private:
+	World& m_World;
+	ComponentMask m_Mask;
+	ComponentMask m_Excluded;
+	Vector<Match> m_Matches;
+	size_t m_CheckedArchetypeCount{0};
+	Vector<View> m_Views;
+};
@@ -0,0 +1,56 @@
+#include "Ecs/System.h"
+
+#include "System/Assert.h"
+
+void System::Update(float deltaTime)
+{
+	const ComponentAccess* previous = EcsDetail::SetCurrentAccess(&m_Access);
+	OnUpdate(deltaTime);
+	EcsDetail::SetCurrentAccess(previous);
+}
+
+void System::Declare(ComponentTypeId type, bool isWrite)
+{
+	if (isWrite)
+	{
+		m_Access.m_Writes.Set(type);
+		DeclareWrite(GetComponentResource(type));
+	}
+	else
+	{
+		m_Access.m_Reads.Set(type);
+		DeclareRead(GetComponentResource(type));
+	}
+}
+
+void SystemScheduler::AddSystem(System& system)
+{
+	NIH_ASSERT(&system.GetWorld() == &m_World);
+	m_Systems.PushBack(&system);
+	m_Tasks.PushBack(&system);
+	m_IsGraphBuilt = false;
+}
+
+void SystemScheduler::Run(JobSystem& jobSystem, float deltaTime)
+{
+	if (!m_IsGraphBuilt)
+	{
+		m_TaskGraph.Build(m_Tasks);
+		m_IsGraphBuilt = true;
+	}
+
+	for (System* system : m_Systems)
+	{
+		system->m_JobSystem = &jobSystem;
+	}
+
+	m_World.Lock();
+	m_TaskGraph.Run(jobSystem, deltaTime);
+	m_World.Unlock();
+
+	for (System* system : m_Systems)
+	{
+		system->m_JobSystem = nullptr;
+		system->m_Commands.Apply(m_World);
+	}
+}
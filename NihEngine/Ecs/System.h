@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "Core/Containers/Vector.h"
+#include "Core/NonCopyable.h"
+#include "Ecs/Access.h"
+#include "Ecs/CommandBuffer.h"
+#include "Ecs/Query.h"
+#include "Ecs/World.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Task.h"
+#include "Tasks/TaskGraph.h"
+
+class SystemScheduler;
+
+/*
+* Task working on the components of a world
+* The components it reads and writes are declared once, usually in the constructor, and become resources of the
+* task graph: systems that do not share a written component run at the same time, the others keep the order
+* they were added in. Structural changes are recorded in GetCommands() and applied once every system is done
+*/
+class System : public Task
+{
+public:
+	explicit System(World& world) : m_World(world) {}
+
+	void Init() override {}
+	void Update(float deltaTime) final;
+
+	[[nodiscard]] const ComponentAccess& GetAccess() const { return m_Access; }
+
+protected:
+	virtual void OnUpdate(float deltaTime) = 0;
+
+	template<typename... Ts>
+	void Reads()
+	{
+		(Declare(GetComponentTypeId<Ts>(), false), ...);
+	}
+
+	template<typename... Ts>
+	void Writes()
+	{
+		(Declare(GetComponentTypeId<Ts>(), true), ...);
+	}
+
+	// Lookups through the world are reads, GetComponent<Velocity> only needs Reads<Velocity>()
+	[[nodiscard]] const World& GetWorld() const { return m_World; }
+
+	// Lookup of a component the system declared with Writes, nullptr when the entity does not have it
+	template<typename T>
+	[[nodiscard]] T* GetMutableComponent(Entity entity) const
+	{
+		return m_World.GetComponent<T>(entity);
+	}
+	[[nodiscard]] CommandBuffer& GetCommands() { return m_Commands; }
+
+	/*
+	* Runs the query, split over the chunks when it is large and the system runs on a job system
+	* function is then called concurrently for different entities
+	*/
+	template<typename... Ts, typename Function>
+	void ForEach(Query<Ts...>& query, Function&& function)
+	{
+		if (m_JobSystem != nullptr && m_JobSystem->GetWorkerCount() > 1 && query.GetEntityCount() >= ParallelEntityCount)
+		{
+			query.ParallelForEach(*m_JobSystem, std::forward<Function>(function));
+		}
+		else
+		{
+			query.ForEach(std::forward<Function>(function));
+		}
+	}
+
+private:
+	friend class SystemScheduler;
+
+	// Below this a query is cheaper to run on one thread than to split
+	static constexpr size_t ParallelEntityCount = 8192;
+
+	void Declare(ComponentTypeId type, bool isWrite);
+
+	World& m_World;
+	ComponentAccess m_Access;
+	CommandBuffer m_Commands;
+	JobSystem* m_JobSystem{nullptr};
+};
+
+/*
+* Runs the systems of one world on the job system
+* The world is locked while they run, their command buffers are applied afterwards in the order the systems
+* were added, so the result does not depend on which system finished first
+*/
+class SystemScheduler : private NonCopyable
+{
+public:
+	explicit SystemScheduler(World& world) : m_World(world) {}
+
+	// The system must outlive the scheduler and work on its world
+	void AddSystem(System& system);
+
+	void Run(JobSystem& jobSystem, float deltaTime);
+
+	[[nodiscard]] const TaskGraph& GetTaskGraph() const { return m_TaskGraph; }
+
+private:
+	World& m_World;
+	Vector<System*> m_Systems;
+	Vector<Task*> m_Tasks;
+	TaskGraph m_TaskGraph;
+	// the declarations do not change once the systems are added, the graph is only rebuilt when one is added
+	bool m_IsGraphBuilt{false};
+};
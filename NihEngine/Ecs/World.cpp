@@ -0,0 +1,168 @@
+#include "Ecs/World.h"
+
+World::World()
+{
+	// the archetype of entities without components
+	GetOrCreateArchetype(ComponentMask{});
+}
+
+World::~World()
+{
+	NIH_ASSERT(!IsLocked());
+}
+
+Entity World::CreateEntityFrom(const ComponentTypeId* types, void* const* sources, size_t count)
+{
+	NIH_ASSERT(!IsLocked());
+
+	ComponentMask mask;
+	for (size_t i = 0; i < count; ++i)
+	{
+		mask.Set(types[i]);
+	}
+	NIH_ASSERT(mask.Count() == count);
+
+	const Entity entity = CreateEntityIn(GetOrCreateArchetype(mask));
+	const Location& location = *m_Locations.Get(entity);
+	for (size_t i = 0; i < count; ++i)
+	{
+		void* component = location.m_Archetype->GetComponent(location.m_Chunk, location.m_Row, location.m_Archetype->FindColumn(types[i]));
+		RelocateComponent(GetComponentInfo(types[i]), component, sources[i]);
+	}
+	return entity;
+}
+
+bool World::DestroyEntity(Entity entity)
+{
+	NIH_ASSERT(!IsLocked());
+
+	const Location* location = m_Locations.Get(entity);
+	if (location == nullptr)
+	{
+		return false;
+	}
+	RemoveRow(*location, true);
+	m_Locations.Erase(entity);
+	return true;
+}
+
+bool World::AddComponent(Entity entity, ComponentTypeId type, void* source)
+{
+	NIH_ASSERT(IsAlive(entity));
+	if (!IsAlive(entity))
+	{
+		return false;
+	}
+
+	const ComponentInfo& info = GetComponentInfo(type);
+	if (void* existing = FindComponent(entity, type))
+	{
+		DestroyComponent(info, existing);
+		RelocateComponent(info, existing, source);
+		return true;
+	}
+
+	const Location& location = MoveEntity(entity, type, true);
+	RelocateComponent(info, location.m_Archetype->GetComponent(location.m_Chunk, location.m_Row, location.m_Archetype->FindColumn(type)), source);
+	return true;
+}
+
+bool World::RemoveComponent(Entity entity, ComponentTypeId type)
+{
+	if (FindComponent(entity, type) == nullptr)
+	{
+		return false;
+	}
+	MoveEntity(entity, type, false);
+	return true;
+}
+
+Archetype* World::GetOrCreateArchetype(const ComponentMask& mask)
+{
+	if (Archetype** archetype = m_ArchetypeOfMask.Find(mask))
+	{
+		return *archetype;
+	}
+
+	Archetype* archetype = m_Archetypes.EmplaceBack(new Archetype(mask, m_ChunkPool)).get();
+	m_ArchetypeOfMask.TryEmplace(mask, archetype);
+	return archetype;
+}
+
+Entity World::CreateEntityIn(Archetype* archetype)
+{
+	const Entity entity = m_Locations.Insert(Location{ archetype, 0, 0 });
+	Location& location = *m_Locations.Get(entity);
+	archetype->AllocateRow(entity, location.m_Chunk, location.m_Row);
+	return entity;
+}
+
+void* World::FindComponent(Entity entity, ComponentTypeId type) const
+{
+	const Location* location = m_Locations.Get(entity);
+	if (location == nullptr)
+	{
+		return nullptr;
+	}
+	const int32_t column = location->m_Archetype->FindColumn(type);
+	return column != Archetype::InvalidColumn ? location->m_Archetype->GetComponent(location->m_Chunk, location->m_Row, column) : nullptr;
+}
+
+const World::Location& World::MoveEntity(Entity entity, ComponentTypeId type, bool isAdd)
+{
+	NIH_ASSERT(!IsLocked());
+
+	// callers checked the entity is alive
+	Location* found = m_Locations.Get(entity);
+	NIH_ASSERT(found != nullptr);
+	Location& location = *found;
+	Archetype* source = location.m_Archetype;
+	Archetype* target = source->FindTransition(type, isAdd);
+	if (target == nullptr)
+	{
+		ComponentMask mask = source->GetMask();
+		if (isAdd)
+		{
+			mask.Set(type);
+		}
+		else
+		{
+			mask.Reset(type);
+		}
+		target = GetOrCreateArchetype(mask);
+		source->SetTransition(type, isAdd, target);
+		target->SetTransition(type, !isAdd, source);
+	}
+
+	const Location previous = location;
+	target->AllocateRow(entity, location.m_Chunk, location.m_Row);
+	location.m_Archetype = target;
+
+	for (size_t column = 0; column < source->GetColumnCount(); ++column)
+	{
+		const ComponentTypeId columnType = source->GetColumnType(column);
+		void* component = source->GetComponent(previous.m_Chunk, previous.m_Row, column);
+		const int32_t targetColumn = target->FindColumn(columnType);
+		if (targetColumn != Archetype::InvalidColumn)
+		{
+			RelocateComponent(GetComponentInfo(columnType), target->GetComponent(location.m_Chunk, location.m_Row, targetColumn), component);
+		}
+		else
+		{
+			DestroyComponent(GetComponentInfo(columnType), component);
+		}
+	}
+	RemoveRow(previous, false);
+	return location;
+}
+
+void World::RemoveRow(const Location& location, bool destroyComponents)
+{
+	const Entity moved = location.m_Archetype->RemoveRow(location.m_Chunk, location.m_Row, destroyComponents);
+	if (moved.IsValid())
+	{
+		Location& movedLocation = *m_Locations.Get(moved);
+		movedLocation.m_Chunk = location.m_Chunk;
+		movedLocation.m_Row = location.m_Row;
+	}
+}
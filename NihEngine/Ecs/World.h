@@ -0,0 +1,159 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/HashMap.h"
+#include "Core/Containers/SlotMap.h"
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Core/NonCopyable.h"
+#include "Ecs/Access.h"
+#include "Ecs/Archetype.h"
+#include "Ecs/Component.h"
+#include "Ecs/Entity.h"
+#include "System/Assert.h"
+
+/*
+* Owns the entities and their components, grouped by archetype
+* Structural changes (creating and destroying entities, adding and removing components) move rows between chunks
+* and are not allowed while a query runs over the world, record them in a CommandBuffer and apply it afterwards.
+* Not thread safe: structural changes run on one thread, queries only write the components they asked for
+*/
+class World : private NonCopyable
+{
+public:
+	// Where the components of an entity live
+	struct Location
+	{
+		Archetype* m_Archetype;
+		uint32_t m_Chunk;
+		uint32_t m_Row;
+	};
+
+	World();
+	~World();
+
+	template<typename... Ts>
+	Entity CreateEntity(Ts&&... components)
+	{
+		NIH_ASSERT(!IsLocked());
+
+		const ComponentMask mask = ComponentMask::Create<Ts...>();
+		NIH_ASSERT(mask.Count() == sizeof...(Ts));
+
+		const Entity entity = CreateEntityIn(GetOrCreateArchetype(mask));
+		const Location& location = *m_Locations.Get(entity);
+		(Construct<std::remove_cvref_t<Ts>>(location, std::forward<Ts>(components)), ...);
+		return entity;
+	}
+
+	/*
+	* Type erased creation, sources[i] holds a component of types[i] which is relocated into the entity,
+	* the lifetime of the sources ends here
+	*/
+	Entity CreateEntityFrom(const ComponentTypeId* types, void* const* sources, size_t count);
+
+	// Returns false when the entity was already destroyed
+	bool DestroyEntity(Entity entity);
+
+	[[nodiscard]] bool IsAlive(Entity entity) const { return m_Locations.Contains(entity); }
+	[[nodiscard]] size_t GetEntityCount() const { return m_Locations.GetSize(); }
+
+	template<typename T>
+	[[nodiscard]] bool HasComponent(Entity entity) const
+	{
+		const Location* location = m_Locations.Get(entity);
+		return location != nullptr && location->m_Archetype->FindColumn(GetComponentTypeId<T>()) != Archetype::InvalidColumn;
+	}
+
+	// nullptr when the entity is dead or does not have the component
+	template<typename T>
+	[[nodiscard]] T* GetComponent(Entity entity)
+	{
+		EcsDetail::ValidateAccess<T>();
+		return static_cast<T*>(FindComponent(entity, GetComponentTypeId<T>()));
+	}
+
+	template<typename T>
+	[[nodiscard]] const T* GetComponent(Entity entity) const
+	{
+		EcsDetail::ValidateAccess<const T>();
+		return static_cast<const T*>(FindComponent(entity, GetComponentTypeId<T>()));
+	}
+
+	// Assigns the component when the entity already has one, nullptr when the entity is dead
+	template<typename T>
+	std::remove_cvref_t<T>* AddComponent(Entity entity, T&& component)
+	{
+		using Component = std::remove_cvref_t<T>;
+		NIH_ASSERT(IsAlive(entity));
+		if (!IsAlive(entity))
+		{
+			return nullptr;
+		}
+		if (Component* existing = GetComponent<Component>(entity))
+		{
+			*existing = std::forward<T>(component);
+			return existing;
+		}
+		const Location& location = MoveEntity(entity, GetComponentTypeId<Component>(), true);
+		return &Construct<Component>(location, std::forward<T>(component));
+	}
+
+	// Type erased version, the component in source is relocated into the entity
+	// Returns false when the entity is dead, source is then left untouched
+	bool AddComponent(Entity entity, ComponentTypeId type, void* source);
+
+	// Returns false when the entity is dead or did not have the component
+	template<typename T>
+	bool RemoveComponent(Entity entity)
+	{
+		return RemoveComponent(entity, GetComponentTypeId<T>());
+	}
+
+	bool RemoveComponent(Entity entity, ComponentTypeId type);
+
+	[[nodiscard]] const Location* GetLocation(Entity entity) const { return m_Locations.Get(entity); }
+
+	// Never shrinks and never reorders, queries remember how far they have looked
+	[[nodiscard]] size_t GetArchetypeCount() const { return m_Archetypes.GetSize(); }
+	[[nodiscard]] Archetype& GetArchetype(size_t index) const { return *m_Archetypes[index]; }
+
+	// Held by the queries while they run, structural changes assert when the world is locked
+	void Lock() { m_LockCount.fetch_add(1, std::memory_order_relaxed); }
+	void Unlock() { m_LockCount.fetch_sub(1, std::memory_order_relaxed); }
+	[[nodiscard]] bool IsLocked() const { return m_LockCount.load(std::memory_order_relaxed) != 0; }
+
+private:
+	Archetype* GetOrCreateArchetype(const ComponentMask& mask);
+	Entity CreateEntityIn(Archetype* archetype);
+	void* FindComponent(Entity entity, ComponentTypeId type) const;
+
+	/*
+	* Moves the entity to the archetype with one component more or less, the shared components are relocated,
+	* a removed component is destroyed and an added one is left for the caller to construct
+	*/
+	const Location& MoveEntity(Entity entity, ComponentTypeId type, bool isAdd);
+
+	// Removes the row of location from its archetype and fixes the location of the row moved in its place
+	void RemoveRow(const Location& location, bool destroyComponents);
+
+	template<typename T, typename Arg>
+	T& Construct(const Location& location, Arg&& argument)
+	{
+		const int32_t column = location.m_Archetype->FindColumn(GetComponentTypeId<T>());
+		return *new (location.m_Archetype->GetComponent(location.m_Chunk, location.m_Row, column)) T(std::forward<Arg>(argument));
+	}
+
+	// declared first so it outlives the archetypes that give their chunks back
+	ChunkPool m_ChunkPool;
+	Vector<UniquePtr<Archetype>> m_Archetypes;
+	HashMap<ComponentMask, Archetype*> m_ArchetypeOfMask;
+	SlotMap<Location, Entity> m_Locations;
+	std::atomic<uint32_t> m_LockCount{0};
+};
@@ -0,0 +1,22 @@
+#include "Engine/Clock.h"
+
+#include <chrono>
+
+// steady_clock is QueryPerformanceCounter with MSVC and clock_gettime(CLOCK_MONOTONIC) with libstdc++ and libc++
+uint64_t SteadyClock::GetTicks()
+{
+	return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+uint64_t SteadyClock::GetFrequency() const
+{
+	using Period = std::chrono::steady_clock::period;
+	static_assert(Period::num == 1, "steady_clock period must be a fraction of a second");
+	return static_cast<uint64_t>(Period::den);
+}
+
+SteadyClock& SteadyClock::Get()
+{
+	static SteadyClock clock;
+	return clock;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+* Source of time for the StepTimer
+* Ticks are expressed in GetFrequency() ticks per second
+*/
+class IClock
+{
+public:
+	virtual ~IClock() = default;
+
+	[[nodiscard]] virtual uint64_t GetTicks() = 0;
+	[[nodiscard]] virtual uint64_t GetFrequency() const = 0;
+};
+
+// Monotonic high resolution clock: QueryPerformanceCounter on Windows, clock_gettime(CLOCK_MONOTONIC) on Linux
+class SteadyClock : public IClock
+{
+public:
+	[[nodiscard]] uint64_t GetTicks() override;
+	[[nodiscard]] uint64_t GetFrequency() const override;
+
+	// Shared instance used by default
+	[[nodiscard]] static SteadyClock& Get();
+};
+
+/*
+* Clock that only moves when told to
+* With an auto advance step every read moves the clock forward by that step, which lets the engine
+* run as fast as possible while every frame still sees the exact same delta time
+*/
+class VirtualClock : public IClock
+{
+public:
+	static constexpr uint64_t DefaultFrequency = 10'000'000;
+
+	explicit VirtualClock(uint64_t frequency = DefaultFrequency)
+		: m_Frequency(frequency)
+	{
+	}
+
+	[[nodiscard]] uint64_t GetTicks() override
+	{
+		const uint64_t ticks = m_Ticks;
+		m_Ticks += m_AutoAdvanceTicks;
+		return ticks;
+	}
+	[[nodiscard]] uint64_t GetFrequency() const override { return m_Frequency; }
+
+	void Advance(uint64_t ticks) { m_Ticks += ticks; }
+	void AdvanceSeconds(double seconds) { m_Ticks += SecondsToTicks(seconds); }
+
+	void SetAutoAdvance(uint64_t ticks) { m_AutoAdvanceTicks = ticks; }
+	void SetAutoAdvanceSeconds(double seconds) { m_AutoAdvanceTicks = SecondsToTicks(seconds); }
+
+private:
+	[[nodiscard]] uint64_t SecondsToTicks(double seconds) const { return static_cast<uint64_t>(seconds * static_cast<double>(m_Frequency)); }
+
+	uint64_t m_Frequency;
+	uint64_t m_Ticks{0};
+	uint64_t m_AutoAdvanceTicks{0};
+};
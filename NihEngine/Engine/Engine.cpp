@@ -1,13 +1,27 @@
 
 #include "Engine.h"
 
-void Engine::SetWindowInit(Window::WindowInit&& windowInit)
+#include "System/Log.h"
+#include "Window/EventQueue.h"
+
+Engine::~Engine()
 {
-	m_Window = std::make_unique<Window>(std::move(windowInit));
+	Log::Shutdown();
+}
+
+void Engine::SetWindow(UniquePtr<IWindow>&& window)
+{
+	m_Window = std::move(window);
+}
+
+void Engine::SetClock(IClock& clock)
+{
+	m_Timer.SetClock(clock);
 }
 
 void Engine::Init()
 {
+	Log::Init();
 	m_Window->Init();
 	m_TaskManager = std::make_unique<TaskManager>();
 	m_TaskManager->Init();
@@ -18,9 +32,17 @@ void Engine::Run()
 	BeginSimulation();
 	while (m_IsRunning)
 	{
-		m_Timer.Tick([&]() {
-			Tick();
-		});
+		Step();
+	}
+	EndSimulation();
+}
+
+void Engine::RunFrames(uint64_t frameCount)
+{
+	BeginSimulation();
+	for (uint64_t frame = 0; frame < frameCount && m_IsRunning; ++frame)
+	{
+		Step();
 	}
 	EndSimulation();
 }
@@ -28,17 +50,28 @@ void Engine::Run()
 void Engine::BeginSimulation()
 {
 	m_IsRunning = true;
+	m_FramePipeline = std::make_unique<FramePipeline>(*m_Window, m_PipelineDepth);
 	m_TaskManager->BeginSimulation();
 }
 
-void Engine::Tick()
+void Engine::Step()
 {
-	float deltaTime = float(m_Timer.GetElapsedSeconds());
-	// Make sure we consume all messages coming from the window first
+	// pump the window once per frame, whether or not the simulation steps
 	m_Window->UpdateMessages();
-	BeginFrame();
-	Update(deltaTime);
-	EndFrame();
+
+	// expose every event received since the last frame to the tasks, the first step of the frame releases them
+	// and a frame without any step keeps them for the next one
+	EventQueue& events = m_Window->GetEventQueue();
+	events.BeginFrame();
+	if (events.Contains(WindowEventType::Quit))
+	{
+		m_IsRunning = false;
+	}
+
+	// with a fixed time step Tick runs zero, one or several times
+	m_Timer.Tick([&]() {
+		Tick();
+	});
 
 	// now that all logic has been updated, update rendering
 	// don't try to render anything before the first update
@@ -46,7 +79,33 @@ void Engine::Tick()
 	{
 		return;
 	}
-	m_Window->Render();
+	SubmitRender();
+}
+
+void Engine::Tick()
+{
+	float deltaTime = float(m_Timer.GetElapsedSeconds());
+	BeginFrame();
+	Update(deltaTime);
+	EndFrame();
+}
+
+void Engine::SubmitRender()
+{
+	// with a pipelined engine this waits for the render thread when it is too far behind
+	RenderSnapshot& snapshot = m_FramePipeline->BeginSnapshot();
+	snapshot.m_FrameIndex = m_FramePipeline->GetSubmittedFrameCount();
+	snapshot.m_SimulationFrame = m_Timer.GetFrameCount();
+	snapshot.m_TotalSeconds = m_Timer.GetTotalSeconds();
+	snapshot.m_InterpolationAlpha = m_Timer.GetInterpolationAlpha();
+	// a render thread does not belong to the job system, it records alone
+	snapshot.m_JobSystem = m_PipelineDepth == 0 ? &m_TaskManager->GetJobSystem() : nullptr;
+
+	// the tasks fill the bucket of this slot, the render thread may still be reading the others
+	RenderBucket& bucket = m_FramePipeline->GetSnapshotBucket();
+	m_TaskManager->RecordDraws(bucket);
+	bucket.Sort();
+	m_FramePipeline->Submit();
 }
 
 void Engine::BeginFrame()
@@ -62,9 +121,14 @@ void Engine::Update(const float deltaTime)
 void Engine::EndFrame()
 {
 	m_TaskManager->EndFrame();
+	m_Window->GetEventQueue().EndFrame();
 }
 
 void Engine::EndSimulation()
 {
 	m_TaskManager->EndSimulation();
+
+	// every frame simulated has to be on screen before leaving
+	m_FramePipeline->Flush();
+	m_FramePipeline.reset();
 }
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstdint>
+
 #include "Core/Memory/UniquePtr.h"
 #include "Tasks/TaskManager.h"
-#include "Window/Window.h"
+#include "Window/IWindow.h"
+#include "Engine/Clock.h"
+#include "Engine/FramePipeline.h"
 #include "Engine/StepTimer.h"
 #include "Core/NonCopyable.h"
 
@@ -10,17 +14,36 @@ class Engine : private NonCopyable
 {
 public:
     Engine() = default;
-    ~Engine() = default;
+    ~Engine();
+
+    // Any window implementation, e.g. a HeadlessWindow to run without a display
+    void SetWindow(UniquePtr<IWindow>&& window);
+
+    // The clock must outlive the engine, a VirtualClock makes the simulation deterministic
+    void SetClock(IClock& clock);
 
-    void SetWindowInit(Window::WindowInit&& windowInit);
+    // How many frames the simulation can run ahead of rendering, 0 renders on the simulation thread
+    // With a depth of 1 the simulation of frame N + 1 runs while the render thread draws frame N
+    // The window must support Render being called from another thread, applied on the next Run
+    void SetPipelineDepth(uint32_t depth) { m_PipelineDepth = depth; }
 
     void Init();
     void Run();
 
+    // Run a fixed number of timer ticks, as fast as the clock allows
+    void RunFrames(uint64_t frameCount);
+
+    [[nodiscard]] TaskManager& GetTaskManager() const { return *m_TaskManager; }
+    [[nodiscard]] const DX::StepTimer& GetTimer() const { return m_Timer; }
+    // Configure the fixed time step, the sub step budget or the adaptive rate before running
+    [[nodiscard]] DX::StepTimer& GetTimer() { return m_Timer; }
+
 private:
     void BeginSimulation();
 
+    void Step();
     void Tick();
+    void SubmitRender();
     void BeginFrame();
     void Update(const float deltaTime);
     void EndFrame();
@@ -29,7 +52,10 @@ private:
 
 private:
     UniquePtr<TaskManager> m_TaskManager{};
-    UniquePtr<Window> m_Window{};
+    UniquePtr<IWindow> m_Window{};
+
+    UniquePtr<FramePipeline> m_FramePipeline{};
+    uint32_t m_PipelineDepth{0};
 
     DX::StepTimer m_Timer;
     bool m_IsRunning{false};
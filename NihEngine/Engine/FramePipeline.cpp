@@ -0,0 +1,103 @@
+#include "Engine/FramePipeline.h"
+
+#include <algorithm>
+
+#include "Window/IWindow.h"
+
+FramePipeline::FramePipeline(IWindow& window, uint32_t depth)
+	: m_Window(window)
+	, m_Depth(std::min(depth, MaxDepth))
+{
+	if (m_Depth > 0)
+	{
+		m_RenderThread = std::thread([this]() { RenderLoop(); });
+	}
+}
+
+FramePipeline::~FramePipeline()
+{
+	if (!m_RenderThread.joinable())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_IsRunning = false;
+	}
+	m_SubmittedSignal.notify_one();
+	m_RenderThread.join();
+}
+
+RenderSnapshot& FramePipeline::BeginSnapshot()
+{
+	if (m_Depth > 0)
+	{
+		// the slot we are about to write was used depth + 1 frames ago, it must have been rendered
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_RenderedSignal.wait(lock, [this]() { return m_SubmittedCount - m_RenderedCount <= m_Depth; });
+	}
+
+	const uint32_t slot = static_cast<uint32_t>(m_SubmittedCount % GetSlotCount());
+	m_Buckets[slot].Clear();
+	m_Snapshots[slot].m_Bucket = &m_Buckets[slot];
+	return m_Snapshots[slot];
+}
+
+void FramePipeline::Submit()
+{
+	if (m_Depth == 0)
+	{
+		m_Window.Render(m_Snapshots[0]);
+		m_SubmittedCount++;
+		m_RenderedCount++;
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_SubmittedCount++;
+	}
+	m_SubmittedSignal.notify_one();
+}
+
+void FramePipeline::Flush()
+{
+	if (m_Depth == 0)
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_RenderedSignal.wait(lock, [this]() { return m_RenderedCount == m_SubmittedCount; });
+}
+
+uint64_t FramePipeline::GetRenderedFrameCount() const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_RenderedCount;
+}
+
+void FramePipeline::RenderLoop()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while (true)
+	{
+		m_SubmittedSignal.wait(lock, [this]() { return m_RenderedCount < m_SubmittedCount || !m_IsRunning; });
+		if (m_RenderedCount == m_SubmittedCount)
+		{
+			// only leave once everything submitted has been rendered
+			return;
+		}
+
+		const RenderSnapshot& snapshot = m_Snapshots[m_RenderedCount % GetSlotCount()];
+
+		// the simulation never writes a submitted slot, rendering can happen outside of the lock
+		lock.unlock();
+		m_Window.Render(snapshot);
+		lock.lock();
+
+		m_RenderedCount++;
+		m_RenderedSignal.notify_one();
+	}
+}
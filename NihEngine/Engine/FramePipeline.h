@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "Core/NonCopyable.h"
+#include "Render/RenderBucket.h"
+#include "Window/RenderSnapshot.h"
+
+class IWindow;
+
+/*
+* Hands render snapshots from the simulation to the window
+* With a depth of 0 every snapshot is rendered inline when submitted
+* With a depth of N a render thread draws the snapshots while the simulation runs up to N frames ahead of it,
+* the snapshots live in a ring of N + 1 slots so the one being written is never the one being read
+* Each slot has its own bucket of draws, filled with the snapshot and kept alive until it has been rendered
+*/
+class FramePipeline : private NonCopyable
+{
+public:
+	static constexpr uint32_t MaxDepth = 3;
+
+	FramePipeline(IWindow& window, uint32_t depth);
+	~FramePipeline();
+
+	[[nodiscard]] uint32_t GetDepth() const { return m_Depth; }
+
+	// Slot for the next frame, blocks while the render thread is too far behind
+	[[nodiscard]] RenderSnapshot& BeginSnapshot();
+	// Bucket of the slot returned by BeginSnapshot, cleared when the slot is reused
+	[[nodiscard]] RenderBucket& GetSnapshotBucket() { return m_Buckets[m_SubmittedCount % GetSlotCount()]; }
+	// The snapshot must not be touched after being submitted
+	void Submit();
+
+	// Wait until every submitted snapshot has been rendered
+	void Flush();
+
+	[[nodiscard]] uint64_t GetSubmittedFrameCount() const { return m_SubmittedCount; }
+	[[nodiscard]] uint64_t GetRenderedFrameCount() const;
+
+private:
+	[[nodiscard]] uint32_t GetSlotCount() const { return m_Depth + 1; }
+
+	void RenderLoop();
+
+	IWindow& m_Window;
+	uint32_t m_Depth;
+
+	RenderSnapshot m_Snapshots[MaxDepth + 1];
+	RenderBucket m_Buckets[MaxDepth + 1];
+
+	// only written by the simulation thread, and by the render thread for the rendered count, under the mutex
+	uint64_t m_SubmittedCount{0};
+	uint64_t m_RenderedCount{0};
+	bool m_IsRunning{true};
+
+	mutable std::mutex m_Mutex;
+	std::condition_variable m_SubmittedSignal;
+	std::condition_variable m_RenderedSignal;
+	std::thread m_RenderThread;
+};
@@ -1,27 +1,45 @@
 #pragma once
 
+#include <cstdint>
+#include <cstdlib>
+
+#include "Engine/Clock.h"
+
 namespace DX
 {
     class StepTimer
     {
     public:
-        StepTimer()
+        explicit StepTimer(IClock& clock = SteadyClock::Get())
             : m_elapsedTicks(0)
             , m_totalTicks(0)
             , m_leftOverTicks(0)
             , m_frameCount(0)
             , m_framesPerSecond(0)
             , m_framesThisSecond(0)
-            , m_qpcSecondCounter(0)
+            , m_secondCounter(0)
             , m_isFixedTimeStep(false)
             , m_targetElapsedTicks(0)
+            , m_baseTargetElapsedTicks(0)
+            , m_maxSubSteps(0)
+            , m_droppedTicks(0)
+            , m_isAdaptiveTimeStep(false)
+            , m_maxTargetElapsedTicks(0)
+            , m_overloadedFrames(0)
+            , m_relaxedFrames(0)
         {
-            if (!QueryPerformanceFrequency(&m_qpcFrequency) || !QueryPerformanceCounter(&m_qpcLastTime))
-            {
-                // we should assert here if we can't initialize
-            }
+            SetClock(clock);
+        }
 
-            m_qpcMaxDelta = static_cast<uint64_t>(m_qpcFrequency.QuadPart / 10);
+        // Changing the clock restarts the time measurement
+        void SetClock(IClock& clock)
+        {
+            m_clock = &clock;
+            m_clockFrequency = clock.GetFrequency();
+            m_clockLastTime = clock.GetTicks();
+
+            // clamp the delta to 1/10th of a second to avoid huge updates after a breakpoint
+            m_clockMaxDelta = m_clockFrequency / 10;
         }
 
         uint64_t GetElapsedTicks() const { return m_elapsedTicks; }
@@ -36,8 +54,42 @@ namespace DX
 
         void SetFixedTimeStep(bool isFixedTimeStep) { m_isFixedTimeStep = isFixedTimeStep; }
 
-        void SetTargetElapsedTicks(uint64_t targetElapsed) { m_targetElapsedTicks = targetElapsed; }
-        void SetTargetElapsedSeconds(double targetElapsed) { m_targetElapsedTicks = SecondsToTicks(targetElapsed); }
+        void SetTargetElapsedTicks(uint64_t targetElapsed) { m_targetElapsedTicks = m_baseTargetElapsedTicks = targetElapsed; }
+        void SetTargetElapsedSeconds(double targetElapsed) { SetTargetElapsedTicks(SecondsToTicks(targetElapsed)); }
+
+        // Current fixed step, differs from the requested one while the adaptive mode lowers the simulation rate
+        uint64_t GetTargetElapsedTicks() const { return m_targetElapsedTicks; }
+        double GetSimulationRate() const { return m_targetElapsedTicks > 0 ? TicksPerSeconds / static_cast<double>(m_targetElapsedTicks) : 0.0; }
+
+        // Maximum number of fixed updates per Tick, 0 means no limit
+        // Time that does not fit in the budget is dropped, so slow frames cannot schedule ever more updates
+        void SetMaxSubSteps(uint32_t maxSubSteps) { m_maxSubSteps = maxSubSteps; }
+        uint64_t GetDroppedTicks() const { return m_droppedTicks; }
+
+        // When the sub step budget keeps being exceeded, lower the simulation rate down to minSimulationRate,
+        // and come back to the requested rate once frames are cheap again
+        void SetAdaptiveTimeStep(bool isAdaptive, double minSimulationRate)
+        {
+            m_isAdaptiveTimeStep = isAdaptive;
+            m_maxTargetElapsedTicks = minSimulationRate > 0.0 ? SecondsToTicks(1.0 / minSimulationRate) : 0;
+            m_overloadedFrames = 0;
+            m_relaxedFrames = 0;
+            if (!isAdaptive)
+            {
+                m_targetElapsedTicks = m_baseTargetElapsedTicks;
+            }
+        }
+
+        // How far we are between the last fixed update and the next one, in [0, 1)
+        // Render with it to interpolate between the last two simulated states, 1 with a variable time step
+        double GetInterpolationAlpha() const
+        {
+            if (!m_isFixedTimeStep || m_targetElapsedTicks == 0)
+            {
+                return 1.0;
+            }
+            return static_cast<double>(m_leftOverTicks) / static_cast<double>(m_targetElapsedTicks);
+        }
 
         static constexpr uint64_t TicksPerSeconds = 10'000'000;
         static constexpr double TicksToSeconds(uint64_t ticks) { return static_cast<double>(ticks) / TicksPerSeconds; }
@@ -45,36 +97,33 @@ namespace DX
 
         void ResetElapsedTime()
         {
-            if (!QueryPerformanceCounter(&m_qpcLastTime))
-            {
-                // we should assert here
-            }
+            m_clockLastTime = m_clock->GetTicks();
 
             m_leftOverTicks = 0;
             m_framesPerSecond = 0;
             m_framesThisSecond = 0;
-            m_qpcSecondCounter = 0;
+            m_secondCounter = 0;
         }
 
         template<typename TUpdate>
         void Tick(const TUpdate& update)
         {
-            LARGE_INTEGER currentTime;
-            if (!QueryPerformanceCounter(&currentTime))
-            {
-                // we should assert here
-            }
+            const uint64_t currentTime = m_clock->GetTicks();
 
-            uint64_t deltaTime = static_cast<uint64_t>(currentTime.QuadPart - m_qpcLastTime.QuadPart);
+            uint64_t deltaTime = currentTime - m_clockLastTime;
 
-            m_qpcLastTime = currentTime;
-            m_qpcSecondCounter = deltaTime;
+            m_clockLastTime = currentTime;
+            m_secondCounter += deltaTime;
 
-            if (deltaTime > m_qpcMaxDelta)
+            if (deltaTime > m_clockMaxDelta)
             {
-                deltaTime = m_qpcMaxDelta;
+                deltaTime = m_clockMaxDelta;
             }
 
+            // Convert the clock units into our canonical tick format
+            deltaTime *= TicksPerSeconds;
+            deltaTime /= m_clockFrequency;
+
             const uint32_t lastFrameCount = m_frameCount;
 
             if (m_isFixedTimeStep)
@@ -95,15 +144,32 @@ namespace DX
 
                 m_leftOverTicks += deltaTime;
 
+                uint32_t subSteps = 0;
                 while (m_leftOverTicks >= m_targetElapsedTicks)
                 {
+                    if (m_maxSubSteps > 0 && subSteps == m_maxSubSteps)
+                    {
+                        // Out of budget: drop the whole steps we are late by but keep the fraction
+                        // of a step so the interpolation alpha stays continuous
+                        const uint64_t remainder = m_leftOverTicks % m_targetElapsedTicks;
+                        m_droppedTicks += m_leftOverTicks - remainder;
+                        m_leftOverTicks = remainder;
+                        break;
+                    }
+
                     m_elapsedTicks = m_targetElapsedTicks;
                     m_totalTicks += m_targetElapsedTicks;
                     m_leftOverTicks -= m_targetElapsedTicks;
                     m_frameCount++;
+                    subSteps++;
 
                     update();
                 }
+
+                if (m_isAdaptiveTimeStep)
+                {
+                    AdaptTimeStep(subSteps);
+                }
             }
             else
             {
@@ -122,17 +188,50 @@ namespace DX
                 m_framesThisSecond++;
             }
 
-            if (m_qpcSecondCounter >= static_cast<uint64_t>(m_qpcFrequency.QuadPart))
+            if (m_secondCounter >= m_clockFrequency)
             {
                 m_framesPerSecond = m_framesThisSecond;
                 m_framesThisSecond = 0;
-                m_qpcSecondCounter %= static_cast<uint64_t>(m_qpcFrequency.QuadPart);
+                m_secondCounter %= m_clockFrequency;
             }
         }
     private:
-        LARGE_INTEGER m_qpcFrequency;
-        LARGE_INTEGER m_qpcLastTime;
-        uint64_t m_qpcMaxDelta;
+        // Number of consecutive frames needed before changing the simulation rate
+        static constexpr uint32_t OverloadedFramesBeforeSlowDown = 30;
+        static constexpr uint32_t RelaxedFramesBeforeSpeedUp = 120;
+
+        void AdaptTimeStep(uint32_t subSteps)
+        {
+            const bool isOverloaded = m_maxSubSteps > 0 ? subSteps >= m_maxSubSteps : subSteps > 2;
+            m_overloadedFrames = isOverloaded ? m_overloadedFrames + 1 : 0;
+            m_relaxedFrames = subSteps <= 1 ? m_relaxedFrames + 1 : 0;
+
+            if (m_overloadedFrames >= OverloadedFramesBeforeSlowDown && m_targetElapsedTicks < m_maxTargetElapsedTicks)
+            {
+                // run 25% less simulation steps per second
+                m_targetElapsedTicks = m_targetElapsedTicks + m_targetElapsedTicks / 3;
+                if (m_targetElapsedTicks > m_maxTargetElapsedTicks)
+                {
+                    m_targetElapsedTicks = m_maxTargetElapsedTicks;
+                }
+                m_overloadedFrames = 0;
+                m_relaxedFrames = 0;
+            }
+            else if (m_relaxedFrames >= RelaxedFramesBeforeSpeedUp && m_targetElapsedTicks > m_baseTargetElapsedTicks)
+            {
+                m_targetElapsedTicks = m_targetElapsedTicks - m_targetElapsedTicks / 4;
+                if (m_targetElapsedTicks < m_baseTargetElapsedTicks)
+                {
+                    m_targetElapsedTicks = m_baseTargetElapsedTicks;
+                }
+                m_relaxedFrames = 0;
+            }
+        }
+
+        IClock* m_clock;
+        uint64_t m_clockFrequency;
+        uint64_t m_clockLastTime;
+        uint64_t m_clockMaxDelta;
 
         uint64_t m_elapsedTicks;
         uint64_t m_totalTicks;
@@ -141,9 +240,18 @@ namespace DX
         uint32_t m_frameCount;
         uint32_t m_framesPerSecond;
         uint32_t m_framesThisSecond;
-        uint64_t m_qpcSecondCounter;
+        uint64_t m_secondCounter;
 
         bool m_isFixedTimeStep;
         uint64_t m_targetElapsedTicks;
+        uint64_t m_baseTargetElapsedTicks;
+
+        uint32_t m_maxSubSteps;
+        uint64_t m_droppedTicks;
+
+        bool m_isAdaptiveTimeStep;
+        uint64_t m_maxTargetElapsedTicks;
+        uint32_t m_overloadedFrames;
+        uint32_t m_relaxedFrames;
     };
-}
\ No newline at end of file
+}
@@ -26,7 +26,7 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     windowInit.m_Heigth = 1920;
     windowInit.m_Width = 1080;
 
-    engine->SetWindowInit(std::move(windowInit));
+    engine->SetWindow(std::make_unique<Window>(std::move(windowInit)));
 
     engine->Init();
     engine->Run();
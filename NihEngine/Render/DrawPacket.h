@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "Core/Math/Mat4.h"
+
+/*
+* Everything a backend needs to issue one draw, plain data that is copied into the render buckets
+* Pipelines, materials and meshes are indices into tables owned by the backend
+*/
+struct DrawPacket
+{
+	uint32_t m_Pipeline{0};
+	uint32_t m_Material{0};
+	uint32_t m_Mesh{0};
+	uint32_t m_IndexCount{0};
+	uint32_t m_FirstIndex{0};
+	int32_t m_BaseVertex{0};
+	uint32_t m_InstanceCount{1};
+	uint32_t m_Padding{0};
+	Mat4 m_World;
+};
+
+static_assert(std::is_trivially_copyable_v<DrawPacket>, "Draw packets are copied around as raw memory");
+
+/*
+* 64 bits key deciding the order of the draws, the packets of a bucket are sorted by increasing key
+* Opaque draws are grouped by state then sorted front to back, translucent ones back to front before anything else:
+*	opaque       | layer 4 | pass 4 | pipeline 12 | material 20 | depth 24 |
+*	translucent  | layer 4 | pass 4 | inverted depth 24 | pipeline 12 | material 20 |
+*/
+namespace SortKey
+{
+	inline constexpr uint32_t LayerBits = 4;
+	inline constexpr uint32_t PassBits = 4;
+	inline constexpr uint32_t PipelineBits = 12;
+	inline constexpr uint32_t MaterialBits = 20;
+	inline constexpr uint32_t DepthBits = 24;
+
+	inline constexpr uint32_t MaxDepth = (1u << DepthBits) - 1;
+
+	// Depth in [0, 1] from the near plane to the far plane, clamped
+	[[nodiscard]] constexpr uint32_t QuantizeDepth(float depth)
+	{
+		depth = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+		return static_cast<uint32_t>(depth * static_cast<float>(MaxDepth));
+	}
+
+	[[nodiscard]] constexpr uint64_t MakeOpaque(uint32_t layer, uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t depth)
+	{
+		return (uint64_t(layer & ((1u << LayerBits) - 1)) << 60)
+			| (uint64_t(pass & ((1u << PassBits) - 1)) << 56)
+			| (uint64_t(pipeline & ((1u << PipelineBits) - 1)) << 44)
+			| (uint64_t(material & ((1u << MaterialBits) - 1)) << 24)
+			| uint64_t(depth & MaxDepth);
+	}
+
+	[[nodiscard]] constexpr uint64_t MakeTranslucent(uint32_t layer, uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t depth)
+	{
+		return (uint64_t(layer & ((1u << LayerBits) - 1)) << 60)
+			| (uint64_t(pass & ((1u << PassBits) - 1)) << 56)
+			| (uint64_t(MaxDepth - (depth & MaxDepth)) << 32)
+			| (uint64_t(pipeline & ((1u << PipelineBits) - 1)) << 20)
+			| uint64_t(material & ((1u << MaterialBits) - 1));
+	}
+
+	[[nodiscard]] constexpr uint32_t GetLayer(uint64_t key) { return static_cast<uint32_t>(key >> 60); }
+	[[nodiscard]] constexpr uint32_t GetPass(uint64_t key) { return static_cast<uint32_t>(key >> 56) & ((1u << PassBits) - 1); }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+struct DrawPacket;
+
+/*
+* Translates sorted draw packets into a graphics API
+* RenderBucket::Submit only calls SetPipeline and SetMaterial when they change from one packet to the next
+*/
+class IRenderBackend
+{
+public:
+	virtual ~IRenderBackend() = default;
+
+	virtual void Begin(size_t packetCount) = 0;
+	virtual void SetPipeline(uint32_t pipeline) = 0;
+	virtual void SetMaterial(uint32_t material) = 0;
+	virtual void Draw(const DrawPacket& packet) = 0;
+	virtual void End() = 0;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Render/DrawPacket.h"
+#include "Render/IRenderBackend.h"
+
+// Backend that only counts what it is asked, to test and benchmark the buckets without a GPU
+class NullRenderBackend : public IRenderBackend
+{
+public:
+	void Begin(size_t) override { ++m_SubmitCount; }
+	void SetPipeline(uint32_t pipeline) override
+	{
+		++m_PipelineChanges;
+		m_Checksum = m_Checksum * 31 + pipeline;
+	}
+	void SetMaterial(uint32_t material) override
+	{
+		++m_MaterialChanges;
+		m_Checksum = m_Checksum * 31 + material;
+	}
+	void Draw(const DrawPacket& packet) override
+	{
+		++m_DrawCount;
+		m_Checksum = m_Checksum * 31 + packet.m_Mesh + packet.m_IndexCount;
+	}
+	void End() override {}
+
+	[[nodiscard]] size_t GetSubmitCount() const { return m_SubmitCount; }
+	[[nodiscard]] size_t GetPipelineChanges() const { return m_PipelineChanges; }
+	[[nodiscard]] size_t GetMaterialChanges() const { return m_MaterialChanges; }
+	[[nodiscard]] size_t GetDrawCount() const { return m_DrawCount; }
+	// Depends on the order of the calls, so the work cannot be optimized away
+	[[nodiscard]] uint64_t GetChecksum() const { return m_Checksum; }
+
+private:
+	size_t m_SubmitCount{0};
+	size_t m_PipelineChanges{0};
+	size_t m_MaterialChanges{0};
+	size_t m_DrawCount{0};
+	uint64_t m_Checksum{0};
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Render/RenderBucket.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+/*
+* Records the sorted packets of a bucket into several backends at once, typically one command list each
+* The packets are cut into contiguous ranges, executing the backends in range order draws exactly what Submit would
+*/
+namespace ParallelSubmit
+{
+	// Below this, a range costs more to set up and execute than it saves in recording
+	inline constexpr size_t MinPacketsPerRange = 512;
+
+	[[nodiscard]] inline uint32_t GetRangeCount(size_t packetCount, uint32_t maxRanges)
+	{
+		const size_t wanted = (packetCount + MinPacketsPerRange - 1) / MinPacketsPerRange;
+		const size_t count = wanted < maxRanges ? wanted : maxRanges;
+		return count > 0 ? static_cast<uint32_t>(count) : 1;
+	}
+
+	// Range index of rangeCount, the sizes differ by one packet at most
+	[[nodiscard]] constexpr IndexRange GetRange(size_t packetCount, uint32_t rangeCount, uint32_t index)
+	{
+		return IndexRange{ packetCount * index / rangeCount, packetCount * (index + 1) / rangeCount };
+	}
+
+	// getBackend(uint32_t range) returns the IRenderBackend recording the range, called from the workers
+	template<typename GetBackend>
+	void Run(JobSystem& jobSystem, const RenderBucket& bucket, uint32_t rangeCount, GetBackend&& getBackend)
+	{
+		const size_t packetCount = bucket.GetSortedSize();
+		ParallelFor(jobSystem, IndexRange{ 0, rangeCount }, 1, [&](size_t index)
+		{
+			const uint32_t range = static_cast<uint32_t>(index);
+			bucket.Submit(getBackend(range), GetRange(packetCount, rangeCount, range));
+		});
+	}
+}
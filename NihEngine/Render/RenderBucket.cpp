@@ -0,0 +1,144 @@
+#include "Render/RenderBucket.h"
+
+#include <cstring>
+#include <utility>
+
+namespace
+{
+	constexpr uint32_t DigitBits = 8;
+	constexpr uint32_t DigitCount = 1u << DigitBits;
+	constexpr uint32_t PassCount = 64 / DigitBits;
+
+	/*
+	* LSD radix sort of the keys, carrying the values along, stable
+	* All the histograms are built in one read of the keys, the passes where every key has the same digit
+	* (the layer and the pass most of the time) are skipped. The result is in keys and values
+	*/
+	template<typename Value>
+	void RadixSort(Vector<uint64_t>& keys, Vector<Value>& values, Vector<uint64_t>& scratchKeys, Vector<Value>& scratchValues)
+	{
+		const size_t count = keys.GetSize();
+		scratchKeys.Resize(count);
+		scratchValues.Resize(count);
+
+		uint32_t histograms[PassCount][DigitCount];
+		std::memset(histograms, 0, sizeof(histograms));
+		for (uint64_t key : keys)
+		{
+			for (uint32_t pass = 0; pass < PassCount; ++pass)
+			{
+				histograms[pass][(key >> (pass * DigitBits)) & (DigitCount - 1)]++;
+			}
+		}
+
+		for (uint32_t pass = 0; pass < PassCount; ++pass)
+		{
+			uint32_t* histogram = histograms[pass];
+			const uint32_t shift = pass * DigitBits;
+			if (histogram[(keys[0] >> shift) & (DigitCount - 1)] == count)
+			{
+				continue;
+			}
+
+			uint32_t offset = 0;
+			for (uint32_t digit = 0; digit < DigitCount; ++digit)
+			{
+				const uint32_t digitCount = histogram[digit];
+				histogram[digit] = offset;
+				offset += digitCount;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint32_t position = histogram[(keys[i] >> shift) & (DigitCount - 1)]++;
+				scratchKeys[position] = keys[i];
+				scratchValues[position] = values[i];
+			}
+			std::swap(keys, scratchKeys);
+			std::swap(values, scratchValues);
+		}
+	}
+}
+
+RenderBucket::RenderBucket(uint32_t writerCount)
+	: m_WriterCount(writerCount)
+	, m_Writers(std::make_unique<Writer[]>(writerCount))
+{
+}
+
+RenderBucket::~RenderBucket() = default;
+
+size_t RenderBucket::GetSize() const
+{
+	size_t size = 0;
+	for (uint32_t i = 0; i < m_WriterCount; ++i)
+	{
+		size += m_Writers[i].m_Keys.GetSize();
+	}
+	return size;
+}
+
+void RenderBucket::Sort()
+{
+	m_SortedKeys.Clear();
+	m_SortedPackets.Clear();
+	m_SortedKeys.Reserve(GetSize());
+	m_SortedPackets.Reserve(GetSize());
+
+	// only the keys and pointers move, the packets stay where they were recorded
+	for (uint32_t i = 0; i < m_WriterCount; ++i)
+	{
+		const Writer& writer = m_Writers[i];
+		for (size_t packet = 0; packet < writer.m_Keys.GetSize(); ++packet)
+		{
+			m_SortedKeys.PushBackUnchecked(writer.m_Keys[packet]);
+			m_SortedPackets.PushBackUnchecked(&writer.m_Packets[packet]);
+		}
+	}
+
+	if (m_SortedKeys.GetSize() > 1)
+	{
+		RadixSort(m_SortedKeys, m_SortedPackets, m_ScratchKeys, m_ScratchPackets);
+	}
+}
+
+void RenderBucket::Submit(IRenderBackend& backend, IndexRange range) const
+{
+	NIH_ASSERT(range.m_End <= m_SortedPackets.GetSize());
+	backend.Begin(range.IsEmpty() ? 0 : range.GetSize());
+
+	bool isFirst = true;
+	uint32_t pipeline = 0;
+	uint32_t material = 0;
+	for (size_t i = range.m_Begin; i < range.m_End; ++i)
+	{
+		const DrawPacket* packet = m_SortedPackets[i];
+		if (isFirst || packet->m_Pipeline != pipeline)
+		{
+			pipeline = packet->m_Pipeline;
+			backend.SetPipeline(pipeline);
+			// a new pipeline can come with a new root signature, the material bindings are set again
+			isFirst = true;
+		}
+		if (isFirst || packet->m_Material != material)
+		{
+			material = packet->m_Material;
+			backend.SetMaterial(material);
+		}
+		isFirst = false;
+		backend.Draw(*packet);
+	}
+
+	backend.End();
+}
+
+void RenderBucket::Clear()
+{
+	for (uint32_t i = 0; i < m_WriterCount; ++i)
+	{
+		m_Writers[i].m_Keys.Clear();
+		m_Writers[i].m_Packets.Clear();
+	}
+	m_SortedKeys.Clear();
+	m_SortedPackets.Clear();
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/CacheLine.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Core/NonCopyable.h"
+#include "Render/DrawPacket.h"
+#include "Render/IRenderBackend.h"
+#include "System/Assert.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+/*
+* Draws of one frame, recorded in any order by any number of threads and submitted sorted by key
+* Each recording thread has its own writer, pushing needs no synchronization as long as two threads never share
+* a writer index, the worker index of the job system is the usual choice.
+* Sort gathers the writers and radix sorts the keys, Submit then walks the packets in key order.
+* Packets with equal keys are drawn in an unspecified order
+*/
+class RenderBucket : private NonCopyable
+{
+public:
+	explicit RenderBucket(uint32_t writerCount = JobSystem::MaxWorkers);
+	~RenderBucket();
+
+	[[nodiscard]] uint32_t GetWriterCount() const { return m_WriterCount; }
+
+	void Push(uint32_t writer, uint64_t key, const DrawPacket& packet)
+	{
+		NIH_ASSERT(writer < m_WriterCount);
+		Writer& storage = m_Writers[writer];
+		storage.m_Keys.PushBack(key);
+		storage.m_Packets.PushBack(packet);
+	}
+
+	/*
+	* With the writer of the calling worker, only threads of the job system may use it: the thread that created it
+	* is worker 0, any other thread would race with it and must pass a writer index it owns instead
+	*/
+	void Push(const JobSystem& jobSystem, uint64_t key, const DrawPacket& packet)
+	{
+		const uint32_t workerIndex = jobSystem.GetCurrentWorkerIndex();
+		NIH_ASSERT(workerIndex != JobSystem::InvalidWorkerIndex);
+		Push(workerIndex, key, packet);
+	}
+
+	// Packets recorded since the last Clear, sorted or not
+	[[nodiscard]] size_t GetSize() const;
+
+	// Must not run while packets are pushed
+	void Sort();
+
+	// Valid after Sort, in key order
+	[[nodiscard]] size_t GetSortedSize() const { return m_SortedKeys.GetSize(); }
+	[[nodiscard]] uint64_t GetSortedKey(size_t index) const { return m_SortedKeys[index]; }
+	[[nodiscard]] const DrawPacket& GetSortedPacket(size_t index) const { return *m_SortedPackets[index]; }
+
+	void Submit(IRenderBackend& backend) const { Submit(backend, IndexRange{ 0, GetSortedSize() }); }
+
+	// Part of the sorted packets, the state is set again by the first packet so ranges can be recorded separately
+	void Submit(IRenderBackend& backend, IndexRange range) const;
+
+	// Keeps the storage for the next frame
+	void Clear();
+
+private:
+	struct alignas(CacheLineSize) Writer
+	{
+		Vector<uint64_t> m_Keys;
+		Vector<DrawPacket> m_Packets;
+	};
+
+	uint32_t m_WriterCount;
+	UniquePtr<Writer[]> m_Writers;
+
+	Vector<uint64_t> m_SortedKeys;
+	Vector<const DrawPacket*> m_SortedPackets;
+	Vector<uint64_t> m_ScratchKeys;
+	Vector<const DrawPacket*> m_ScratchPackets;
+};
@@ -0,0 +1,292 @@
+#include "Scene/TransformHierarchy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "System/Assert.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace
+{
+	// Moves every element to its new position, order[newIndex] is the old index
+	template<typename T>
+	void Permute(Vector<T>& values, const Vector<uint32_t>& order, Vector<T>& scratch)
+	{
+		scratch.Clear();
+		scratch.Reserve(order.GetSize());
+		for (uint32_t oldIndex : order)
+		{
+			scratch.PushBack(values[oldIndex]);
+		}
+		std::swap(values, scratch);
+	}
+}
+
+TransformHierarchy::Handle TransformHierarchy::Create(const Mat4& local, Handle parent)
+{
+	const uint32_t index = static_cast<uint32_t>(m_Locals.GetSize());
+	const Handle node = m_Indices.Insert(index);
+
+	m_Locals.PushBack(local);
+	m_Worlds.PushBack(local);
+	m_Parents.PushBack(parent.IsValid() ? GetIndex(parent) : InvalidIndex);
+	m_Handles.PushBack(node);
+	m_Dirty.PushBack(1);
+	m_IsSorted = false;
+	return node;
+}
+
+void TransformHierarchy::Destroy(Handle node)
+{
+	if (!Contains(node))
+	{
+		return;
+	}
+	Sort();
+
+	// descendants come after their ancestors, one forward pass marks the whole subtree
+	const uint32_t first = GetIndex(node);
+	Vector<uint8_t> isRemoved;
+	isRemoved.Assign(m_Locals.GetSize(), 0);
+	isRemoved[first] = 1;
+	for (size_t i = first + 1; i < m_Locals.GetSize(); ++i)
+	{
+		isRemoved[i] = m_Parents[i] != InvalidIndex && isRemoved[m_Parents[i]];
+	}
+	Compact(isRemoved);
+}
+
+void TransformHierarchy::SetParent(Handle node, Handle parent)
+{
+	const uint32_t index = GetIndex(node);
+	const uint32_t parentIndex = parent.IsValid() ? GetIndex(parent) : InvalidIndex;
+#if defined(ENABLE_ASSERT)
+	// the new parent must not be in the subtree of the node
+	for (uint32_t ancestor = parentIndex; ancestor != InvalidIndex; ancestor = m_Parents[ancestor])
+	{
+		NIH_ASSERT(ancestor != index);
+	}
+#endif
+	m_Parents[index] = parentIndex;
+	m_Dirty[index] = 1;
+	m_IsSorted = false;
+}
+
+void TransformHierarchy::SetLocal(Handle node, const Mat4& local)
+{
+	const uint32_t index = GetIndex(node);
+	m_Locals[index] = local;
+	m_Dirty[index] = 1;
+}
+
+TransformHierarchy::Handle TransformHierarchy::GetParent(Handle node) const
+{
+	const uint32_t parent = m_Parents[GetIndex(node)];
+	return parent != InvalidIndex ? m_Handles[parent] : Handle();
+}
+
+void TransformHierarchy::Update(JobSystem* jobSystem)
+{
+	Sort();
+
+	m_UpdatedCount = 0;
+	for (size_t level = 0; level + 1 < m_LevelStarts.GetSize(); ++level)
+	{
+		const size_t begin = m_LevelStarts[level];
+		const size_t end = m_LevelStarts[level + 1];
+		if (jobSystem == nullptr || end - begin < 2 * ParallelGrain)
+		{
+			m_UpdatedCount += UpdateRange(begin, end);
+			continue;
+		}
+
+		// the level before is done, every parent of this level is up to date
+		std::atomic<size_t> updatedCount{0};
+		ParallelFor(*jobSystem, IndexRange{ begin, end }, ParallelGrain, [this, &updatedCount](IndexRange range)
+		{
+			updatedCount.fetch_add(UpdateRange(range.m_Begin, range.m_End), std::memory_order_relaxed);
+		});
+		m_UpdatedCount += updatedCount.load(std::memory_order_relaxed);
+	}
+
+	std::memset(m_Dirty.GetData(), 0, m_Dirty.GetSize());
+}
+
+size_t TransformHierarchy::UpdateRange(size_t begin, size_t end)
+{
+	size_t count = 0;
+	for (size_t i = begin; i < end; ++i)
+	{
+		const uint32_t parent = m_Parents[i];
+		if (parent == InvalidIndex)
+		{
+			if (m_Dirty[i])
+			{
+				m_Worlds[i] = m_Locals[i];
+				++count;
+			}
+			continue;
+		}
+
+		// the flag of the parent is still set when it was recomputed in this pass
+		if (m_Dirty[i] | m_Dirty[parent])
+		{
+			m_Worlds[i] = m_Locals[i] * m_Worlds[parent];
+			m_Dirty[i] = 1;
+			++count;
+		}
+	}
+	return count;
+}
+
+uint32_t TransformHierarchy::GetIndex(Handle node) const
+{
+	const uint32_t* index = m_Indices.Get(node);
+	NIH_ASSERT(index != nullptr);
+	return *index;
+}
+
+void TransformHierarchy::Sort()
+{
+	if (m_IsSorted)
+	{
+		return;
+	}
+	m_IsSorted = true;
+
+	const uint32_t count = static_cast<uint32_t>(m_Locals.GetSize());
+	constexpr uint32_t UnknownDepth = ~0u;
+
+	// depth of every node, walking up to the first ancestor with a known depth
+	Vector<uint32_t> depths;
+	depths.Assign(count, UnknownDepth);
+	Vector<uint32_t> path;
+	uint32_t levelCount = 0;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		uint32_t node = i;
+		while (node != InvalidIndex && depths[node] == UnknownDepth)
+		{
+			path.PushBack(node);
+			node = m_Parents[node];
+		}
+		uint32_t depth = node == InvalidIndex ? 0 : depths[node] + 1;
+		while (!path.IsEmpty())
+		{
+			depths[path.Back()] = depth++;
+			path.PopBack();
+		}
+		levelCount = std::max(levelCount, depths[i] + 1);
+	}
+
+	// counting sort by depth gives the level starts
+	m_LevelStarts.Assign(levelCount + 1, 0);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		m_LevelStarts[depths[i] + 1]++;
+	}
+	for (uint32_t level = 0; level < levelCount; ++level)
+	{
+		m_LevelStarts[level + 1] += m_LevelStarts[level];
+	}
+
+	Vector<uint32_t> order;
+	order.Resize(count);
+	Vector<uint32_t> cursors = m_LevelStarts;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		order[cursors[depths[i]]++] = i;
+	}
+
+	// inside a level, children follow the order of their parents so siblings are contiguous
+	Vector<uint32_t> newIndices;
+	newIndices.Resize(count);
+	for (uint32_t level = 0; level < levelCount; ++level)
+	{
+		uint32_t* first = order.GetData() + m_LevelStarts[level];
+		uint32_t* last = order.GetData() + m_LevelStarts[level + 1];
+		if (level > 0)
+		{
+			std::stable_sort(first, last, [this, &newIndices](uint32_t a, uint32_t b)
+			{
+				return newIndices[m_Parents[a]] < newIndices[m_Parents[b]];
+			});
+		}
+		for (uint32_t* node = first; node != last; ++node)
+		{
+			newIndices[*node] = static_cast<uint32_t>(node - order.GetData());
+		}
+	}
+
+	Vector<Mat4> matrices;
+	Permute(m_Locals, order, matrices);
+	Permute(m_Worlds, order, matrices);
+	Vector<Handle> handles;
+	Permute(m_Handles, order, handles);
+	Vector<uint8_t> flags;
+	Permute(m_Dirty, order, flags);
+	Vector<uint32_t> parents;
+	Permute(m_Parents, order, parents);
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		if (m_Parents[i] != InvalidIndex)
+		{
+			m_Parents[i] = newIndices[m_Parents[i]];
+		}
+		*m_Indices.Get(m_Handles[i]) = i;
+	}
+}
+
+void TransformHierarchy::Compact(const Vector<uint8_t>& isRemoved)
+{
+	const uint32_t count = static_cast<uint32_t>(m_Locals.GetSize());
+	Vector<uint32_t> newIndices;
+	newIndices.Resize(count);
+
+	// removing a subtree keeps the depth order, only the level starts move
+	uint32_t kept = 0;
+	size_t level = 0;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		for (; level < m_LevelStarts.GetSize() && m_LevelStarts[level] == i; ++level)
+		{
+			m_LevelStarts[level] = kept;
+		}
+
+		if (isRemoved[i])
+		{
+			m_Indices.Erase(m_Handles[i]);
+			newIndices[i] = InvalidIndex;
+			continue;
+		}
+
+		newIndices[i] = kept;
+		m_Locals[kept] = m_Locals[i];
+		m_Worlds[kept] = m_Worlds[i];
+		m_Handles[kept] = m_Handles[i];
+		m_Dirty[kept] = m_Dirty[i];
+		// parents come first, their new index is already known
+		m_Parents[kept] = m_Parents[i] != InvalidIndex ? newIndices[m_Parents[i]] : InvalidIndex;
+		*m_Indices.Get(m_Handles[kept]) = kept;
+		++kept;
+	}
+	for (; level < m_LevelStarts.GetSize(); ++level)
+	{
+		m_LevelStarts[level] = kept;
+	}
+
+	// the deepest levels can be empty now
+	while (m_LevelStarts.GetSize() > 1 && m_LevelStarts[m_LevelStarts.GetSize() - 2] == kept)
+	{
+		m_LevelStarts.PopBack();
+	}
+
+	m_Locals.Resize(kept);
+	m_Worlds.Resize(kept);
+	m_Handles.Resize(kept);
+	m_Dirty.Resize(kept);
+	m_Parents.Resize(kept);
+}
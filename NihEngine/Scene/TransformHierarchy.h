@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/Containers/SlotMap.h"
+#include "Core/Containers/Vector.h"
+#include "Core/Math/Mat4.h"
+#include "Core/NonCopyable.h"
+
+class JobSystem;
+
+/*
+* Parent child transforms, world = local * parent world
+* Nodes are stored as parallel arrays sorted by depth, and by parent inside a depth, so a parent is always updated
+* before its children in one linear pass and siblings sit next to each other.
+* Changing a local transform marks the node dirty, Update only recomputes the dirty nodes and their descendants.
+* Creating and reparenting nodes only flag the order as stale, it is rebuilt by the next Update.
+* World transforms are valid for the nodes that existed at the last Update
+*/
+class TransformHierarchy : private NonCopyable
+{
+public:
+	using Handle = Handle64;
+
+	TransformHierarchy() = default;
+	~TransformHierarchy() = default;
+
+	// An invalid parent makes a root
+	Handle Create(const Mat4& local, Handle parent = Handle());
+
+	// Destroys the node and all its descendants, O(node count)
+	void Destroy(Handle node);
+
+	void SetParent(Handle node, Handle parent);
+	void SetLocal(Handle node, const Mat4& local);
+
+	[[nodiscard]] bool Contains(Handle node) const { return m_Indices.Contains(node); }
+	[[nodiscard]] size_t GetSize() const { return m_Locals.GetSize(); }
+	[[nodiscard]] Handle GetParent(Handle node) const;
+	[[nodiscard]] const Mat4& GetLocal(Handle node) const { return m_Locals[GetIndex(node)]; }
+	[[nodiscard]] const Mat4& GetWorld(Handle node) const { return m_Worlds[GetIndex(node)]; }
+
+	/*
+	* Recomputes the world transforms of the dirty subtrees
+	* Levels run one after the other, the nodes of a level are spread over the job system when there is one
+	*/
+	void Update(JobSystem* jobSystem = nullptr);
+
+	// Depth levels and world transforms recomputed by the last Update
+	[[nodiscard]] size_t GetLevelCount() const { return m_LevelStarts.IsEmpty() ? 0 : m_LevelStarts.GetSize() - 1; }
+	[[nodiscard]] size_t GetUpdatedCount() const { return m_UpdatedCount; }
+
+private:
+	static constexpr uint32_t InvalidIndex = ~0u;
+	// Nodes per job when a level is split
+	static constexpr size_t ParallelGrain = 2048;
+
+	[[nodiscard]] uint32_t GetIndex(Handle node) const;
+
+	// Rebuilds the depth order after nodes were created or reparented
+	void Sort();
+
+	// Keeps the nodes whose flag is 0, in order
+	void Compact(const Vector<uint8_t>& isRemoved);
+
+	// Recomputes the dirty nodes of [begin, end) of one level, returns how many
+	size_t UpdateRange(size_t begin, size_t end);
+
+	// Parallel arrays, one element per node
+	Vector<Mat4> m_Locals;
+	Vector<Mat4> m_Worlds;
+	Vector<uint32_t> m_Parents;
+	Vector<Handle> m_Handles;
+	Vector<uint8_t> m_Dirty;
+
+	// handle to position in the arrays
+	SlotMap<uint32_t, Handle> m_Indices;
+
+	// first node of every depth, plus the end of the last one
+	Vector<uint32_t> m_LevelStarts;
+	bool m_IsSorted{true};
+	size_t m_UpdatedCount{0};
+};
@@ -0,0 +1,115 @@
+#include "System/CpuFeatures.h"
+
+#if defined(NIH_SSE2)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace
+{
+#if defined(NIH_SSE2)
+	void CpuId(uint32_t leaf, uint32_t subLeaf, uint32_t registers[4])
+	{
+#if defined(_MSC_VER)
+		int values[4];
+		__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+		for (int i = 0; i < 4; ++i)
+		{
+			registers[i] = static_cast<uint32_t>(values[i]);
+		}
+#else
+		__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+	}
+
+	uint64_t ReadExtendedControlRegister()
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		uint32_t low;
+		uint32_t high;
+		__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+	}
+#endif
+
+	CpuFeatures DetectCpuFeatures()
+	{
+		CpuFeatures features;
+#if defined(NIH_SSE2)
+		uint32_t registers[4] = {};
+		CpuId(0, 0, registers);
+		const uint32_t maxLeaf = registers[0];
+		if (maxLeaf < 1)
+		{
+			return features;
+		}
+
+		CpuId(1, 0, registers);
+		const uint32_t ecx = registers[2];
+		features.m_Sse41 = (ecx & (1u << 19)) != 0;
+		features.m_Popcnt = (ecx & (1u << 23)) != 0;
+
+		// the OS must save the XMM and YMM registers on context switches before AVX can be used
+		const bool osSavesAvx = (ecx & (1u << 27)) != 0 && (ReadExtendedControlRegister() & 0x6) == 0x6;
+		const bool avx = (ecx & (1u << 28)) != 0 && osSavesAvx;
+		features.m_Fma = avx && (ecx & (1u << 12)) != 0;
+
+		if (maxLeaf >= 7)
+		{
+			CpuId(7, 0, registers);
+			features.m_Avx2 = avx && (registers[1] & (1u << 5)) != 0;
+		}
+#endif
+		return features;
+	}
+}
+
+const CpuFeatures& GetCpuFeatures()
+{
+	static const CpuFeatures features = DetectCpuFeatures();
+	return features;
+}
+
+SimdLevel GetSupportedSimdLevel()
+{
+	const CpuFeatures& features = GetCpuFeatures();
+	if (features.m_Avx2 && features.m_Fma && features.m_Popcnt)
+	{
+		return SimdLevel::Avx2;
+	}
+	if (features.m_Sse41)
+	{
+		return SimdLevel::Sse41;
+	}
+#if defined(NIH_SSE2)
+	return SimdLevel::Sse2;
+#elif defined(NIH_NEON)
+	return SimdLevel::Neon;
+#else
+	return SimdLevel::Scalar;
+#endif
+}
+
+const char* GetSimdLevelName(SimdLevel level)
+{
+	switch (level)
+	{
+	case SimdLevel::Scalar:
+		return "scalar";
+	case SimdLevel::Sse2:
+		return "sse2";
+	case SimdLevel::Sse41:
+		return "sse4.1";
+	case SimdLevel::Avx2:
+		return "avx2";
+	case SimdLevel::Neon:
+		return "neon";
+	}
+	return "unknown";
+}
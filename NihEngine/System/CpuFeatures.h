@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Config.h"
+
+// Instruction set levels the SIMD kernels are compiled for, each x86 level includes the previous ones
+enum class SimdLevel : uint8_t
+{
+	Scalar = 0,
+	// the 4 wide baseline of every x64 CPU, what the math library uses there
+	Sse2 = 1,
+	Sse41 = 2,
+	// AVX2 with FMA and POPCNT
+	Avx2 = 3,
+	// the 4 wide baseline of every ARM64 CPU, ARM builds never report the x86 levels
+	Neon = 4,
+};
+
+// Short lower case name, for logs and benchmark labels
+[[nodiscard]] const char* GetSimdLevelName(SimdLevel level);
+
+/*
+* What the CPU and the OS support, read once with cpuid
+* AVX2 also needs the OS to save the YMM registers, which xgetbv tells
+*/
+struct CpuFeatures
+{
+	bool m_Sse41{false};
+	bool m_Popcnt{false};
+	bool m_Avx2{false};
+	bool m_Fma{false};
+};
+
+[[nodiscard]] const CpuFeatures& GetCpuFeatures();
+
+// Best level both the CPU and this build support
+[[nodiscard]] SimdLevel GetSupportedSimdLevel();
@@ -0,0 +1,302 @@
+#include "System/Log.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "Core/Memory/CacheLine.h"
+#include "Core/Memory/UniquePtr.h"
+
+#if defined(_WIN32)
+#include "framework.h"
+#endif
+
+namespace
+{
+	constexpr uint32_t MaxThreads = 128;
+	constexpr uint32_t RecordsPerThread = 1024;
+	constexpr size_t MaxMessageLength = 512;
+	constexpr auto DrainPeriod = std::chrono::milliseconds(2);
+
+	// Single producer (the owning thread) single consumer (whoever holds the drain lock) ring buffer
+	struct ThreadLog
+	{
+		alignas(CacheLineSize) std::atomic<uint32_t> m_Head{0};
+		alignas(CacheLineSize) std::atomic<uint32_t> m_Tail{0};
+		uint32_t m_ThreadIndex{0};
+		LogRecord m_Records[RecordsPerThread];
+	};
+
+	void DefaultSink(LogSeverity, const char* message)
+	{
+#if defined(_WIN32)
+		OutputDebugStringA(message);
+#else
+		std::fputs(message, stderr);
+#endif
+	}
+
+	struct LogState
+	{
+		UniquePtr<ThreadLog> m_ThreadLogs[MaxThreads];
+		std::atomic<uint32_t> m_ThreadCount{0};
+		// Buffers of exited threads, handed to the next new ones, under the drain lock
+		uint32_t m_FreeThreadLogs[MaxThreads]{};
+		uint32_t m_FreeCount{0};
+		std::atomic<uint64_t> m_DroppedCount{0};
+		std::atomic<Log::Sink> m_Sink{&DefaultSink};
+		const std::chrono::steady_clock::time_point m_StartTime{std::chrono::steady_clock::now()};
+
+		std::mutex m_DrainMutex;
+		std::thread m_DrainThread;
+		std::atomic<bool> m_IsRunning{false};
+	};
+
+	LogState& GetState()
+	{
+		static LogState state;
+		return state;
+	}
+
+	thread_local ThreadLog* t_ThreadLog = nullptr;
+	// Set once the thread started destroying its thread locals, it cannot own a buffer anymore
+	thread_local bool t_IsExiting = false;
+
+	// Gives the buffer back when the thread exits, the records still in it are drained as usual
+	struct ThreadLogOwner
+	{
+		~ThreadLogOwner()
+		{
+			t_IsExiting = true;
+			if (t_ThreadLog == nullptr)
+			{
+				return;
+			}
+
+			LogState& state = GetState();
+			std::lock_guard lock(state.m_DrainMutex);
+			state.m_FreeThreadLogs[state.m_FreeCount++] = t_ThreadLog->m_ThreadIndex;
+			t_ThreadLog = nullptr;
+		}
+	};
+	thread_local ThreadLogOwner t_ThreadLogOwner;
+
+	ThreadLog* GetThreadLog()
+	{
+		if (t_ThreadLog != nullptr)
+		{
+			return t_ThreadLog;
+		}
+		if (t_IsExiting)
+		{
+			return nullptr;
+		}
+
+		// Only happens once per thread, the buffer is published once it is fully built
+		LogState& state = GetState();
+		std::lock_guard lock(state.m_DrainMutex);
+		if (state.m_FreeCount > 0)
+		{
+			// the previous owner is gone, the lock orders its last records before ours
+			t_ThreadLog = state.m_ThreadLogs[state.m_FreeThreadLogs[--state.m_FreeCount]].get();
+		}
+		else
+		{
+			const uint32_t index = state.m_ThreadCount.load(std::memory_order_relaxed);
+			if (index >= MaxThreads)
+			{
+				return nullptr;
+			}
+			state.m_ThreadLogs[index] = std::make_unique<ThreadLog>();
+			state.m_ThreadLogs[index]->m_ThreadIndex = index;
+			state.m_ThreadCount.store(index + 1, std::memory_order_release);
+			t_ThreadLog = state.m_ThreadLogs[index].get();
+		}
+
+		// registers the destructor giving the buffer back
+		(void)&t_ThreadLogOwner;
+		return t_ThreadLog;
+	}
+
+	const char* GetSeverityName(LogSeverity severity)
+	{
+		switch (severity)
+		{
+		case LogSeverity::Trace: return "Trace";
+		case LogSeverity::Info: return "Info";
+		case LogSeverity::Warning: return "Warning";
+		case LogSeverity::Error: return "Error";
+		default: return "Unknown";
+		}
+	}
+
+	size_t Append(char* buffer, size_t length, const char* format, auto... values)
+	{
+		if (length >= MaxMessageLength)
+		{
+			return length;
+		}
+		const int written = std::snprintf(buffer + length, MaxMessageLength - length, format, values...);
+		if (written <= 0)
+		{
+			return length;
+		}
+		// snprintf returns the length it wanted to write, not what fitted
+		const size_t newLength = length + static_cast<size_t>(written);
+		return newLength < MaxMessageLength ? newLength : MaxMessageLength - 1;
+	}
+
+	size_t AppendArgument(char* buffer, size_t length, const LogArgument& argument)
+	{
+		switch (argument.m_Type)
+		{
+		case LogArgument::Type::Int: return Append(buffer, length, "%lld", static_cast<long long>(argument.m_Int));
+		case LogArgument::Type::UInt: return Append(buffer, length, "%llu", static_cast<unsigned long long>(argument.m_UInt));
+		case LogArgument::Type::Float: return Append(buffer, length, "%f", argument.m_Float);
+		case LogArgument::Type::Bool: return Append(buffer, length, "%s", argument.m_UInt != 0 ? "true" : "false");
+		case LogArgument::Type::String: return Append(buffer, length, "%s", argument.m_String != nullptr ? argument.m_String : "(null)");
+		case LogArgument::Type::Pointer: return Append(buffer, length, "%p", argument.m_Pointer);
+		default: return length;
+		}
+	}
+
+	void FormatRecord(const LogRecord& record, char* buffer)
+	{
+		size_t length = Append(buffer, 0, "[%.6f][%u][%s] ", static_cast<double>(record.m_Timestamp) / 1'000'000'000.0,
+			record.m_ThreadIndex, GetSeverityName(record.m_Severity));
+
+		uint32_t argumentIndex = 0;
+		for (const char* c = record.m_Format; *c != '\0' && length < MaxMessageLength - 1; ++c)
+		{
+			if (c[0] == '{' && c[1] == '}' && argumentIndex < record.m_ArgumentCount)
+			{
+				length = AppendArgument(buffer, length, record.m_Arguments[argumentIndex++]);
+				++c;
+			}
+			else
+			{
+				buffer[length++] = *c;
+			}
+		}
+
+		if (length > MaxMessageLength - 2)
+		{
+			length = MaxMessageLength - 2;
+		}
+		buffer[length++] = '\n';
+		buffer[length] = '\0';
+	}
+
+	// Caller must hold the drain lock
+	void DrainLocked(LogState& state)
+	{
+		char message[MaxMessageLength];
+		const Log::Sink sink = state.m_Sink.load();
+
+		const uint32_t threadCount = state.m_ThreadCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < threadCount; ++i)
+		{
+			ThreadLog& threadLog = *state.m_ThreadLogs[i];
+			uint32_t tail = threadLog.m_Tail.load(std::memory_order_relaxed);
+			const uint32_t head = threadLog.m_Head.load(std::memory_order_acquire);
+			for (; tail != head; ++tail)
+			{
+				FormatRecord(threadLog.m_Records[tail % RecordsPerThread], message);
+				sink(threadLog.m_Records[tail % RecordsPerThread].m_Severity, message);
+			}
+			threadLog.m_Tail.store(tail, std::memory_order_release);
+		}
+	}
+
+	void DrainLoop()
+	{
+		LogState& state = GetState();
+		while (state.m_IsRunning.load(std::memory_order_relaxed))
+		{
+			{
+				std::lock_guard lock(state.m_DrainMutex);
+				DrainLocked(state);
+			}
+			std::this_thread::sleep_for(DrainPeriod);
+		}
+	}
+}
+
+namespace Log
+{
+	void Init()
+	{
+		LogState& state = GetState();
+		if (state.m_IsRunning.exchange(true))
+		{
+			return;
+		}
+		state.m_DrainThread = std::thread(&DrainLoop);
+	}
+
+	void Shutdown()
+	{
+		LogState& state = GetState();
+		if (state.m_IsRunning.exchange(false))
+		{
+			state.m_DrainThread.join();
+		}
+		Flush();
+	}
+
+	void Flush()
+	{
+		LogState& state = GetState();
+		std::lock_guard lock(state.m_DrainMutex);
+		DrainLocked(state);
+	}
+
+	void SetSink(Sink sink)
+	{
+		GetState().m_Sink.store(sink != nullptr ? sink : &DefaultSink);
+	}
+
+	uint64_t GetDroppedCount()
+	{
+		return GetState().m_DroppedCount.load(std::memory_order_relaxed);
+	}
+
+	namespace Detail
+	{
+		LogRecord* BeginRecord()
+		{
+			ThreadLog* threadLog = GetThreadLog();
+			if (threadLog == nullptr)
+			{
+				GetState().m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			const uint32_t head = threadLog->m_Head.load(std::memory_order_relaxed);
+			if (head - threadLog->m_Tail.load(std::memory_order_acquire) >= RecordsPerThread)
+			{
+				// never block the frame on logging, the record is lost instead
+				GetState().m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			LogRecord* record = &threadLog->m_Records[head % RecordsPerThread];
+			record->m_ThreadIndex = threadLog->m_ThreadIndex;
+			return record;
+		}
+
+		void EndRecord()
+		{
+			ThreadLog* threadLog = t_ThreadLog;
+			threadLog->m_Head.store(threadLog->m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		uint64_t GetTimestamp()
+		{
+			const auto elapsed = std::chrono::steady_clock::now() - GetState().m_StartTime;
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+		}
+	}
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "Config.h"
+
+enum class LogSeverity : uint8_t
+{
+	Trace = 0,
+	Info = 1,
+	Warning = 2,
+	Error = 3,
+};
+
+// One argument of a log record, stored as raw bits and only formatted when the record is drained
+struct LogArgument
+{
+	enum class Type : uint8_t
+	{
+		Int,
+		UInt,
+		Float,
+		Bool,
+		String,
+		Pointer,
+	};
+
+	union
+	{
+		int64_t m_Int;
+		uint64_t m_UInt;
+		double m_Float;
+		const char* m_String;
+		const void* m_Pointer;
+	};
+	Type m_Type;
+};
+
+// Fixed size binary record, formatting happens on the drain thread
+struct LogRecord
+{
+	static constexpr uint32_t MaxArguments = 4;
+
+	uint64_t m_Timestamp{0};
+	const char* m_Format{nullptr};
+	// Buffer of the writing thread, given to another thread once it exits
+	uint32_t m_ThreadIndex{0};
+	LogSeverity m_Severity{LogSeverity::Info};
+	uint8_t m_ArgumentCount{0};
+	LogArgument m_Arguments[MaxArguments];
+};
+
+/*
+* Binary logger
+* Every thread writes fixed size records in its own lock free ring buffer, nothing is formatted nor allocated
+* on the calling thread. A background thread drains the buffers, formats the records and sends them to the sink.
+* Format strings use {} placeholders and, like string arguments, must outlive the record (string literals)
+*/
+namespace Log
+{
+	using Sink = void(*)(LogSeverity severity, const char* message);
+
+	// Start and stop the drain thread, Shutdown flushes what is left
+	void Init();
+	void Shutdown();
+
+	// Drain every buffer now on the calling thread
+	void Flush();
+
+	// Default sink is the debugger output on Windows and stderr elsewhere
+	void SetSink(Sink sink);
+
+	// Records lost because a thread buffer was full
+	[[nodiscard]] uint64_t GetDroppedCount();
+
+	namespace Detail
+	{
+		// Reserve the next record of the calling thread buffer, nullptr if it is full
+		LogRecord* BeginRecord();
+		void EndRecord();
+		uint64_t GetTimestamp();
+
+		template<typename T>
+		LogArgument MakeArgument(const T& value)
+		{
+			LogArgument argument;
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				argument.m_Type = LogArgument::Type::Bool;
+				argument.m_UInt = value ? 1 : 0;
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			{
+				argument.m_Type = LogArgument::Type::Int;
+				argument.m_Int = static_cast<int64_t>(value);
+			}
+			else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+			{
+				argument.m_Type = LogArgument::Type::UInt;
+				argument.m_UInt = static_cast<uint64_t>(value);
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				argument.m_Type = LogArgument::Type::Float;
+				argument.m_Float = static_cast<double>(value);
+			}
+			else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>)
+			{
+				argument.m_Type = LogArgument::Type::String;
+				argument.m_String = value;
+			}
+			else
+			{
+				static_assert(std::is_pointer_v<T>, "Log arguments must be numbers, booleans, pointers or string literals");
+				argument.m_Type = LogArgument::Type::Pointer;
+				argument.m_Pointer = value;
+			}
+			return argument;
+		}
+	}
+
+	template<typename... Args>
+	void Write(LogSeverity severity, const char* format, const Args&... args)
+	{
+		static_assert(sizeof...(Args) <= LogRecord::MaxArguments, "Too many log arguments");
+
+		LogRecord* record = Detail::BeginRecord();
+		if (record == nullptr)
+		{
+			return;
+		}
+
+		record->m_Timestamp = Detail::GetTimestamp();
+		record->m_Format = format;
+		record->m_Severity = severity;
+		record->m_ArgumentCount = static_cast<uint8_t>(sizeof...(Args));
+
+		[[maybe_unused]] uint32_t index = 0;
+		((record->m_Arguments[index++] = Detail::MakeArgument(args)), ...);
+		Detail::EndRecord();
+	}
+}
+
+// Arguments are not even evaluated when the severity is compiled out
+// with a minimum of 0 nothing is, and comparing against it would be always true
+#if NIH_LOG_MIN_SEVERITY > 0
+#define NIH_LOG(severity, ...) \
+	do \
+	{ \
+		if constexpr (static_cast<int>(severity) >= NIH_LOG_MIN_SEVERITY) \
+		{ \
+			Log::Write(severity, __VA_ARGS__); \
+		} \
+	} while (false)
+#else
+#define NIH_LOG(severity, ...) \
+	do \
+	{ \
+		Log::Write(severity, __VA_ARGS__); \
+	} while (false)
+#endif
+
+#define NIH_LOG_TRACE(...) NIH_LOG(LogSeverity::Trace, __VA_ARGS__)
+#define NIH_LOG_INFO(...) NIH_LOG(LogSeverity::Info, __VA_ARGS__)
+#define NIH_LOG_WARNING(...) NIH_LOG(LogSeverity::Warning, __VA_ARGS__)
+#define NIH_LOG_ERROR(...) NIH_LOG(LogSeverity::Error, __VA_ARGS__)
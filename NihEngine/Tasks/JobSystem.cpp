@@ -0,0 +1,197 @@
+#include "Tasks/JobSystem.h"
+
+#include <algorithm>
+
+#include "System/Assert.h"
+
+namespace
+{
+	// A thread only ever belongs to one job system
+	thread_local const JobSystem* t_JobSystem = nullptr;
+	thread_local uint32_t t_WorkerIndex = JobSystem::InvalidWorkerIndex;
+
+	// How many times an idle worker looks for work before going to sleep
+	constexpr uint32_t IdleSpinCount = 64;
+
+	uint32_t NextRandom(uint32_t& state)
+	{
+		// xorshift32, good enough to pick a victim
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+}
+
+JobSystem::JobSystem(uint32_t workerCount)
+{
+	if (workerCount == 0)
+	{
+		workerCount = std::thread::hardware_concurrency();
+	}
+	m_WorkerCount = std::clamp<uint32_t>(workerCount, 1, MaxWorkers);
+
+	m_Workers = std::make_unique<Worker[]>(m_WorkerCount);
+	for (uint32_t i = 0; i < m_WorkerCount; ++i)
+	{
+		m_Workers[i].m_RandomState = 0x9E3779B9u * (i + 1);
+	}
+
+	// the creating thread is worker 0, it only runs jobs while waiting on a counter
+	NIH_ASSERT(t_JobSystem == nullptr);
+	t_JobSystem = this;
+	t_WorkerIndex = 0;
+
+	m_Threads.Reserve(m_WorkerCount - 1);
+	for (uint32_t i = 1; i < m_WorkerCount; ++i)
+	{
+		m_Threads.EmplaceBack([this, i]() { WorkerLoop(i); });
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	m_IsRunning.store(false);
+	m_WakeSignal.fetch_add(1);
+	m_WakeSignal.notify_all();
+
+	for (std::thread& thread : m_Threads)
+	{
+		thread.join();
+	}
+
+	if (t_JobSystem == this)
+	{
+		t_JobSystem = nullptr;
+		t_WorkerIndex = InvalidWorkerIndex;
+	}
+}
+
+uint32_t JobSystem::GetCurrentWorkerIndex() const
+{
+	return t_JobSystem == this ? t_WorkerIndex : InvalidWorkerIndex;
+}
+
+size_t JobSystem::GetLocalQueueSize() const
+{
+	const uint32_t workerIndex = GetCurrentWorkerIndex();
+	return workerIndex != InvalidWorkerIndex ? m_Workers[workerIndex].m_Queue.GetSize() : 0;
+}
+
+void JobSystem::Schedule(Job& job, JobCounter& counter)
+{
+	NIH_ASSERT(job.m_Function != nullptr);
+
+	job.m_Counter = &counter;
+	counter.m_Value.fetch_add(1, std::memory_order_relaxed);
+
+	const uint32_t workerIndex = GetCurrentWorkerIndex();
+	if (workerIndex == InvalidWorkerIndex || !m_Workers[workerIndex].m_Queue.Push(&job))
+	{
+		// Foreign threads cannot push on a queue they do not own, and a full queue means
+		// there is already plenty of work to steal, both cases simply run the job now
+		Execute(job);
+		return;
+	}
+
+	m_PendingJobs.fetch_add(1);
+	WakeWorkers();
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+	const uint32_t workerIndex = GetCurrentWorkerIndex();
+	while (!counter.IsDone())
+	{
+		if (workerIndex == InvalidWorkerIndex || !TryRunJob(workerIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+bool JobSystem::TryRunJob(uint32_t workerIndex)
+{
+	Job* job = nullptr;
+	if (!m_Workers[workerIndex].m_Queue.Pop(job) && !TryStealJob(workerIndex, job))
+	{
+		return false;
+	}
+
+	m_PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+	Execute(*job);
+	return true;
+}
+
+bool JobSystem::TryStealJob(uint32_t workerIndex, Job*& job)
+{
+	if (m_WorkerCount == 1)
+	{
+		return false;
+	}
+
+	// start at a random victim so idle workers do not all hammer the same queue
+	const uint32_t start = NextRandom(m_Workers[workerIndex].m_RandomState) % m_WorkerCount;
+	for (uint32_t i = 0; i < m_WorkerCount; ++i)
+	{
+		const uint32_t victim = (start + i) % m_WorkerCount;
+		if (victim != workerIndex && m_Workers[victim].m_Queue.Steal(job))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void JobSystem::Execute(Job& job)
+{
+	// the job storage can be released as soon as the counter is decremented, read everything before
+	JobCounter* counter = job.m_Counter;
+	job.m_Function(job);
+	counter->m_Value.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void JobSystem::WakeWorkers()
+{
+	if (m_SleepingWorkers.load() > 0)
+	{
+		m_WakeSignal.fetch_add(1);
+		m_WakeSignal.notify_all();
+	}
+}
+
+void JobSystem::WorkerLoop(uint32_t workerIndex)
+{
+	t_JobSystem = this;
+	t_WorkerIndex = workerIndex;
+
+	uint32_t idleCount = 0;
+	while (m_IsRunning.load(std::memory_order_relaxed))
+	{
+		if (TryRunJob(workerIndex))
+		{
+			idleCount = 0;
+			continue;
+		}
+
+		if (++idleCount < IdleSpinCount)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		// Register as sleeping before checking for work, Schedule does the opposite
+		// so at least one of the two sides sees the other and no wake up is lost
+		const uint32_t wakeSignal = m_WakeSignal.load();
+		m_SleepingWorkers.fetch_add(1);
+		if (m_PendingJobs.load() == 0 && m_IsRunning.load())
+		{
+			m_WakeSignal.wait(wakeSignal);
+		}
+		m_SleepingWorkers.fetch_sub(1);
+		idleCount = 0;
+	}
+
+	t_JobSystem = nullptr;
+	t_WorkerIndex = InvalidWorkerIndex;
+}
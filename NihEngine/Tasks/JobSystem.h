@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Core/NonCopyable.h"
+#include "Tasks/WorkStealingDeque.h"
+
+/*
+* Counts the jobs that are still in flight
+* A counter must outlive every job scheduled against it, the usual way is to keep it on the stack and Wait on it
+*/
+struct JobCounter
+{
+	[[nodiscard]] bool IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; }
+
+	std::atomic<uint32_t> m_Value{0};
+};
+
+/*
+* Smallest unit of work the job system knows about
+* Jobs are never allocated by the job system, callers derive from Job to add a payload
+* and keep the storage alive until the counter they were scheduled with reaches zero
+*/
+struct Job
+{
+	using Function = void(*)(Job& job);
+
+	Function m_Function{nullptr};
+	JobCounter* m_Counter{nullptr};
+};
+
+/*
+* Work stealing thread pool
+* The thread that creates the job system is worker 0, every other worker owns a thread
+* Each worker owns a Chase-Lev deque: it pushes and pops its own jobs LIFO and steals FIFO from the others when idle
+*/
+class JobSystem : private NonCopyable
+{
+public:
+	static constexpr uint32_t MaxWorkers = 64;
+	static constexpr uint32_t InvalidWorkerIndex = ~0u;
+	static constexpr size_t QueueCapacity = 4096;
+
+	// 0 means one worker per hardware thread
+	explicit JobSystem(uint32_t workerCount = 0);
+	~JobSystem();
+
+	[[nodiscard]] uint32_t GetWorkerCount() const { return m_WorkerCount; }
+
+	// Index of the calling thread in this job system, InvalidWorkerIndex if the thread does not belong to it
+	[[nodiscard]] uint32_t GetCurrentWorkerIndex() const;
+
+	// Number of jobs waiting in the calling worker queue, used to decide if more work should be exposed
+	[[nodiscard]] size_t GetLocalQueueSize() const;
+
+	// Push the job on the calling worker queue, the job runs inline if the queue is full
+	void Schedule(Job& job, JobCounter& counter);
+
+	// Run pending jobs on the calling thread until the counter reaches zero
+	void Wait(const JobCounter& counter);
+
+private:
+	struct Worker
+	{
+		WorkStealingDeque<Job*, QueueCapacity> m_Queue;
+		uint32_t m_RandomState{0};
+	};
+
+	bool TryRunJob(uint32_t workerIndex);
+	bool TryStealJob(uint32_t workerIndex, Job*& job);
+	void Execute(Job& job);
+	void WakeWorkers();
+	void WorkerLoop(uint32_t workerIndex);
+
+	uint32_t m_WorkerCount{1};
+	UniquePtr<Worker[]> m_Workers;
+	Vector<std::thread> m_Threads;
+
+	alignas(CacheLineSize) std::atomic<uint32_t> m_PendingJobs{0};
+	alignas(CacheLineSize) std::atomic<uint32_t> m_SleepingWorkers{0};
+	std::atomic<uint32_t> m_WakeSignal{0};
+	std::atomic<bool> m_IsRunning{true};
+};
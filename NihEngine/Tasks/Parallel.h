@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Memory/CacheLine.h"
+#include "Tasks/JobSystem.h"
+
+// Half open range of indices [m_Begin, m_End)
+struct IndexRange
+{
+	[[nodiscard]] constexpr size_t GetSize() const { return m_End - m_Begin; }
+	[[nodiscard]] constexpr bool IsEmpty() const { return m_End <= m_Begin; }
+
+	size_t m_Begin{0};
+	size_t m_End{0};
+};
+
+namespace ParallelDetail
+{
+	// A range can be split at most once per bit of size_t, so a job never needs more children than that
+	constexpr uint32_t MaxSplits = 64;
+
+	template<typename Body>
+	void ProcessRange(JobSystem& jobSystem, IndexRange range, size_t grain, Body& body);
+
+	template<typename Body>
+	struct RangeJob : Job
+	{
+		static void Run(Job& job)
+		{
+			RangeJob& rangeJob = static_cast<RangeJob&>(job);
+			ProcessRange(*rangeJob.m_JobSystem, rangeJob.m_Range, rangeJob.m_Grain, *rangeJob.m_Body);
+		}
+
+		JobSystem* m_JobSystem{nullptr};
+		Body* m_Body{nullptr};
+		IndexRange m_Range{};
+		size_t m_Grain{1};
+	};
+
+	/*
+	* Lazy binary splitting: the range is only split in half when the local queue is empty,
+	* which means the other workers already stole everything we exposed and are hungry for more.
+	* Otherwise we keep working through it one grain at a time.
+	* Children live on this stack frame, which is why we wait for them before returning.
+	*/
+	template<typename Body>
+	void ProcessRange(JobSystem& jobSystem, IndexRange range, size_t grain, Body& body)
+	{
+		RangeJob<Body> children[MaxSplits];
+		uint32_t childCount = 0;
+		JobCounter counter;
+
+		while (range.GetSize() > grain)
+		{
+			if (childCount < MaxSplits && jobSystem.GetLocalQueueSize() == 0)
+			{
+				const size_t middle = range.m_Begin + range.GetSize() / 2;
+
+				RangeJob<Body>& child = children[childCount++];
+				child.m_Function = &RangeJob<Body>::Run;
+				child.m_JobSystem = &jobSystem;
+				child.m_Body = &body;
+				child.m_Range = { middle, range.m_End };
+				child.m_Grain = grain;
+				range.m_End = middle;
+
+				jobSystem.Schedule(child, counter);
+			}
+			else
+			{
+				body(IndexRange{ range.m_Begin, range.m_Begin + grain });
+				range.m_Begin += grain;
+			}
+		}
+
+		if (!range.IsEmpty())
+		{
+			body(range);
+		}
+
+		jobSystem.Wait(counter);
+	}
+
+	inline uint32_t GetPartialIndex(const JobSystem& jobSystem)
+	{
+		// threads outside of the job system run everything inline, they can borrow the first slot
+		const uint32_t workerIndex = jobSystem.GetCurrentWorkerIndex();
+		return workerIndex != JobSystem::InvalidWorkerIndex ? workerIndex : 0;
+	}
+}
+
+/*
+* Call function over every index of the range on the job system and wait for completion
+* function is either called with a size_t index or with an IndexRange of at most grain indices
+* Nothing is allocated, the jobs live on the stack of the threads running them
+*/
+template<typename Function>
+void ParallelFor(JobSystem& jobSystem, IndexRange range, size_t grain, Function&& function)
+{
+	if (range.IsEmpty())
+	{
+		return;
+	}
+	grain = grain > 0 ? grain : 1;
+
+	auto body = [&function](IndexRange chunk)
+	{
+		if constexpr (std::is_invocable_v<Function&, IndexRange>)
+		{
+			function(chunk);
+		}
+		else
+		{
+			for (size_t i = chunk.m_Begin; i < chunk.m_End; ++i)
+			{
+				function(i);
+			}
+		}
+	};
+
+	ParallelDetail::ProcessRange(jobSystem, range, grain, body);
+}
+
+/*
+* Reduce the range on the job system
+* reduce(IndexRange chunk, T accumulator) returns the accumulator updated with the chunk,
+* combine(T lhs, T rhs) merges two partial results.
+* Each worker accumulates in its own cache line, partials are combined in worker order at the end,
+* so combine must be associative and commutative for the result to be stable.
+*/
+template<typename T, typename Reduce, typename Combine>
+[[nodiscard]] T ParallelReduce(JobSystem& jobSystem, IndexRange range, size_t grain, const T& identity, Reduce&& reduce, Combine&& combine)
+{
+	struct alignas(CacheLineSize) Partial
+	{
+		T m_Value;
+	};
+
+	const uint32_t partialCount = jobSystem.GetWorkerCount();
+	alignas(Partial) unsigned char storage[sizeof(Partial) * JobSystem::MaxWorkers];
+	Partial* partials = reinterpret_cast<Partial*>(storage);
+	for (uint32_t i = 0; i < partialCount; ++i)
+	{
+		new (&partials[i]) Partial{ identity };
+	}
+
+	auto body = [&jobSystem, &reduce, partials](IndexRange chunk)
+	{
+		T& accumulator = partials[ParallelDetail::GetPartialIndex(jobSystem)].m_Value;
+		accumulator = reduce(chunk, std::move(accumulator));
+	};
+
+	if (!range.IsEmpty())
+	{
+		ParallelDetail::ProcessRange(jobSystem, range, grain > 0 ? grain : 1, body);
+	}
+
+	T result = identity;
+	for (uint32_t i = 0; i < partialCount; ++i)
+	{
+		result = combine(std::move(result), std::move(partials[i].m_Value));
+		partials[i].~Partial();
+	}
+	return result;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Core/Math/TransformBatch.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+/*
+* The TransformBatch kernels spread over the job system, each job runs the kernel on a contiguous range
+* The grain is in objects, a few thousand keeps the per job overhead well under the kernel cost
+*/
+namespace ParallelTransforms
+{
+	inline constexpr size_t DefaultGrain = 4096;
+
+	inline void MultiplyMatrices(JobSystem& jobSystem, const Mat4* locals, const Mat4& parent, Mat4* worlds, size_t count, size_t grain = DefaultGrain)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, count }, grain, [locals, &parent, worlds](IndexRange chunk)
+		{
+			TransformBatch::MultiplyMatrices(locals + chunk.m_Begin, parent, worlds + chunk.m_Begin, chunk.GetSize());
+		});
+	}
+
+	inline void MultiplyMatrices(JobSystem& jobSystem, const Mat4* locals, const Mat4* parents, Mat4* worlds, size_t count, size_t grain = DefaultGrain)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, count }, grain, [locals, parents, worlds](IndexRange chunk)
+		{
+			TransformBatch::MultiplyMatrices(locals + chunk.m_Begin, parents + chunk.m_Begin, worlds + chunk.m_Begin, chunk.GetSize());
+		});
+	}
+
+	inline void TransformPoints(JobSystem& jobSystem, const Mat4& matrix, ConstSoAPoints points, SoAPoints results, size_t count, size_t grain = DefaultGrain)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, count }, grain, [&matrix, points, results](IndexRange chunk)
+		{
+			TransformBatch::TransformPoints(matrix, points.Advance(chunk.m_Begin), results.Advance(chunk.m_Begin), chunk.GetSize());
+		});
+	}
+
+	inline void TransformBounds(JobSystem& jobSystem, const Mat4* matrices, ConstSoABounds localBounds, SoABounds worldBounds, size_t count, size_t grain = DefaultGrain)
+	{
+		ParallelFor(jobSystem, IndexRange{ 0, count }, grain, [matrices, localBounds, worldBounds](IndexRange chunk)
+		{
+			TransformBatch::TransformBounds(matrices + chunk.m_Begin, localBounds.Advance(chunk.m_Begin), worldBounds.Advance(chunk.m_Begin), chunk.GetSize());
+		});
+	}
+}
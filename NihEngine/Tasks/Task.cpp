@@ -8,3 +8,13 @@ Task::Task()
 Task::~Task()
 {
 }
+
+void Task::DeclareRead(TaskResource resource)
+{
+	m_Reads.PushBack(resource);
+}
+
+void Task::DeclareWrite(TaskResource resource)
+{
+	m_Writes.PushBack(resource);
+}
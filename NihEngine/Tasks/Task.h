@@ -1,4 +1,14 @@
 #pragma once
+
+#include <cstdint>
+
+#include "Core/Containers/SmallVector.h"
+
+class RenderBucket;
+
+// Identifies a piece of data shared between tasks, two tasks touching the same resource are ordered
+using TaskResource = uint64_t;
+
 class Task
 {
 public:
@@ -13,5 +23,28 @@ public:
 
 	virtual void Init() = 0;
 	virtual void Update(float deltaTime) = 0;
-};
 
+	/*
+	* Push the draws of the frame about to be rendered, once per rendered frame after the updates
+	* Called on the thread that created the job system, draws can also be pushed from jobs run on it
+	*/
+	virtual void RecordDraws(RenderBucket&) {}
+
+	/*
+	* Declare the data this task touches during Update
+	* Tasks that write a resource run after every task added before them that reads or writes it,
+	* tasks that only read a resource can run alongside each other
+	*/
+	void DeclareRead(TaskResource resource);
+	void DeclareWrite(TaskResource resource);
+
+	// Tasks rarely touch more than a few resources, the lists stay inside the task
+	using ResourceList = SmallVector<TaskResource, 4>;
+
+	[[nodiscard]] const ResourceList& GetReads() const { return m_Reads; }
+	[[nodiscard]] const ResourceList& GetWrites() const { return m_Writes; }
+
+private:
+	ResourceList m_Reads;
+	ResourceList m_Writes;
+};
@@ -0,0 +1,188 @@
+#include "Tasks/TaskGraph.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "System/Assert.h"
+
+void TaskGraph::Build(const Vector<Task*>& tasks)
+{
+	m_Nodes.Resize(tasks.GetSize());
+	m_Edges.Clear();
+	m_ResourceCount = 0;
+
+	for (uint32_t i = 0; i < static_cast<uint32_t>(tasks.GetSize()); ++i)
+	{
+		Node& node = m_Nodes[i];
+		node.m_Function = &TaskGraph::RunNode;
+		node.m_Graph = this;
+		node.m_Task = tasks[i];
+		node.m_DependencyCount = 0;
+		node.m_SuccessorCount = 0;
+
+		for (TaskResource resource : node.m_Task->GetReads())
+		{
+			ResourceState& state = GetResourceState(resource);
+			if (state.m_LastWriter >= 0)
+			{
+				AddEdge(static_cast<uint32_t>(state.m_LastWriter), i);
+			}
+			state.m_Readers.PushBack(i);
+		}
+
+		for (TaskResource resource : node.m_Task->GetWrites())
+		{
+			ResourceState& state = GetResourceState(resource);
+			// the readers already depend on the last writer, no need for a direct edge to it
+			if (state.m_LastWriter >= 0 && state.m_Readers.IsEmpty())
+			{
+				AddEdge(static_cast<uint32_t>(state.m_LastWriter), i);
+			}
+			for (uint32_t reader : state.m_Readers)
+			{
+				AddEdge(reader, i);
+			}
+			state.m_Readers.Clear();
+			state.m_LastWriter = static_cast<int32_t>(i);
+		}
+	}
+
+	// pack the edges per node, a resource shared several times between two tasks only counts once
+	std::sort(m_Edges.begin(), m_Edges.end());
+	m_Edges.Erase(std::unique(m_Edges.begin(), m_Edges.end()), m_Edges.end());
+
+	m_Successors.Resize(m_Edges.GetSize());
+	for (uint32_t i = 0; i < static_cast<uint32_t>(m_Edges.GetSize()); ++i)
+	{
+		const auto& [from, to] = m_Edges[i];
+		Node& fromNode = m_Nodes[from];
+		if (fromNode.m_SuccessorCount == 0)
+		{
+			fromNode.m_FirstSuccessor = i;
+		}
+		fromNode.m_SuccessorCount++;
+		m_Nodes[to].m_DependencyCount++;
+		m_Successors[i] = to;
+	}
+}
+
+void TaskGraph::Run(JobSystem& jobSystem, float deltaTime)
+{
+	if (m_Nodes.GetSize() > m_PendingDependenciesCapacity)
+	{
+		m_PendingDependenciesCapacity = m_Nodes.GetCapacity();
+		m_PendingDependencies = std::make_unique<std::atomic<uint32_t>[]>(m_PendingDependenciesCapacity);
+	}
+
+	for (size_t i = 0; i < m_Nodes.GetSize(); ++i)
+	{
+		m_PendingDependencies[i].store(m_Nodes[i].m_DependencyCount, std::memory_order_relaxed);
+	}
+
+	JobCounter counter;
+	m_JobSystem = &jobSystem;
+	m_Counter = &counter;
+	m_DeltaTime = deltaTime;
+
+	// only the roots are scheduled here, every other task is scheduled by its last dependency
+	for (Node& node : m_Nodes)
+	{
+		if (node.m_DependencyCount == 0)
+		{
+			jobSystem.Schedule(node, counter);
+		}
+	}
+	jobSystem.Wait(counter);
+
+	m_JobSystem = nullptr;
+	m_Counter = nullptr;
+
+	ComputeCriticalPath();
+}
+
+void TaskGraph::RunNode(Job& job)
+{
+	Node& node = static_cast<Node&>(job);
+	TaskGraph& graph = *node.m_Graph;
+
+	const auto start = std::chrono::steady_clock::now();
+	node.m_Task->Update(graph.m_DeltaTime);
+	node.m_DurationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+	for (uint32_t i = 0; i < node.m_SuccessorCount; ++i)
+	{
+		const uint32_t successor = graph.m_Successors[node.m_FirstSuccessor + i];
+		if (graph.m_PendingDependencies[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			graph.m_JobSystem->Schedule(graph.m_Nodes[successor], *graph.m_Counter);
+		}
+	}
+}
+
+TaskGraph::ResourceState& TaskGraph::GetResourceState(TaskResource resource)
+{
+	for (size_t i = 0; i < m_ResourceCount; ++i)
+	{
+		if (m_Resources[i].m_Resource == resource)
+		{
+			return m_Resources[i];
+		}
+	}
+
+	// states are recycled between builds to keep the readers storage around
+	if (m_ResourceCount == m_Resources.GetSize())
+	{
+		m_Resources.EmplaceBack();
+	}
+
+	ResourceState& state = m_Resources[m_ResourceCount++];
+	state.m_Resource = resource;
+	state.m_LastWriter = -1;
+	state.m_Readers.Clear();
+	return state;
+}
+
+void TaskGraph::AddEdge(uint32_t from, uint32_t to)
+{
+	// a task that reads and writes the same resource does not depend on itself
+	NIH_ASSERT(from <= to);
+	if (from != to)
+	{
+		m_Edges.EmplaceBack(from, to);
+	}
+}
+
+void TaskGraph::ComputeCriticalPath()
+{
+	// tasks are already topologically sorted since edges always go toward the task added last
+	m_PathCosts.Assign(m_Nodes.GetSize(), 0);
+	m_PathLengths.Assign(m_Nodes.GetSize(), 0);
+
+	int64_t criticalPathCost = 0;
+	uint32_t criticalPathLength = 0;
+	for (size_t i = 0; i < m_Nodes.GetSize(); ++i)
+	{
+		const Node& node = m_Nodes[i];
+		const int64_t cost = m_PathCosts[i] + node.m_DurationNs;
+		const uint32_t length = m_PathLengths[i] + 1;
+
+		if (cost > criticalPathCost || (cost == criticalPathCost && length > criticalPathLength))
+		{
+			criticalPathCost = cost;
+			criticalPathLength = length;
+		}
+
+		for (uint32_t j = 0; j < node.m_SuccessorCount; ++j)
+		{
+			const uint32_t successor = m_Successors[node.m_FirstSuccessor + j];
+			if (cost > m_PathCosts[successor] || (cost == m_PathCosts[successor] && length > m_PathLengths[successor]))
+			{
+				m_PathCosts[successor] = cost;
+				m_PathLengths[successor] = length;
+			}
+		}
+	}
+
+	m_CriticalPathSeconds = static_cast<double>(criticalPathCost) / 1'000'000'000.0;
+	m_CriticalPathTaskCount = criticalPathLength;
+}
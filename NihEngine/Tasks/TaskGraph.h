@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Core/NonCopyable.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Task.h"
+
+/*
+* Per frame dependency graph between tasks
+* Edges come from the resources each task declares, in the order the tasks were added:
+* read after write, write after read and write after write are ordered, everything else can overlap
+* Tasks are scheduled on the job system as soon as their last dependency is done
+*/
+class TaskGraph : private NonCopyable
+{
+public:
+	TaskGraph() = default;
+	~TaskGraph() = default;
+
+	// Rebuild the graph from the tasks declarations, storage is reused from frame to frame
+	void Build(const Vector<Task*>& tasks);
+
+	// Run every task of the graph and wait for all of them
+	void Run(JobSystem& jobSystem, float deltaTime);
+
+	[[nodiscard]] size_t GetTaskCount() const { return m_Nodes.GetSize(); }
+	[[nodiscard]] size_t GetEdgeCount() const { return m_Successors.GetSize(); }
+
+	// Longest chain of dependent tasks of the last Run, in time and in number of tasks
+	[[nodiscard]] double GetCriticalPathSeconds() const { return m_CriticalPathSeconds; }
+	[[nodiscard]] uint32_t GetCriticalPathTaskCount() const { return m_CriticalPathTaskCount; }
+
+private:
+	struct Node : Job
+	{
+		TaskGraph* m_Graph{nullptr};
+		Task* m_Task{nullptr};
+		uint32_t m_DependencyCount{0};
+		uint32_t m_FirstSuccessor{0};
+		uint32_t m_SuccessorCount{0};
+		int64_t m_DurationNs{0};
+	};
+
+	struct ResourceState
+	{
+		TaskResource m_Resource{0};
+		int32_t m_LastWriter{-1};
+		Vector<uint32_t> m_Readers;
+	};
+
+	static void RunNode(Job& job);
+
+	ResourceState& GetResourceState(TaskResource resource);
+	void AddEdge(uint32_t from, uint32_t to);
+	void ComputeCriticalPath();
+
+	Vector<Node> m_Nodes;
+	Vector<uint32_t> m_Successors;
+	Vector<ResourceState> m_Resources;
+	size_t m_ResourceCount{0};
+
+	// edges are gathered as (from, to) pairs before being packed per node
+	Vector<std::pair<uint32_t, uint32_t>> m_Edges;
+
+	UniquePtr<std::atomic<uint32_t>[]> m_PendingDependencies;
+	size_t m_PendingDependenciesCapacity{0};
+
+	JobSystem* m_JobSystem{nullptr};
+	JobCounter* m_Counter{nullptr};
+	float m_DeltaTime{0.0f};
+
+	Vector<int64_t> m_PathCosts;
+	Vector<uint32_t> m_PathLengths;
+	double m_CriticalPathSeconds{0.0};
+	uint32_t m_CriticalPathTaskCount{0};
+};
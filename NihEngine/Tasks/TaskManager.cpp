@@ -1,12 +1,11 @@
 #include "TaskManager.h"
 
-#include "Window/Window.h"
+#include "System/Log.h"
 #include "Tasks/Task.h"
 
-#include <iostream>
-
 TaskManager::TaskManager()
-	: m_IsRunning(false)
+	: m_JobSystem(std::make_unique<JobSystem>())
+	, m_IsRunning(false)
 {
 
 }
@@ -26,35 +25,46 @@ void TaskManager::Init()
 
 void TaskManager::BeginSimulation()
 {
-	OutputDebugStringA("BeginSimulation\n");
+	NIH_LOG_INFO("BeginSimulation");
 }
 
 void TaskManager::BeginFrame()
 {
-	OutputDebugStringA("BeginFrame\n");
+	NIH_LOG_TRACE("BeginFrame");
 }
 
 void TaskManager::Update(float deltaTime)
 {
-	std::string test = std::string("Update: ") + std::to_string(deltaTime) + std::string("\n");;
-	OutputDebugStringA(test.c_str());
-	for (Task* task : m_Tasks)
-	{
-		task->Update(deltaTime);
-	}
+	NIH_LOG_TRACE("Update: {}", deltaTime);
+
+	// every task has to be done before EndFrame
+	m_TaskGraph.Build(m_Tasks);
+	m_TaskGraph.Run(*m_JobSystem, deltaTime);
 }
 
 void TaskManager::EndFrame()
 {
-	OutputDebugStringA("EndFrame\n");
+	NIH_LOG_TRACE("EndFrame, critical path {} tasks {}s", m_TaskGraph.GetCriticalPathTaskCount(), m_TaskGraph.GetCriticalPathSeconds());
+	NIH_LOG_TRACE("EndFrame, frame arena {} bytes, high water mark {} bytes", m_FrameArena.GetUsedBytes(), m_FrameArena.GetHighWaterMark());
+
+	// every task is done, nothing can still point in the frame arena
+	m_FrameArena.Reset();
+}
+
+void TaskManager::RecordDraws(RenderBucket& bucket)
+{
+	for (Task* task : m_Tasks)
+	{
+		task->RecordDraws(bucket);
+	}
 }
 
 void TaskManager::EndSimulation()
 {
-	OutputDebugStringA("EndSimulation\n");
+	NIH_LOG_INFO("EndSimulation");
 }
 
 void TaskManager::AddTask(Task* task)
 {
-	m_Tasks.push_back(task);
+	m_Tasks.PushBack(task);
 }
\ No newline at end of file
@@ -1,7 +1,12 @@
 #pragma once
 
 #include "Core/Containers/Vector.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/UniquePtr.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/TaskGraph.h"
 
+class RenderBucket;
 class Task;
 
 class TaskManager
@@ -20,10 +25,24 @@ public:
 	void EndFrame();
 	void EndSimulation();
 	void AddTask(Task* task);
+
+	// Every task pushes its draws in the order they were added
+	void RecordDraws(RenderBucket& bucket);
+
+	[[nodiscard]] JobSystem& GetJobSystem() const { return *m_JobSystem; }
+	[[nodiscard]] const TaskGraph& GetTaskGraph() const { return m_TaskGraph; }
+
+	// Scratch memory for the tasks, everything allocated from it is released at EndFrame
+	[[nodiscard]] FrameArena& GetFrameArena() { return m_FrameArena; }
+
 private:
+	UniquePtr<JobSystem> m_JobSystem;
 
-	// every task should be in a separate thread
+	// the graph is rebuilt from the tasks declarations every frame and run on the job system
 	Vector<Task*> m_Tasks;
+	TaskGraph m_TaskGraph;
+
+	FrameArena m_FrameArena;
 
 	bool m_IsRunning;
 };
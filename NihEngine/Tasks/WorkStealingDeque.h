@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/Memory/CacheLine.h"
+
+/*
+* Bounded Chase-Lev work stealing deque
+* The owner thread pushes and pops at the bottom, any other thread can steal from the top
+* Memory orderings follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013)
+* T must be trivially copyable (we store job pointers)
+*/
+template<typename T, size_t Capacity>
+class WorkStealingDeque
+{
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	// Owner only, returns false if the deque is full
+	bool Push(T item)
+	{
+		const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+		const int64_t top = m_Top.load(std::memory_order_acquire);
+		if (bottom - top >= static_cast<int64_t>(Capacity))
+		{
+			return false;
+		}
+
+		m_Buffer[bottom & Mask].store(item, std::memory_order_relaxed);
+		// release publishes the item to the thieves that acquire m_Bottom
+		m_Bottom.store(bottom + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Owner only, takes the most recently pushed item
+	bool Pop(T& item)
+	{
+		const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+		m_Bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = m_Top.load(std::memory_order_relaxed);
+
+		if (top > bottom)
+		{
+			// the deque was already empty
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		item = m_Buffer[bottom & Mask].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			// last item, race against the thieves for it
+			const bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	// Any thread, takes the oldest item
+	bool Steal(T& item)
+	{
+		int64_t top = m_Top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+		{
+			return false;
+		}
+
+		item = m_Buffer[top & Mask].load(std::memory_order_relaxed);
+		return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+
+	// Approximation only, the value can be stale as soon as it is returned
+	[[nodiscard]] size_t GetSize() const
+	{
+		const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+		const int64_t top = m_Top.load(std::memory_order_relaxed);
+		return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+	}
+
+	[[nodiscard]] bool IsEmpty() const { return GetSize() == 0; }
+	[[nodiscard]] static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	static constexpr int64_t Mask = static_cast<int64_t>(Capacity) - 1;
+
+	alignas(CacheLineSize) std::atomic<int64_t> m_Top{0};
+	alignas(CacheLineSize) std::atomic<int64_t> m_Bottom{0};
+	alignas(CacheLineSize) std::atomic<T> m_Buffer[Capacity]{};
+};
@@ -0,0 +1,102 @@
+#include "Window/CommandListPool.h"
+
+#include "System/Assert.h"
+
+void CommandListPool::Create(ID3D12Device* device, UINT frameCount)
+{
+	NIH_ASSERT(frameCount > 0 && frameCount <= MaxFrames);
+	m_Device = device;
+	m_FrameCount = frameCount;
+	m_FrameIndex = 0;
+	m_OpenCount = 0;
+	m_CreatedCount = 0;
+	for (UINT frame = 0; frame < MaxFrames; ++frame)
+	{
+		m_UsedCounts[frame] = 0;
+		m_FrameFenceValues[frame] = 0;
+	}
+}
+
+void CommandListPool::Destroy()
+{
+	for (uint32_t i = 0; i < m_CreatedCount; ++i)
+	{
+		m_Lists[i].Reset();
+		for (UINT frame = 0; frame < m_FrameCount; ++frame)
+		{
+			m_Allocators[frame][i].Reset();
+		}
+	}
+	m_CreatedCount = 0;
+	m_OpenCount = 0;
+	m_Device = nullptr;
+}
+
+void CommandListPool::BeginFrame(UINT frameIndex, UINT64 completedFenceValue)
+{
+	NIH_ASSERT(frameIndex < m_FrameCount);
+	NIH_ASSERT(m_OpenCount == 0);
+	// the renderer waits on the fence before reusing a back buffer, this is where it matters
+	NIH_ASSERT(completedFenceValue >= m_FrameFenceValues[frameIndex]);
+
+	m_FrameIndex = frameIndex;
+	for (uint32_t i = 0; i < m_UsedCounts[frameIndex]; ++i)
+	{
+		m_Allocators[frameIndex][i]->Reset();
+	}
+	m_UsedCounts[frameIndex] = 0;
+}
+
+void CommandListPool::Open(uint32_t count)
+{
+	NIH_ASSERT(m_Device != nullptr);
+	NIH_ASSERT(m_OpenCount == 0 && count <= MaxLists);
+
+	for (; m_CreatedCount < count; ++m_CreatedCount)
+	{
+		for (UINT frame = 0; frame < m_FrameCount; ++frame)
+		{
+			m_Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(m_Allocators[frame][m_CreatedCount].ReleaseAndGetAddressOf()));
+		}
+		// created open on the allocator of the current frame, ready to record
+		m_Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_Allocators[m_FrameIndex][m_CreatedCount].Get(), nullptr, IID_PPV_ARGS(m_Lists[m_CreatedCount].ReleaseAndGetAddressOf()));
+		m_Lists[m_CreatedCount]->Close();
+
+		wchar_t name[32] = {};
+		swprintf_s(name, L"CommandListPool %u", m_CreatedCount);
+		m_Lists[m_CreatedCount]->SetName(name);
+	}
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		m_Lists[i]->Reset(m_Allocators[m_FrameIndex][i].Get(), nullptr);
+	}
+	m_OpenCount = count;
+	if (count > m_UsedCounts[m_FrameIndex])
+	{
+		m_UsedCounts[m_FrameIndex] = count;
+	}
+}
+
+ID3D12GraphicsCommandList* CommandListPool::GetList(uint32_t index) const
+{
+	NIH_ASSERT(index < m_OpenCount);
+	return m_Lists[index].Get();
+}
+
+uint32_t CommandListPool::Close(ID3D12CommandList** lists)
+{
+	for (uint32_t i = 0; i < m_OpenCount; ++i)
+	{
+		m_Lists[i]->Close();
+		lists[i] = m_Lists[i].Get();
+	}
+	const uint32_t count = m_OpenCount;
+	m_OpenCount = 0;
+	return count;
+}
+
+void CommandListPool::EndFrame(UINT64 fenceValue)
+{
+	m_FrameFenceValues[m_FrameIndex] = fenceValue;
+}
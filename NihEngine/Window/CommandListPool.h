@@ -0,0 +1,53 @@
+#pragma once
+
+#include "NihPCH.h"
+
+#include <d3d12.h>
+#include <wrl.h>
+
+#include "Core/NonCopyable.h"
+#include "Tasks/JobSystem.h"
+
+/*
+* Command lists recorded by several threads during a frame, executed together after the main list
+* Each list has one allocator per frame in flight. The allocators of a frame are only reset by BeginFrame once the
+* GPU passed the fence value EndFrame recorded for them, the lists themselves can be reset right after being executed.
+* Open, Close and the frame functions run on the render thread, the lists are recorded by one thread each
+*/
+class CommandListPool : private NonCopyable
+{
+public:
+	static constexpr uint32_t MaxLists = JobSystem::MaxWorkers;
+	static constexpr UINT MaxFrames = 3;
+
+	void Create(ID3D12Device* device, UINT frameCount);
+	// Device lost, the objects are released, Create must run again
+	void Destroy();
+
+	// completedFenceValue is the last value the GPU reached on the frame fence
+	void BeginFrame(UINT frameIndex, UINT64 completedFenceValue);
+
+	// Reset count lists on the allocators of the frame, they are created the first time they are needed
+	void Open(uint32_t count);
+	[[nodiscard]] uint32_t GetOpenCount() const { return m_OpenCount; }
+	[[nodiscard]] ID3D12GraphicsCommandList* GetList(uint32_t index) const;
+
+	// Close the open lists and write them into lists in order, returns their number
+	uint32_t Close(ID3D12CommandList** lists);
+
+	// fenceValue is signaled once the lists executed this frame are done
+	void EndFrame(UINT64 fenceValue);
+
+private:
+	ID3D12Device* m_Device{nullptr};
+	UINT m_FrameCount{0};
+	UINT m_FrameIndex{0};
+	uint32_t m_OpenCount{0};
+	uint32_t m_CreatedCount{0};
+
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_Lists[MaxLists];
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_Allocators[MaxFrames][MaxLists];
+	// Allocators of the frame holding commands, reset at the next BeginFrame of that frame
+	uint32_t m_UsedCounts[MaxFrames]{};
+	UINT64 m_FrameFenceValues[MaxFrames]{};
+};
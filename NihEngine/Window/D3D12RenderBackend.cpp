@@ -0,0 +1,73 @@
+#include "Window/D3D12RenderBackend.h"
+
+#include "Render/DrawPacket.h"
+#include "System/Assert.h"
+
+uint32_t D3D12RenderResources::RegisterPipeline(const Pipeline& pipeline)
+{
+	NIH_ASSERT(pipeline.m_RootSignature != nullptr && pipeline.m_PipelineState != nullptr);
+	m_Pipelines.PushBack(pipeline);
+	return static_cast<uint32_t>(m_Pipelines.GetSize() - 1);
+}
+
+uint32_t D3D12RenderResources::RegisterMaterial(D3D12_GPU_VIRTUAL_ADDRESS constants)
+{
+	m_Materials.PushBack(constants);
+	return static_cast<uint32_t>(m_Materials.GetSize() - 1);
+}
+
+uint32_t D3D12RenderResources::RegisterMesh(const Mesh& mesh)
+{
+	m_Meshes.PushBack(mesh);
+	return static_cast<uint32_t>(m_Meshes.GetSize() - 1);
+}
+
+void D3D12RenderResources::Clear()
+{
+	m_Pipelines.Clear();
+	m_Materials.Clear();
+	m_Meshes.Clear();
+}
+
+void D3D12RenderBackend::Begin(size_t)
+{
+	NIH_ASSERT(m_CommandList != nullptr);
+	m_BoundMesh = ~0u;
+}
+
+void D3D12RenderBackend::SetPipeline(uint32_t pipeline)
+{
+	NIH_ASSERT(pipeline < m_Resources->GetPipelineCount());
+	const D3D12RenderResources::Pipeline& state = m_Resources->GetPipeline(pipeline);
+	m_CommandList->SetGraphicsRootSignature(state.m_RootSignature);
+	m_CommandList->SetPipelineState(state.m_PipelineState);
+	m_CommandList->IASetPrimitiveTopology(state.m_Topology);
+}
+
+void D3D12RenderBackend::SetMaterial(uint32_t material)
+{
+	NIH_ASSERT(material < m_Resources->GetMaterialCount());
+	m_CommandList->SetGraphicsRootConstantBufferView(D3D12RenderResources::MaterialRootParameter, m_Resources->GetMaterial(material));
+}
+
+void D3D12RenderBackend::Draw(const DrawPacket& packet)
+{
+	NIH_ASSERT(packet.m_Mesh < m_Resources->GetMeshCount());
+	// draws sorted by material mostly reuse the mesh of the previous one
+	if (packet.m_Mesh != m_BoundMesh)
+	{
+		const D3D12RenderResources::Mesh& mesh = m_Resources->GetMesh(packet.m_Mesh);
+		m_CommandList->IASetVertexBuffers(0, 1, &mesh.m_VertexBuffer);
+		m_CommandList->IASetIndexBuffer(&mesh.m_IndexBuffer);
+		m_BoundMesh = packet.m_Mesh;
+	}
+
+	static_assert(sizeof(packet.m_World) == 16 * sizeof(float), "The world matrix is sent as 16 root constants");
+	m_CommandList->SetGraphicsRoot32BitConstants(D3D12RenderResources::WorldRootParameter, 16, &packet.m_World, 0);
+	m_CommandList->DrawIndexedInstanced(packet.m_IndexCount, packet.m_InstanceCount, packet.m_FirstIndex, packet.m_BaseVertex, 0);
+}
+
+void D3D12RenderBackend::End()
+{
+	m_CommandList = nullptr;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "NihPCH.h"
+
+#include <d3d12.h>
+
+#include "Core/Containers/Vector.h"
+#include "Render/IRenderBackend.h"
+
+/*
+* Tables the ids of the draw packets index, filled when the resources are created and read only while recording
+* Every registered root signature follows the same layout:
+*	parameter 0: 16 root constants, the world matrix of the draw (row major, like Mat4)
+*	parameter 1: root CBV, the constants of the material
+*/
+class D3D12RenderResources
+{
+public:
+	static constexpr UINT WorldRootParameter = 0;
+	static constexpr UINT MaterialRootParameter = 1;
+
+	struct Pipeline
+	{
+		ID3D12RootSignature* m_RootSignature{nullptr};
+		ID3D12PipelineState* m_PipelineState{nullptr};
+		D3D12_PRIMITIVE_TOPOLOGY m_Topology{D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST};
+	};
+
+	struct Mesh
+	{
+		D3D12_VERTEX_BUFFER_VIEW m_VertexBuffer{};
+		D3D12_INDEX_BUFFER_VIEW m_IndexBuffer{};
+	};
+
+	[[nodiscard]] uint32_t RegisterPipeline(const Pipeline& pipeline);
+	[[nodiscard]] uint32_t RegisterMaterial(D3D12_GPU_VIRTUAL_ADDRESS constants);
+	[[nodiscard]] uint32_t RegisterMesh(const Mesh& mesh);
+
+	[[nodiscard]] const Pipeline& GetPipeline(uint32_t pipeline) const { return m_Pipelines[pipeline]; }
+	[[nodiscard]] D3D12_GPU_VIRTUAL_ADDRESS GetMaterial(uint32_t material) const { return m_Materials[material]; }
+	[[nodiscard]] const Mesh& GetMesh(uint32_t mesh) const { return m_Meshes[mesh]; }
+
+	[[nodiscard]] size_t GetPipelineCount() const { return m_Pipelines.GetSize(); }
+	[[nodiscard]] size_t GetMaterialCount() const { return m_Materials.GetSize(); }
+	[[nodiscard]] size_t GetMeshCount() const { return m_Meshes.GetSize(); }
+
+	// Device lost, the registered objects are gone
+	void Clear();
+
+private:
+	Vector<Pipeline> m_Pipelines;
+	Vector<D3D12_GPU_VIRTUAL_ADDRESS> m_Materials;
+	Vector<Mesh> m_Meshes;
+};
+
+/*
+* Records sorted draw packets into one D3D12 command list
+* One backend per command list, several of them record different ranges of a bucket in parallel
+*/
+class D3D12RenderBackend : public IRenderBackend
+{
+public:
+	explicit D3D12RenderBackend(const D3D12RenderResources& resources) : m_Resources(&resources) {}
+
+	/*
+	* Command list of the next submit, open and with its render targets, viewport and scissor set
+	* No descriptor heap is bound: the root signatures only take root constants and a root CBV, a layout with
+	* descriptor tables would need SetDescriptorHeaps on every list before recording
+	*/
+	void SetCommandList(ID3D12GraphicsCommandList* commandList) { m_CommandList = commandList; }
+
+	void Begin(size_t packetCount) override;
+	void SetPipeline(uint32_t pipeline) override;
+	void SetMaterial(uint32_t material) override;
+	void Draw(const DrawPacket& packet) override;
+	void End() override;
+
+private:
+	const D3D12RenderResources* m_Resources;
+	ID3D12GraphicsCommandList* m_CommandList{nullptr};
+	uint32_t m_BoundMesh{~0u};
+};
@@ -0,0 +1,39 @@
+#include "Window/EventQueue.h"
+
+bool EventQueue::Push(const WindowEvent& event)
+{
+	const uint32_t head = m_Head.load(std::memory_order_relaxed);
+	if (head - m_Tail.load(std::memory_order_acquire) >= Capacity)
+	{
+		m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	m_Events[head % Capacity] = event;
+	m_Head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+void EventQueue::BeginFrame()
+{
+	m_FrameBegin = m_Tail.load(std::memory_order_relaxed);
+	m_FrameEnd = m_Head.load(std::memory_order_acquire);
+}
+
+void EventQueue::EndFrame()
+{
+	m_Tail.store(m_FrameEnd, std::memory_order_release);
+	m_FrameBegin = m_FrameEnd;
+}
+
+bool EventQueue::Contains(WindowEventType type) const
+{
+	for (uint32_t i = m_FrameBegin; i != m_FrameEnd; ++i)
+	{
+		if (m_Events[i % Capacity].m_Type == type)
+		{
+			return true;
+		}
+	}
+	return false;
+}
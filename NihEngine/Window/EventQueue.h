@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "Core/Memory/CacheLine.h"
+#include "Core/NonCopyable.h"
+#include "Window/WindowEvent.h"
+
+/*
+* Preallocated ring buffer between the message pump and the simulation
+* The pump pushes every event it receives, at any rate. The simulation opens a frame in BeginFrame which
+* exposes everything pushed so far, tasks can read those events concurrently until EndFrame releases them.
+* Events pushed while a frame is open wait for the next one, so the pump never has to run in step with the simulation.
+*/
+class EventQueue : private NonCopyable
+{
+public:
+	static constexpr uint32_t Capacity = 1024;
+
+	EventQueue() = default;
+	~EventQueue() = default;
+
+	// Producer side, returns false and counts the event as dropped when the queue is full
+	bool Push(const WindowEvent& event);
+
+	// Consumer side
+	void BeginFrame();
+	void EndFrame();
+
+	[[nodiscard]] uint32_t GetEventCount() const { return m_FrameEnd - m_FrameBegin; }
+	[[nodiscard]] const WindowEvent& GetEvent(uint32_t index) const { return m_Events[(m_FrameBegin + index) % Capacity]; }
+	[[nodiscard]] bool Contains(WindowEventType type) const;
+
+	[[nodiscard]] uint64_t GetDroppedCount() const { return m_DroppedCount.load(std::memory_order_relaxed); }
+
+	template<typename Function>
+	void ForEach(Function&& function) const
+	{
+		for (uint32_t i = m_FrameBegin; i != m_FrameEnd; ++i)
+		{
+			function(m_Events[i % Capacity]);
+		}
+	}
+
+private:
+	alignas(CacheLineSize) std::atomic<uint32_t> m_Head{0};
+	alignas(CacheLineSize) std::atomic<uint32_t> m_Tail{0};
+	std::atomic<uint64_t> m_DroppedCount{0};
+
+	// only touched by the consumer
+	uint32_t m_FrameBegin{0};
+	uint32_t m_FrameEnd{0};
+
+	WindowEvent m_Events[Capacity];
+};
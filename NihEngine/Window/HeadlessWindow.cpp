@@ -0,0 +1,69 @@
+#include "Window/HeadlessWindow.h"
+
+#include "Render/ParallelSubmit.h"
+#include "Render/RenderBucket.h"
+#include "Tasks/JobSystem.h"
+
+HeadlessWindow::HeadlessWindow()
+{
+	m_PendingEvents.Reserve(PendingCapacity);
+}
+
+void HeadlessWindow::Init()
+{
+}
+
+void HeadlessWindow::UpdateMessages()
+{
+	m_UpdateMessagesCount++;
+	for (const WindowEvent& event : m_PendingEvents)
+	{
+		m_EventQueue.Push(event);
+	}
+	m_PendingEvents.Clear();
+}
+
+void HeadlessWindow::Render(const RenderSnapshot& snapshot)
+{
+	m_RenderCount++;
+	m_LastSnapshot = snapshot;
+	if (snapshot.m_Bucket == nullptr)
+	{
+		return;
+	}
+
+	const RenderBucket& bucket = *snapshot.m_Bucket;
+	const uint32_t maxRanges = snapshot.m_JobSystem != nullptr ? snapshot.m_JobSystem->GetWorkerCount() : 1;
+	m_LastRangeCount = ParallelSubmit::GetRangeCount(bucket.GetSortedSize(), maxRanges);
+	while (m_RenderBackends.GetSize() < m_LastRangeCount)
+	{
+		m_RenderBackends.EmplaceBack();
+	}
+
+	if (snapshot.m_JobSystem != nullptr)
+	{
+		ParallelSubmit::Run(*snapshot.m_JobSystem, bucket, m_LastRangeCount, [this](uint32_t range) -> IRenderBackend&
+		{
+			return m_RenderBackends[range];
+		});
+	}
+	else
+	{
+		bucket.Submit(m_RenderBackends[0]);
+	}
+}
+
+size_t HeadlessWindow::GetDrawCount() const
+{
+	size_t count = 0;
+	for (const NullRenderBackend& backend : m_RenderBackends)
+	{
+		count += backend.GetDrawCount();
+	}
+	return count;
+}
+
+void HeadlessWindow::PostEvent(const WindowEvent& event)
+{
+	m_PendingEvents.PushBack(event);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Core/Containers/Vector.h"
+#include "Render/NullRenderBackend.h"
+#include "Window/EventQueue.h"
+#include "Window/IWindow.h"
+#include "Window/RenderSnapshot.h"
+#include "Window/WindowEvent.h"
+
+/*
+* Window without any platform layer nor renderer
+* Events posted to it play the role of the OS message queue, they reach the event queue on the next UpdateMessages
+* Rendering submits the bucket of the snapshot to NullRenderBackends, so the recorded draws can be checked,
+* split over the job system of the snapshot like the D3D12 renderer splits it over its command lists
+* Used to run and benchmark the engine loop on machines without a display
+*/
+class HeadlessWindow : public IWindow
+{
+public:
+	// Size of the pending buffer, posting more events than that between two updates reallocates it
+	static constexpr size_t PendingCapacity = EventQueue::Capacity;
+
+	HeadlessWindow();
+	~HeadlessWindow() override = default;
+
+	HeadlessWindow(const HeadlessWindow&) = delete;
+	HeadlessWindow& operator=(const HeadlessWindow&) = delete;
+
+	void Init() override;
+	void UpdateMessages() override;
+	void Render(const RenderSnapshot& snapshot) override;
+
+	[[nodiscard]] EventQueue& GetEventQueue() override { return m_EventQueue; }
+
+	void PostEvent(const WindowEvent& event);
+
+	[[nodiscard]] uint64_t GetUpdateMessagesCount() const { return m_UpdateMessagesCount; }
+	[[nodiscard]] uint64_t GetRenderCount() const { return m_RenderCount; }
+	[[nodiscard]] const RenderSnapshot& GetLastSnapshot() const { return m_LastSnapshot; }
+	// One backend per range of the bucket, each counts what it recorded over every rendered frame
+	[[nodiscard]] size_t GetRenderBackendCount() const { return m_RenderBackends.GetSize(); }
+	[[nodiscard]] const NullRenderBackend& GetRenderBackend(size_t index) const { return m_RenderBackends[index]; }
+	[[nodiscard]] size_t GetDrawCount() const;
+	// Ranges the last bucket was recorded in, 1 without a job system
+	[[nodiscard]] uint32_t GetLastRangeCount() const { return m_LastRangeCount; }
+
+private:
+	EventQueue m_EventQueue;
+	Vector<WindowEvent> m_PendingEvents;
+	uint64_t m_UpdateMessagesCount{0};
+	uint64_t m_RenderCount{0};
+	RenderSnapshot m_LastSnapshot{};
+	Vector<NullRenderBackend> m_RenderBackends;
+	uint32_t m_LastRangeCount{0};
+};
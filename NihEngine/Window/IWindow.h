@@ -0,0 +1,22 @@
+#pragma once
+
+class EventQueue;
+struct RenderSnapshot;
+
+/*
+* What the engine needs from a window, whatever the platform
+* UpdateMessages must consume every pending platform message and turn them into events
+* Render draws a snapshot of the simulation, with a pipelined engine it is called from the render thread while
+* UpdateMessages runs on the main thread: what the messages change in the renderer must reach it through Render
+*/
+class IWindow
+{
+public:
+	virtual ~IWindow() = default;
+
+	virtual void Init() = 0;
+	virtual void UpdateMessages() = 0;
+	virtual void Render(const RenderSnapshot& snapshot) = 0;
+
+	[[nodiscard]] virtual EventQueue& GetEventQueue() = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+class JobSystem;
+class RenderBucket;
+
+/*
+* Everything the renderer needs to draw one frame
+* The simulation fills it and hands it over, from then on it is read only: the render thread can draw it
+* while the simulation already writes the next one
+*/
+struct RenderSnapshot
+{
+	// Index of the rendered frame, increases by one with every snapshot
+	uint64_t m_FrameIndex{0};
+
+	// Number of simulation steps done when the snapshot was taken
+	uint64_t m_SimulationFrame{0};
+	double m_TotalSeconds{0.0};
+
+	// How far we are between the last two simulation steps, see StepTimer::GetInterpolationAlpha
+	double m_InterpolationAlpha{1.0};
+
+	// Draws recorded for this frame, sorted before the hand over, owned by the slot of the frame pipeline
+	const RenderBucket* m_Bucket{nullptr};
+
+	// Job system the draws may be recorded on, only parallel from the thread that created it, i.e. without a render thread
+	JobSystem* m_JobSystem{nullptr};
+};
@@ -1,8 +1,12 @@
 #include "Window/Renderer.h"
 #include "Window/d3dx12.h"
 
+#include "Core/Math/Math.h"
+#include "Render/ParallelSubmit.h"
+#include "Render/RenderBucket.h"
 #include "System/Assert.h"
 #include "Window/IDeviceNotify.h"
+#include "Window/SimpleMathInterop.h"
 #include <DirectXColors.h>
 
 #include <dxgi1_6.h>
@@ -205,6 +209,8 @@ void Renderer::CreateDeviceResources()
 	m_FenceValues[m_BackBufferIndex]++;
 	m_Fence->SetName(L"DeviceResources");
 
+	m_CommandListPool.Create(m_D3dDevice.Get(), m_BackBufferCount);
+
 	m_FenceEvent.Attach(CreateEventEx(nullptr, nullptr, 0, EVENT_MODIFY_STATE | SYNCHRONIZE));
 	if (!m_FenceEvent.IsValid())
 	{
@@ -230,7 +236,7 @@ void Renderer::CreateDeviceResources()
 
 	m_Shape = DirectX::GeometricPrimitive::CreateSphere();
 
-	m_World = DirectX::SimpleMath::Matrix::Identity;
+	m_World = Mat4::Identity();
 }
 
 void Renderer::CreateWindowSizeDependentResources()
@@ -353,24 +359,27 @@ void Renderer::CreateWindowSizeDependentResources()
 	m_ScissorRect.right = static_cast<LONG>(backBufferWidth);
 	m_ScissorRect.bottom = static_cast<LONG>(backBufferHeight);
 
-	using DirectX::SimpleMath::Matrix;
-
-	m_View = Matrix::CreateLookAt(DirectX::SimpleMath::Vector3(2.0f, 2.0f, 2.0f), DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::UnitY);
-	m_Proj = Matrix::CreatePerspectiveFieldOfView(DirectX::XM_PI / 4.0f, float(m_OutputSize.right) / float(m_OutputSize.bottom), 0.1f, 10.0f);
-	m_World = Matrix::Identity;
-	m_Effect->SetView(m_View);
-	m_Effect->SetProjection(m_Proj);
+	m_View = Mat4::CreateLookAt(Vec3(2.0f, 2.0f, 2.0f), Vec3::Zero(), Vec3::UnitY());
+	m_Proj = Mat4::CreatePerspectiveFieldOfView(Math::Pi / 4.0f, float(m_OutputSize.right) / float(m_OutputSize.bottom), 0.1f, 10.0f);
+	m_World = Mat4::Identity();
+	m_Effect->SetView(SimpleMathInterop::ToSimpleMath(m_View));
+	m_Effect->SetProjection(SimpleMathInterop::ToSimpleMath(m_Proj));
 }
 
-void Renderer::Render()
+void Renderer::Render(const RenderBucket* bucket, JobSystem* jobSystem)
 {
 	Prepare();
 	Clear();
 
-	m_Effect->SetWorld(m_World);
+	m_Effect->SetWorld(SimpleMathInterop::ToSimpleMath(m_World));
 	m_Effect->Apply(m_CommandList.Get());
 	m_Shape->Draw(m_CommandList.Get());
 
+	if (bucket != nullptr && bucket->GetSortedSize() > 0)
+	{
+		RecordBucket(*bucket, jobSystem);
+	}
+
 	Present();
 
 	m_GraphicsMemory->Commit(GetCommandQueue());
@@ -421,15 +430,52 @@ void Renderer::Clear()
 {
 	auto const rtvDescriptor = GetRenderTargetView();
 	auto const dsvDescriptor = GetDepthStencilView();
-	m_CommandList->OMSetRenderTargets(1, &rtvDescriptor, FALSE, &dsvDescriptor);
 	m_CommandList->ClearRenderTargetView(rtvDescriptor, DirectX::Colors::CornflowerBlue, 0, nullptr);
 	m_CommandList->ClearDepthStencilView(dsvDescriptor, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
 
+	SetRenderTargets(m_CommandList.Get());
+}
+
+void Renderer::SetRenderTargets(ID3D12GraphicsCommandList* commandList) const
+{
+	auto const rtvDescriptor = GetRenderTargetView();
+	auto const dsvDescriptor = GetDepthStencilView();
+	commandList->OMSetRenderTargets(1, &rtvDescriptor, FALSE, &dsvDescriptor);
+
 	auto const viewport = GetScreenViewport();
 	auto const scissorRect = GetScissorRect();
 
-	m_CommandList->RSSetViewports(1, &viewport);
-	m_CommandList->RSSetScissorRects(1, &scissorRect);
+	commandList->RSSetViewports(1, &viewport);
+	commandList->RSSetScissorRects(1, &scissorRect);
+}
+
+void Renderer::RecordBucket(const RenderBucket& bucket, JobSystem* jobSystem)
+{
+	// one range per list, the lists execute after the main one in range order, which is the key order
+	const uint32_t maxLists = jobSystem != nullptr ? std::min(jobSystem->GetWorkerCount(), CommandListPool::MaxLists) : 1;
+	const uint32_t listCount = ParallelSubmit::GetRangeCount(bucket.GetSortedSize(), maxLists);
+	m_CommandListPool.Open(listCount);
+	while (m_RenderBackends.GetSize() < listCount)
+	{
+		m_RenderBackends.EmplaceBack(m_RenderResources);
+	}
+
+	auto getBackend = [this](uint32_t list) -> IRenderBackend&
+	{
+		ID3D12GraphicsCommandList* commandList = m_CommandListPool.GetList(list);
+		SetRenderTargets(commandList);
+		m_RenderBackends[list].SetCommandList(commandList);
+		return m_RenderBackends[list];
+	};
+
+	if (jobSystem != nullptr)
+	{
+		ParallelSubmit::Run(*jobSystem, bucket, listCount, getBackend);
+	}
+	else
+	{
+		bucket.Submit(getBackend(0));
+	}
 }
 
 
@@ -438,6 +484,8 @@ void Renderer::Prepare(D3D12_RESOURCE_STATES beforeState, D3D12_RESOURCE_STATES
 	// Reset command list and allocator
 	m_CommandAllocators[m_BackBufferIndex]->Reset();
 	m_CommandList->Reset(m_CommandAllocators[m_BackBufferIndex].Get(), nullptr);
+	// MoveToNextFrame waited for this back buffer, the lists recorded for it are done
+	m_CommandListPool.BeginFrame(m_BackBufferIndex, m_Fence->GetCompletedValue());
 
 	if (beforeState != afterState)
 	{
@@ -451,17 +499,25 @@ void Renderer::Prepare(D3D12_RESOURCE_STATES beforeState, D3D12_RESOURCE_STATES
 
 void Renderer::Present(D3D12_RESOURCE_STATES beforeState)
 {
+	// The last list of the frame is the last one executed
+	const uint32_t pooledCount = m_CommandListPool.GetOpenCount();
+	ID3D12GraphicsCommandList* lastList = pooledCount > 0 ? m_CommandListPool.GetList(pooledCount - 1) : m_CommandList.Get();
 	if (beforeState != D3D12_RESOURCE_STATE_PRESENT)
 	{
 		// Transition the render target to the state that allows it to be presented to the display
 		const D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_RenderTargets[m_BackBufferIndex].Get(),
 			D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
-		m_CommandList->ResourceBarrier(1, &barrier);
+		lastList->ResourceBarrier(1, &barrier);
 	}
 
-	// Send the command list off to the GPU for processing
+	// Send the main list and the pooled ones off to the GPU for processing, in one call and in order
+	ID3D12CommandList* commandLists[1 + CommandListPool::MaxLists];
 	m_CommandList->Close();
-	m_CommandQueue->ExecuteCommandLists(1, CommandListCast(m_CommandList.GetAddressOf()));
+	commandLists[0] = m_CommandList.Get();
+	const uint32_t listCount = 1 + m_CommandListPool.Close(commandLists + 1);
+	m_CommandQueue->ExecuteCommandLists(listCount, commandLists);
+	// MoveToNextFrame signals this value once the lists are executed
+	m_CommandListPool.EndFrame(m_FenceValues[m_BackBufferIndex]);
 
 	HRESULT hr;
 	if (m_Options & c_AllowTearing)
@@ -563,6 +619,8 @@ void Renderer::HandleDeviceLost()
 	m_GraphicsMemory.reset();
 	m_Shape.reset();
 	m_Effect.reset();
+	m_CommandListPool.Destroy();
+	m_RenderResources.Clear();
 	//m_Batch.reset();
 
 	for (UINT n = 0; n < m_BackBufferCount; n++)
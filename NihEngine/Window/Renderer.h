@@ -7,13 +7,19 @@
 #include <dxgi1_4.h>
 #include <wrl.h>
 
+#include "Core/Math/Mat4.h"
+#include "Core/Containers/Vector.h"
 #include "Core/Memory/UniquePtr.h"
+#include "Window/CommandListPool.h"
+#include "Window/D3D12RenderBackend.h"
 
 #ifdef _DEBUG
 #include <dxgidebug.h>
 #endif
 
 class IDeviceNotify;
+class JobSystem;
+class RenderBucket;
 
 class Renderer
 {
@@ -83,7 +89,14 @@ public:
 		return CD3DX12_CPU_DESCRIPTOR_HANDLE(cpuHandle);
 	}
 
-	void Render();
+	/*
+	* bucket, if any, must be sorted and is drawn after the built in shape
+	* With a job system its packets are recorded into several command lists in parallel, executed in order with the main one
+	*/
+	void Render(const RenderBucket* bucket = nullptr, JobSystem* jobSystem = nullptr);
+
+	// Tables the draw packets refer to
+	D3D12RenderResources& GetRenderResources() { return m_RenderResources; }
 
 	// messages
 	void OnActivated();
@@ -92,6 +105,9 @@ public:
 	void OnResuming();
 private:
 	void Clear();
+	// Each command list starts without render targets, viewport or scissor
+	void SetRenderTargets(ID3D12GraphicsCommandList* commandList) const;
+	void RecordBucket(const RenderBucket& bucket, JobSystem* jobSystem);
 
 	void MoveToNextFrame();
 	void GetAdapter(IDXGIAdapter** ppAdapter);
@@ -150,9 +166,15 @@ private:
 	using VertexType = DirectX::VertexPositionColor;
 	UniquePtr<DirectX::BasicEffect> m_Effect;
 
-	DirectX::SimpleMath::Matrix m_World;
-	DirectX::SimpleMath::Matrix m_View;
-	DirectX::SimpleMath::Matrix m_Proj;
+	// Engine math, converted to SimpleMath only when handed to the effect
+	Mat4 m_World;
+	Mat4 m_View;
+	Mat4 m_Proj;
 
 	UniquePtr<DirectX::GeometricPrimitive> m_Shape;
+
+	D3D12RenderResources m_RenderResources;
+	// One per list of the pool
+	Vector<D3D12RenderBackend> m_RenderBackends;
+	CommandListPool m_CommandListPool;
 };
\ No newline at end of file
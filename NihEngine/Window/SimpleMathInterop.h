@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstring>
+
+#include "NihPCH.h"
+
+#include "Core/Math/Mat4.h"
+#include "Core/Math/Quat.h"
+#include "Core/Math/Vec3.h"
+#include "Core/Math/Vec4.h"
+
+/*
+* Conversions between the engine math and DirectX::SimpleMath, only at the renderer boundary
+* Both use row major storage and row vectors, so every conversion is a plain copy of the floats
+*/
+namespace SimpleMathInterop
+{
+	[[nodiscard]] inline DirectX::SimpleMath::Vector3 ToSimpleMath(const Vec3& vector) { return DirectX::SimpleMath::Vector3(vector.m_X, vector.m_Y, vector.m_Z); }
+	[[nodiscard]] inline DirectX::SimpleMath::Vector4 ToSimpleMath(const Vec4& vector) { return DirectX::SimpleMath::Vector4(vector.m_X, vector.m_Y, vector.m_Z, vector.m_W); }
+	[[nodiscard]] inline DirectX::SimpleMath::Quaternion ToSimpleMath(const Quat& rotation) { return DirectX::SimpleMath::Quaternion(rotation.m_X, rotation.m_Y, rotation.m_Z, rotation.m_W); }
+
+	[[nodiscard]] inline DirectX::SimpleMath::Matrix ToSimpleMath(const Mat4& matrix)
+	{
+		static_assert(sizeof(Mat4) == sizeof(DirectX::SimpleMath::Matrix), "Mat4 and Matrix must both be 16 floats");
+		DirectX::SimpleMath::Matrix result;
+		std::memcpy(&result, &matrix, sizeof(result));
+		return result;
+	}
+
+	[[nodiscard]] inline Vec3 FromSimpleMath(const DirectX::SimpleMath::Vector3& vector) { return Vec3(vector.x, vector.y, vector.z); }
+	[[nodiscard]] inline Vec4 FromSimpleMath(const DirectX::SimpleMath::Vector4& vector) { return Vec4(vector.x, vector.y, vector.z, vector.w); }
+	[[nodiscard]] inline Quat FromSimpleMath(const DirectX::SimpleMath::Quaternion& rotation) { return Quat(rotation.x, rotation.y, rotation.z, rotation.w); }
+
+	[[nodiscard]] inline Mat4 FromSimpleMath(const DirectX::SimpleMath::Matrix& matrix)
+	{
+		Mat4 result;
+		std::memcpy(&result, &matrix, sizeof(result));
+		return result;
+	}
+}
@@ -1,6 +1,9 @@
 #include "Window.h"
 
-#include "Tasks/TaskManager.h"
+#include <utility>
+#include <windowsx.h>
+
+#include "Window/RenderSnapshot.h"
 
 Window::Window()
 {
@@ -45,9 +48,10 @@ void Window::Init()
 
 	m_Renderer = std::make_unique<Renderer>();
 
-	std::wstring windowName = std::wstring(m_WindowName.begin(), m_WindowName.end());
-	LPCWSTR windowNameStr = windowName.c_str();
-	m_Hwnd = CreateWindowExW(0, L"Test", windowNameStr, WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT, m_Height, m_Width, HWND(), HMENU(), wcex.hInstance, m_Renderer.get());
+	// UTF-8 to UTF-16 on the stack, the name is bounded by its FixedString capacity
+	wchar_t windowName[WindowName::GetCapacity() + 1] = {};
+	MultiByteToWideChar(CP_UTF8, 0, m_WindowName.CStr(), static_cast<int>(m_WindowName.GetSize()), windowName, static_cast<int>(WindowName::GetCapacity()));
+	m_Hwnd = CreateWindowExW(0, L"Test", windowName, WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT, m_Height, m_Width, HWND(), HMENU(), wcex.hInstance, this);
 	if (!m_Hwnd)
 		return;
 
@@ -66,13 +70,66 @@ void Window::UpdateMessages()
 {
 	MSG msg = {};
 
-	if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+	// Drain the whole OS queue, handling a single message per tick lets input and resizes pile up
+	while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
 	{
+		if (msg.message == WM_QUIT)
+		{
+			PushEvent(WindowEventType::Quit);
+			continue;
+		}
 		TranslateMessage(&msg);
 		DispatchMessage(&msg);
 	}
 }
 
+void Window::NotifyRenderer(RendererNotification type, int width, int height)
+{
+	std::lock_guard lock(m_NotificationMutex);
+	m_PendingNotifications.PushBack(PendingNotification{ type, width, height });
+}
+
+void Window::ApplyRendererNotifications()
+{
+	{
+		std::lock_guard lock(m_NotificationMutex);
+		std::swap(m_PendingNotifications, m_AppliedNotifications);
+	}
+
+	for (const PendingNotification& notification : m_AppliedNotifications)
+	{
+		switch (notification.m_Type)
+		{
+		case RendererNotification::SizeChanged:
+			m_Renderer->OnWindowSizeChanged(notification.m_Width, notification.m_Height);
+			break;
+		case RendererNotification::Suspending:
+			m_Renderer->OnSuspending();
+			break;
+		case RendererNotification::Resuming:
+			m_Renderer->OnResuming();
+			break;
+		case RendererNotification::Activated:
+			m_Renderer->OnActivated();
+			break;
+		case RendererNotification::Deactivated:
+			m_Renderer->OnDeactivated();
+			break;
+		}
+	}
+	m_AppliedNotifications.Clear();
+}
+
+void Window::PushEvent(WindowEventType type, uint32_t code, int32_t x, int32_t y)
+{
+	WindowEvent event;
+	event.m_Type = type;
+	event.m_Code = code;
+	event.m_X = x;
+	event.m_Y = y;
+	m_EventQueue.Push(event);
+}
+
 LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
 	static bool sInSizeMove{ false };
@@ -80,7 +137,13 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 	static bool sMinimized{ false };
 	static bool sFullscreen{ false };
 
-	Renderer* renderer = reinterpret_cast<Renderer*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+	Window* window = reinterpret_cast<Window*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+	// CreateWindowEx sends messages before WM_CREATE stores the window, the ones needing it get the default behavior
+	if (window == nullptr && message != WM_CREATE && message != WM_GETMINMAXINFO)
+	{
+		return DefWindowProcW(hwnd, message, wParam, lParam);
+	}
+	// the renderer may be rendering on another thread, it is only reached through NotifyRenderer from here
 
 	switch (message)
 	{
@@ -109,9 +172,10 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 				sMinimized = true;
 				if (!sInSuspend)
 				{
-					renderer->OnSuspending();
+					window->NotifyRenderer(RendererNotification::Suspending);
 				}
 				sInSuspend = true;
+				window->PushEvent(WindowEventType::Minimize);
 			}
 		}
 		else if (sMinimized)
@@ -119,13 +183,20 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 			sMinimized = false;
 			if (sInSuspend)
 			{
-				renderer->OnResuming();
+				window->NotifyRenderer(RendererNotification::Resuming);
 			}
 			sInSuspend = false;
+			window->PushEvent(WindowEventType::Restore);
 		}
 		else if (sInSizeMove)
 		{
-			renderer->OnWindowSizeChanged(LOWORD(lParam), HIWORD(lParam));
+			window->NotifyRenderer(RendererNotification::SizeChanged, LOWORD(lParam), HIWORD(lParam));
+		}
+		if (wParam != SIZE_MINIMIZED)
+		{
+			window->m_ClientWidth = LOWORD(lParam);
+			window->m_ClientHeight = HIWORD(lParam);
+			window->PushEvent(WindowEventType::Resize, 0, LOWORD(lParam), HIWORD(lParam));
 		}
 		break;
 	}
@@ -139,7 +210,7 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 		sInSizeMove = false;
 		RECT rc;
 		GetClientRect(hwnd, &rc);
-		renderer->OnWindowSizeChanged(rc.right - rc.left, rc.bottom - rc.top);
+		window->NotifyRenderer(RendererNotification::SizeChanged, rc.right - rc.left, rc.bottom - rc.top);
 		break;
 	}
 	case WM_GETMINMAXINFO:
@@ -156,11 +227,13 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 	{
 		if (wParam)
 		{
-			renderer->OnActivated();
+			window->NotifyRenderer(RendererNotification::Activated);
+			window->PushEvent(WindowEventType::Activate);
 		}
 		else
 		{
-			renderer->OnDeactivated();
+			window->NotifyRenderer(RendererNotification::Deactivated);
+			window->PushEvent(WindowEventType::Deactivate);
 		}
 		break;
 	}
@@ -172,9 +245,10 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 		{
 			if (!sInSuspend)
 			{
-				renderer->OnSuspending();
+				window->NotifyRenderer(RendererNotification::Suspending);
 			}
 			sInSuspend = true;
+			window->PushEvent(WindowEventType::Suspend);
 			return TRUE;
 		}
 		case PBT_APMRESUMESUSPEND:
@@ -183,14 +257,15 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 			{
 				if (sInSuspend)
 				{
-					renderer->OnResuming();
+					window->NotifyRenderer(RendererNotification::Resuming);
 				}
 				sInSuspend = false;
 			}
+			window->PushEvent(WindowEventType::Resume);
 			return TRUE;
 		}
-		break;
 		}
+		break;
 	}
 	case WM_DESTROY:
 	{
@@ -198,6 +273,39 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 		//TaskManager::GetInstance()->Stop();
 		break;
 	}
+	case WM_KEYDOWN:
+	case WM_KEYUP:
+	{
+		window->PushEvent(message == WM_KEYDOWN ? WindowEventType::KeyDown : WindowEventType::KeyUp, static_cast<uint32_t>(wParam));
+		break;
+	}
+	case WM_CHAR:
+	{
+		window->PushEvent(WindowEventType::Char, static_cast<uint32_t>(wParam));
+		break;
+	}
+	case WM_MOUSEMOVE:
+	{
+		window->PushEvent(WindowEventType::MouseMove, 0, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+		break;
+	}
+	case WM_LBUTTONDOWN:
+	case WM_RBUTTONDOWN:
+	case WM_MBUTTONDOWN:
+	case WM_LBUTTONUP:
+	case WM_RBUTTONUP:
+	case WM_MBUTTONUP:
+	{
+		const bool isDown = message == WM_LBUTTONDOWN || message == WM_RBUTTONDOWN || message == WM_MBUTTONDOWN;
+		const uint32_t button = (message == WM_LBUTTONDOWN || message == WM_LBUTTONUP) ? 0 : (message == WM_RBUTTONDOWN || message == WM_RBUTTONUP) ? 1 : 2;
+		window->PushEvent(isDown ? WindowEventType::MouseButtonDown : WindowEventType::MouseButtonUp, button, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+		break;
+	}
+	case WM_MOUSEWHEEL:
+	{
+		window->PushEvent(WindowEventType::MouseWheel, 0, 0, GET_WHEEL_DELTA_WPARAM(wParam));
+		break;
+	}
 	case WM_SYSKEYDOWN:
 	{
 		if (wParam == VK_RETURN && (lParam & 0x60000000) == 0x20000000)
@@ -208,9 +316,8 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 				SetWindowLongPtr(hwnd, GWL_STYLE, WS_OVERLAPPEDWINDOW);
 				SetWindowLongPtr(hwnd, GWL_EXSTYLE, 0);
 
-				RECT rec = renderer->GetOutputSize();
-				int width = rec.right;
-				int height = rec.top;
+				int width = window->m_ClientWidth;
+				int height = window->m_ClientHeight;
 
 				ShowWindow(hwnd, SW_SHOWNORMAL);
 				SetWindowPos(hwnd, HWND_TOP, 0, 0, width, height, SWP_NOMOVE | SWP_NOZORDER | SWP_FRAMECHANGED);
@@ -232,9 +339,11 @@ LRESULT CALLBACK Window::Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM l
 	return 0;
 }
 
-void Window::Render()
+void Window::Render(const RenderSnapshot& snapshot)
 {
-	m_Renderer->Render();
+	ApplyRendererNotifications();
+	// nothing is interpolated yet, the recorded draws are submitted as they are
+	m_Renderer->Render(snapshot.m_Bucket, snapshot.m_JobSystem);
 }
 
 void Window::OnDeviceLost()
@@ -1,23 +1,30 @@
 #pragma once
 
 #include "framework.h"
-#include <string>
 #include "NihEngine.h"
 
+#include <cstdint>
+#include <mutex>
+
+#include "Core/Containers/Vector.h"
 #include "Core/Memory/UniquePtr.h"
+#include "Core/Strings/FixedString.h"
+#include "Window/EventQueue.h"
 #include "Window/Renderer.h"
 #include "Window/IDeviceNotify.h"
+#include "Window/IWindow.h"
 
-class Window : public IDeviceNotify
-//class Window
+class Window : public IWindow, public IDeviceNotify
 {
 public:
+	using WindowName = FixedString<64>;
+
 	struct WindowInit
 	{
 		HINSTANCE m_hInstance{};
 		UINT m_Style{};
 
-		std::string m_WindowName{};
+		WindowName m_WindowName{};
 		int m_NCmdShow{};
 
 		int m_Heigth{};
@@ -26,17 +33,16 @@ public:
 
 	Window();
 	Window(WindowInit&&);
-	virtual ~Window();
-
-	Window(Window&&) = default;
-	Window& operator= (Window&&) = default;
+	~Window() override;
 
 	Window(const Window&) = delete;
 	Window& operator= (const Window&) = delete;
 
-	void Init();
-	void UpdateMessages();
-	void Render();
+	void Init() override;
+	void UpdateMessages() override;
+	void Render(const RenderSnapshot& snapshot) override;
+
+	[[nodiscard]] EventQueue& GetEventQueue() override { return m_EventQueue; }
 
 	static LRESULT CALLBACK Update(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam);
 
@@ -44,10 +50,39 @@ public:
 	void OnDeviceRestored() override;
 
 private:
+	// Renderer calls asked for by the messages, made by Render on the thread that renders
+	enum class RendererNotification : uint8_t
+	{
+		SizeChanged,
+		Suspending,
+		Resuming,
+		Activated,
+		Deactivated,
+	};
+
+	struct PendingNotification
+	{
+		RendererNotification m_Type;
+		int m_Width;
+		int m_Height;
+	};
+
+	void PushEvent(WindowEventType type, uint32_t code = 0, int32_t x = 0, int32_t y = 0);
+	void NotifyRenderer(RendererNotification type, int width = 0, int height = 0);
+	void ApplyRendererNotifications();
+
 	UniquePtr<Renderer> m_Renderer;
+	std::mutex m_NotificationMutex;
+	Vector<PendingNotification> m_PendingNotifications;
+	// swapped with the pending ones so the render thread applies them outside the lock
+	Vector<PendingNotification> m_AppliedNotifications;
+	// last client size, known without asking the renderer from the main thread
+	int m_ClientWidth = 0;
+	int m_ClientHeight = 0;
+	EventQueue m_EventQueue;
 	WindowInit m_WindowInit;
 	HWND m_Hwnd;
-	std::string m_WindowName;
+	WindowName m_WindowName;
 
 	int m_Height = 480;
 	int m_Width = 480;
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+enum class WindowEventType : uint8_t
+{
+	None,
+	Quit,
+	Resize,
+	Minimize,
+	Restore,
+	Activate,
+	Deactivate,
+	Suspend,
+	Resume,
+	KeyDown,
+	KeyUp,
+	Char,
+	MouseMove,
+	MouseButtonDown,
+	MouseButtonUp,
+	MouseWheel,
+};
+
+/*
+* Platform independent window event
+* m_X / m_Y hold the new size for Resize, the cursor position for mouse events and the delta for MouseWheel
+* m_Code holds the virtual key, the character or the mouse button
+*/
+struct WindowEvent
+{
+	WindowEventType m_Type{WindowEventType::None};
+	uint32_t m_Code{0};
+	int32_t m_X{0};
+	int32_t m_Y{0};
+};
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
 #include "Core/Containers/Array.h"
+#include "Core/Memory/CacheLine.h"
 
 namespace Containers
 {
@@ -42,4 +45,104 @@ namespace Containers
 		Array<int, 4> array{ 0,1,2,3 };
 		EXPECT_TRUE(array[2] == 2);
 	}
-}
\ No newline at end of file
+
+	TEST(Array, Alignment)
+	{
+		Array<float, 8, 32> avx{};
+		Array<float, 4, CacheLineSize> line{};
+		EXPECT_TRUE(reinterpret_cast<uintptr_t>(avx.GetData()) % 32 == 0);
+		EXPECT_TRUE(reinterpret_cast<uintptr_t>(line.GetData()) % CacheLineSize == 0);
+		static_assert(alignof(Array<float, 8, 32>) == 32);
+		static_assert(alignof(Array<float, 8>) == alignof(float));
+	}
+
+	TEST(Array, Constexpr)
+	{
+		constexpr auto make = []()
+		{
+			Array<int32_t, 32> array{};
+			array.Fill(2);
+			array[5] = -7;
+			array[9] = 11;
+			return array;
+		};
+		constexpr Array<int32_t, 32> array = make();
+		static_assert(array.Sum() == 2 * 30 - 7 + 11);
+		static_assert(array.MinMax().m_Min == -7 && array.MinMax().m_Max == 11);
+		static_assert(array.Find(11) == 9 && array.Find(3) == 32);
+		EXPECT_TRUE(array.Sum() == 2 * 30 - 7 + 11);
+	}
+
+	TEST(Array, BulkOperations)
+	{
+		Array<float, 64, 32> array{};
+		array.Fill(0.5f);
+		array[40] = -3.0f;
+		array[63] = 9.0f;
+		EXPECT_TRUE(array.Sum() == 0.5f * 62 - 3.0f + 9.0f);
+		EXPECT_TRUE(array.MinMax().m_Min == -3.0f && array.MinMax().m_Max == 9.0f);
+		EXPECT_TRUE(array.Find(-3.0f) == 40);
+		EXPECT_TRUE(array.Find(1.0f) == array.GetSize());
+
+		Array<float, 64> copy{};
+		copy.CopyFrom(array);
+		EXPECT_TRUE(copy[40] == -3.0f && copy[63] == 9.0f && copy[0] == 0.5f);
+
+		// not accelerated, goes through the plain loops
+		Array<double, 4> doubles{ 1.0, 2.0, 3.0, 4.0 };
+		EXPECT_TRUE(doubles.Sum() == 10.0 && doubles.Find(3.0) == 2);
+	}
+
+	// Every kernel level against the scalar definition, for all the sizes around the vector widths
+	TEST(Array, KernelLevels)
+	{
+		const SimdLevel supported = ArrayOps::GetSimdLevel();
+		for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::Sse41, SimdLevel::Avx2 })
+		{
+			ArrayOps::SetSimdLevel(level);
+			EXPECT_TRUE(ArrayOps::GetSimdLevel() <= level);
+
+			for (size_t count = 1; count < 70; ++count)
+			{
+				std::vector<int32_t> integers(count);
+				std::vector<float> floats(count);
+				ArrayOps::Fill(integers.data(), count, 3);
+				ArrayOps::Fill(floats.data(), count, 0.25f);
+				integers[count / 3] = -100;
+				integers[count - 1] = 100;
+				floats[count / 3] = -8.0f;
+
+				bool filled = true;
+				for (size_t i = 0; i < count; ++i)
+				{
+					filled = filled && (i == count / 3 || floats[i] == 0.25f);
+				}
+				EXPECT_TRUE(filled);
+
+				std::vector<int32_t> copy(count);
+				ArrayOps::Copy(copy.data(), integers.data(), count);
+				EXPECT_TRUE(copy == integers);
+
+				int32_t expectedSum = 0;
+				float expectedFloatSum = 0.0f;
+				for (size_t i = 0; i < count; ++i)
+				{
+					expectedSum += integers[i];
+					expectedFloatSum += floats[i];
+				}
+				EXPECT_TRUE(ArrayOps::Sum(integers.data(), count) == expectedSum);
+				EXPECT_TRUE(ArrayOps::Sum(floats.data(), count) == expectedFloatSum);
+
+				const ArrayOps::MinMaxResult<int32_t> minMax = ArrayOps::MinMax(integers.data(), count);
+				EXPECT_TRUE(minMax.m_Min == (count == 1 ? 100 : -100) && minMax.m_Max == 100);
+				const ArrayOps::MinMaxResult<float> floatMinMax = ArrayOps::MinMax(floats.data(), count);
+				EXPECT_TRUE(floatMinMax.m_Min == -8.0f && floatMinMax.m_Max == (count == 1 ? -8.0f : 0.25f));
+
+				EXPECT_TRUE(ArrayOps::Find(integers.data(), count, 100) == (count == 1 ? 0 : count - 1));
+				EXPECT_TRUE(ArrayOps::Find(integers.data(), count, 42) == count);
+				EXPECT_TRUE(ArrayOps::Find(floats.data(), count, -8.0f) == count / 3);
+			}
+		}
+		ArrayOps::SetSimdLevel(supported);
+	}
+}
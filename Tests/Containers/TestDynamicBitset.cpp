@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "Core/Containers/DynamicBitset.h"
+
+namespace Containers
+{
+	TEST(DynamicBitset, SetAndTest)
+	{
+		DynamicBitset<> bits(100);
+		EXPECT_TRUE(bits.GetSize() == 100 && bits.GetWordCount() == 2);
+		EXPECT_TRUE(bits.None());
+
+		bits.Set(0);
+		bits.Set(63);
+		bits.Set(64);
+		bits.Set(99);
+		EXPECT_TRUE(bits.Test(63) && bits[64] && !bits.Test(1));
+		EXPECT_TRUE(bits.Count() == 4);
+
+		bits.Reset(63);
+		bits.Flip(1);
+		bits.Set(2, true);
+		EXPECT_TRUE(!bits.Test(63) && bits.Test(1) && bits.Test(2));
+		EXPECT_TRUE(bits.Count() == 5);
+	}
+
+	TEST(DynamicBitset, Resize)
+	{
+		DynamicBitset<> bits(10, true);
+		EXPECT_TRUE(bits.All() && bits.Count() == 10);
+		// bits past the size stay zero
+		EXPECT_TRUE(bits.GetWords()[0] == 0x3ff);
+
+		bits.Resize(130, true);
+		EXPECT_TRUE(bits.Count() == 130);
+		bits.Resize(70);
+		EXPECT_TRUE(bits.Count() == 70 && bits.GetWordCount() == 2);
+
+		bits.ResetAll();
+		EXPECT_TRUE(bits.None());
+		bits.SetAll();
+		EXPECT_TRUE(bits.All() && bits.Count() == 70);
+	}
+
+	TEST(DynamicBitset, Find)
+	{
+		DynamicBitset<> bits(300);
+		EXPECT_TRUE(bits.FindFirst() == 300);
+
+		const size_t indices[] = { 5, 64, 65, 200, 299 };
+		for (size_t index : indices)
+		{
+			bits.Set(index);
+		}
+
+		std::vector<size_t> found;
+		for (size_t index = bits.FindFirst(); index < bits.GetSize(); index = bits.FindNext(index))
+		{
+			found.push_back(index);
+		}
+		EXPECT_TRUE(found == std::vector<size_t>(std::begin(indices), std::end(indices)));
+
+		std::vector<size_t> visited;
+		bits.ForEachSetBit([&visited](size_t index) { visited.push_back(index); });
+		EXPECT_TRUE(visited == found);
+	}
+
+	TEST(DynamicBitset, BulkOperations)
+	{
+		// every kernel level, with sizes that leave partial vectors
+		const SimdLevel supported = ArrayOps::GetSimdLevel();
+		for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::Sse41, SimdLevel::Avx2 })
+		{
+			ArrayOps::SetSimdLevel(level);
+			for (size_t size : { 1, 64, 130, 333, 1000 })
+			{
+				DynamicBitset<> a(size);
+				DynamicBitset<> b(size);
+				size_t expectedAnd = 0;
+				size_t expectedOr = 0;
+				size_t expectedAndNot = 0;
+				for (size_t i = 0; i < size; ++i)
+				{
+					const bool inA = i % 3 == 0;
+					const bool inB = i % 5 == 0;
+					a.Set(i, inA);
+					b.Set(i, inB);
+					expectedAnd += inA && inB;
+					expectedOr += inA || inB;
+					expectedAndNot += inA && !inB;
+				}
+
+				DynamicBitset<> result = a;
+				result &= b;
+				EXPECT_TRUE(result.Count() == expectedAnd);
+				EXPECT_TRUE(a.Contains(result) && b.Contains(result));
+
+				result = a;
+				result |= b;
+				EXPECT_TRUE(result.Count() == expectedOr);
+				EXPECT_TRUE(result.Contains(a) && result.Contains(b));
+
+				result = a;
+				result.AndNot(b);
+				EXPECT_TRUE(result.Count() == expectedAndNot);
+				EXPECT_TRUE(!(result == a) || expectedAnd == 0);
+			}
+		}
+		ArrayOps::SetSimdLevel(supported);
+	}
+}
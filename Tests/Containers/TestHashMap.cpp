@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include "Core/Containers/HashMap.h"
+#include "Core/Containers/Vector.h"
+
+namespace Containers
+{
+	TEST(HashMap, InsertFind)
+	{
+		HashMap<uint32_t, uint32_t> map;
+		for (uint32_t i = 0; i < 10'000; ++i)
+		{
+			EXPECT_TRUE(map.TryEmplace(i, i * 2).second);
+		}
+		EXPECT_TRUE(map.GetSize() == 10'000);
+
+		for (uint32_t i = 0; i < 10'000; ++i)
+		{
+			const uint32_t* value = map.Find(i);
+			ASSERT_TRUE(value != nullptr);
+			EXPECT_TRUE(*value == i * 2);
+		}
+		EXPECT_TRUE(map.Find(10'000u) == nullptr);
+	}
+
+	TEST(HashMap, TryEmplaceKeepsExisting)
+	{
+		HashMap<int, std::string> map;
+		map.TryEmplace(1, "first");
+		auto [value, inserted] = map.TryEmplace(1, "second");
+		EXPECT_TRUE(!inserted);
+		EXPECT_TRUE(*value == "first");
+
+		map.InsertOrAssign(1, std::string("third"));
+		EXPECT_TRUE(*map.Find(1) == "third");
+
+		map[2] = "fourth";
+		EXPECT_TRUE(map[2] == "fourth");
+		EXPECT_TRUE(map.GetSize() == 2);
+	}
+
+	TEST(HashMap, HeterogeneousLookup)
+	{
+		HashMap<std::string, int> map;
+		map.TryEmplace(std::string("Player"), 1);
+		map.TryEmplace(std::string("Camera"), 2);
+
+		const std::string_view name = "Camera";
+		EXPECT_TRUE(map.Contains(name));
+		EXPECT_TRUE(*map.Find("Player") == 1);
+		EXPECT_TRUE(map.Erase("Player"));
+		EXPECT_TRUE(!map.Contains("Player"));
+	}
+
+	TEST(HashMap, EraseAndReinsert)
+	{
+		HashMap<uint64_t, uint64_t> map;
+		for (uint64_t round = 0; round < 10; ++round)
+		{
+			for (uint64_t i = 0; i < 1000; ++i)
+			{
+				map.TryEmplace(round * 1000 + i, i);
+			}
+			for (uint64_t i = 0; i < 1000; ++i)
+			{
+				EXPECT_TRUE(map.Erase(round * 1000 + i));
+			}
+		}
+		EXPECT_TRUE(map.IsEmpty());
+		// tombstones are recycled instead of making the table grow forever
+		EXPECT_TRUE(map.GetCapacity() <= 2048);
+	}
+
+	TEST(HashMap, Iterate)
+	{
+		HashMap<int, int> map;
+		for (int i = 0; i < 100; ++i)
+		{
+			map[i] = i;
+		}
+
+		int sum = 0;
+		size_t count = 0;
+		for (const auto& entry : map)
+		{
+			EXPECT_TRUE(entry.m_Key == entry.m_Value);
+			sum += entry.m_Value;
+			count++;
+		}
+		EXPECT_TRUE(count == 100);
+		EXPECT_TRUE(sum == 4950);
+	}
+
+	TEST(HashMap, CopyAndMove)
+	{
+		HashMap<std::string, Vector<int>> map;
+		map.TryEmplace(std::string("a"), Vector<int>{ 1, 2 });
+		map.TryEmplace(std::string("b"), Vector<int>{ 3 });
+
+		HashMap<std::string, Vector<int>> copy = map;
+		EXPECT_TRUE(copy.GetSize() == 2);
+		EXPECT_TRUE((*copy.Find("a") == Vector<int>{ 1, 2 }));
+
+		HashMap<std::string, Vector<int>> moved = std::move(map);
+		EXPECT_TRUE(moved.GetSize() == 2);
+		EXPECT_TRUE(map.IsEmpty());
+
+		moved.Clear();
+		EXPECT_TRUE(moved.IsEmpty());
+		EXPECT_TRUE(!moved.Contains("b"));
+	}
+
+	// Places the same key in a different slot for every seed
+	struct SeededHash
+	{
+		uint64_t m_Seed{0};
+
+		[[nodiscard]] uint64_t operator()(int key) const { return HashInteger(static_cast<uint64_t>(key) ^ m_Seed); }
+	};
+
+	TEST(HashMap, AssignmentCarriesTheHash)
+	{
+		using SeededMap = HashMap<int, int, SeededHash>;
+		SeededMap map(SeededHash{ 1 });
+		for (int i = 0; i < 100; ++i)
+		{
+			map.TryEmplace(i, i * 2);
+		}
+
+		SeededMap copy(SeededHash{ 2 });
+		copy.TryEmplace(1000, 0);
+		copy = map;
+		EXPECT_TRUE(copy.GetHashFunction().m_Seed == 1);
+		EXPECT_TRUE(copy.GetSize() == 100 && !copy.Contains(1000));
+
+		SeededMap moved(SeededHash{ 3 });
+		moved = std::move(map);
+		EXPECT_TRUE(moved.GetHashFunction().m_Seed == 1);
+		for (int i = 0; i < 100; ++i)
+		{
+			EXPECT_TRUE(*copy.Find(i) == i * 2);
+			EXPECT_TRUE(moved.Find(i) != nullptr && *moved.Find(i) == i * 2);
+		}
+	}
+}
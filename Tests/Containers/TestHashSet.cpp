@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "Core/Containers/HashSet.h"
+
+namespace Containers
+{
+	TEST(HashSet, Insert)
+	{
+		HashSet<int> set;
+		EXPECT_TRUE(set.Insert(1));
+		EXPECT_TRUE(!set.Insert(1));
+		EXPECT_TRUE(set.Insert(2));
+		EXPECT_TRUE(set.GetSize() == 2);
+		EXPECT_TRUE(set.Contains(2));
+		EXPECT_TRUE(!set.Contains(3));
+	}
+
+	TEST(HashSet, Erase)
+	{
+		HashSet<std::string> set;
+		for (int i = 0; i < 1000; ++i)
+		{
+			set.Insert(std::to_string(i));
+		}
+		for (int i = 0; i < 1000; i += 2)
+		{
+			EXPECT_TRUE(set.Erase(std::to_string(i)));
+		}
+		EXPECT_TRUE(set.GetSize() == 500);
+		EXPECT_TRUE(!set.Contains("10"));
+		EXPECT_TRUE(set.Contains("11"));
+
+		size_t count = 0;
+		for (const std::string& key : set)
+		{
+			EXPECT_TRUE(std::stoi(key) % 2 == 1);
+			count++;
+		}
+		EXPECT_TRUE(count == 500);
+	}
+}
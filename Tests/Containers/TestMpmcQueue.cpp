@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Core/Containers/MpmcQueue.h"
+
+namespace Containers
+{
+	TEST(MpmcQueue, PushPop)
+	{
+		MpmcQueue<int, 4> queue;
+		EXPECT_TRUE(queue.IsEmpty());
+		for (int i = 0; i < 4; ++i)
+		{
+			EXPECT_TRUE(queue.TryPush(i));
+		}
+		EXPECT_TRUE(!queue.TryPush(4));
+
+		int value = -1;
+		for (int i = 0; i < 4; ++i)
+		{
+			EXPECT_TRUE(queue.TryPop(value));
+			EXPECT_TRUE(value == i);
+		}
+		EXPECT_TRUE(!queue.TryPop(value));
+
+		// wraps around on the next lap
+		EXPECT_TRUE(queue.TryPush(10));
+		EXPECT_TRUE(queue.TryPop(value));
+		EXPECT_TRUE(value == 10);
+	}
+
+	TEST(MpmcQueue, Batch)
+	{
+		MpmcQueue<int, 8> queue;
+		const int items[6] = { 0, 1, 2, 3, 4, 5 };
+		EXPECT_TRUE(queue.TryPushBatch(items, 6) == 6);
+		EXPECT_TRUE(queue.TryPushBatch(items, 6) == 2);
+		EXPECT_TRUE(queue.GetSize() == 8);
+
+		int popped[8] = {};
+		EXPECT_TRUE(queue.TryPopBatch(popped, 3) == 3);
+		EXPECT_TRUE(popped[0] == 0 && popped[2] == 2);
+		EXPECT_TRUE(queue.TryPopBatch(popped, 8) == 5);
+		EXPECT_TRUE(popped[4] == 1);
+		EXPECT_TRUE(queue.TryPopBatch(popped, 8) == 0);
+	}
+
+	TEST(MpmcQueue, MoveOnly)
+	{
+		MpmcQueue<std::unique_ptr<int>, 2> queue;
+		EXPECT_TRUE(queue.TryPush(std::make_unique<int>(7)));
+		std::unique_ptr<int> value;
+		EXPECT_TRUE(queue.TryPop(value));
+		EXPECT_TRUE(*value == 7);
+		EXPECT_TRUE(queue.TryPush(std::make_unique<int>(8)));
+	}
+
+	// Every producer pushes a distinct range, the consumers must see each value exactly once
+	// No default constructor, counts its destructions
+	struct MpmcCounted
+	{
+		explicit MpmcCounted(int& destroyedCount) : m_DestroyedCount(&destroyedCount) {}
+		MpmcCounted(MpmcCounted&& other) noexcept : m_DestroyedCount(other.m_DestroyedCount) { other.m_DestroyedCount = nullptr; }
+		MpmcCounted& operator=(MpmcCounted&& other) noexcept
+		{
+			std::swap(m_DestroyedCount, other.m_DestroyedCount);
+			return *this;
+		}
+		~MpmcCounted()
+		{
+			if (m_DestroyedCount != nullptr)
+			{
+				++*m_DestroyedCount;
+			}
+		}
+
+		int* m_DestroyedCount;
+	};
+
+	TEST(MpmcQueue, DestroysLeftItems)
+	{
+		int destroyedCount = 0;
+		{
+			MpmcQueue<MpmcCounted, 4> queue;
+			EXPECT_TRUE(queue.TryPush(MpmcCounted(destroyedCount)));
+			EXPECT_TRUE(queue.TryPush(MpmcCounted(destroyedCount)));
+			EXPECT_TRUE(queue.TryPush(MpmcCounted(destroyedCount)));
+			EXPECT_TRUE(destroyedCount == 0);
+		}
+		EXPECT_TRUE(destroyedCount == 3);
+	}
+
+	TEST(MpmcQueue, Threads)
+	{
+		constexpr int ThreadCount = 4;
+		constexpr int ItemsPerProducer = 10000;
+		MpmcQueue<int, 128> queue;
+		std::vector<std::atomic<uint8_t>> seen(ThreadCount * ItemsPerProducer);
+		std::atomic<int> poppedCount = 0;
+
+		std::vector<std::thread> threads;
+		for (int producer = 0; producer < ThreadCount; ++producer)
+		{
+			threads.emplace_back([&queue, producer]()
+			{
+				const int first = producer * ItemsPerProducer;
+				int next = first;
+				int batch[8];
+				while (next < first + ItemsPerProducer)
+				{
+					int count = 0;
+					while (count < 8 && next + count < first + ItemsPerProducer)
+					{
+						batch[count] = next + count;
+						count++;
+					}
+					const int pushed = static_cast<int>(producer % 2 == 0 ? queue.TryPushBatch(batch, count) : queue.TryPush(batch[0]));
+					if (pushed == 0)
+					{
+						// let the consumers run, on few cores spinning only delays them
+						std::this_thread::yield();
+					}
+					next += pushed;
+				}
+			});
+		}
+		for (int consumer = 0; consumer < ThreadCount; ++consumer)
+		{
+			threads.emplace_back([&queue, &seen, &poppedCount, consumer]()
+			{
+				int batch[8];
+				while (poppedCount.load() < ThreadCount * ItemsPerProducer)
+				{
+					const size_t count = consumer % 2 == 0 ? queue.TryPopBatch(batch, 8) : (queue.TryPop(batch[0]) ? 1 : 0);
+					if (count == 0)
+					{
+						std::this_thread::yield();
+					}
+					for (size_t i = 0; i < count; ++i)
+					{
+						seen[batch[i]].fetch_add(1);
+					}
+					poppedCount.fetch_add(static_cast<int>(count));
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		bool exactlyOnce = true;
+		for (const std::atomic<uint8_t>& count : seen)
+		{
+			exactlyOnce = exactlyOnce && count.load() == 1;
+		}
+		EXPECT_TRUE(exactlyOnce);
+		EXPECT_TRUE(queue.IsEmpty());
+	}
+}
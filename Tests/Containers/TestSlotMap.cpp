@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "Core/Containers/SlotMap.h"
+
+namespace Containers
+{
+	TEST(SlotMap, InsertGet)
+	{
+		SlotMap<std::string> map;
+		const Handle64 first = map.Insert("first");
+		const Handle64 second = map.Emplace(3, 'b');
+
+		EXPECT_TRUE(map.GetSize() == 2);
+		EXPECT_TRUE(*map.Get(first) == "first");
+		EXPECT_TRUE(*map.Get(second) == "bbb");
+		EXPECT_TRUE(map.Get(Handle64()) == nullptr);
+	}
+
+	TEST(SlotMap, StaleHandle)
+	{
+		SlotMap<int, Handle32> map;
+		const Handle32 handle = map.Insert(1);
+		EXPECT_TRUE(map.Erase(handle));
+		EXPECT_TRUE(!map.Erase(handle));
+
+		// the slot is reused by the next element, the old handle must not reach it
+		const Handle32 newHandle = map.Insert(2);
+		EXPECT_TRUE(newHandle.GetIndex() == handle.GetIndex());
+		EXPECT_TRUE(!map.Contains(handle));
+		EXPECT_TRUE(map.Get(handle) == nullptr);
+		EXPECT_TRUE(*map.Get(newHandle) == 2);
+	}
+
+	TEST(SlotMap, EraseKeepsDense)
+	{
+		SlotMap<int> map;
+		Handle64 handles[5];
+		for (int i = 0; i < 5; ++i)
+		{
+			handles[i] = map.Insert(i);
+		}
+
+		map.Erase(handles[1]);
+		EXPECT_TRUE(map.GetSize() == 4);
+
+		// the last element moved into the hole and its handle still works
+		EXPECT_TRUE(map.GetData()[1] == 4);
+		EXPECT_TRUE(*map.Get(handles[4]) == 4);
+		EXPECT_TRUE(map.GetHandleAt(1) == handles[4]);
+
+		int sum = 0;
+		for (int value : map)
+		{
+			sum += value;
+		}
+		EXPECT_TRUE(sum == 0 + 2 + 3 + 4);
+	}
+
+	TEST(SlotMap, Clear)
+	{
+		SlotMap<int> map;
+		const Handle64 handle = map.Insert(1);
+		map.Clear();
+		EXPECT_TRUE(map.IsEmpty());
+		EXPECT_TRUE(!map.Contains(handle));
+		EXPECT_TRUE(map.Contains(map.Insert(2)));
+	}
+}
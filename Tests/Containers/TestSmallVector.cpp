@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "Core/Containers/SmallVector.h"
+
+namespace Containers
+{
+	// Counts the allocations so the tests can see when the small vector leaves its inline storage
+	struct SmallCountingAllocator
+	{
+		[[nodiscard]] void* Allocate(size_t size, size_t alignment)
+		{
+			(*m_AllocationCount)++;
+			return HeapAllocator().Allocate(size, alignment);
+		}
+		void Free(void* memory, size_t size, size_t alignment) { HeapAllocator().Free(memory, size, alignment); }
+		[[nodiscard]] bool operator==(const SmallCountingAllocator& other) const { return m_AllocationCount == other.m_AllocationCount; }
+
+		int* m_AllocationCount{nullptr};
+	};
+
+	TEST(SmallVector, Inline)
+	{
+		int allocationCount = 0;
+		SmallVector<int, 8, SmallCountingAllocator> vector(SmallCountingAllocator{ &allocationCount });
+		for (int i = 0; i < 8; ++i)
+		{
+			vector.PushBack(i);
+		}
+		EXPECT_TRUE(vector.IsInline());
+		EXPECT_TRUE(allocationCount == 0);
+		EXPECT_TRUE(vector.GetSize() == 8);
+		EXPECT_TRUE(vector.Back() == 7);
+	}
+
+	TEST(SmallVector, Spill)
+	{
+		int allocationCount = 0;
+		SmallVector<std::string, 4, SmallCountingAllocator> vector(SmallCountingAllocator{ &allocationCount });
+		for (int i = 0; i < 5; ++i)
+		{
+			vector.PushBack(std::string(32, static_cast<char>('a' + i)));
+		}
+		EXPECT_TRUE(!vector.IsInline());
+		EXPECT_TRUE(allocationCount == 1);
+		EXPECT_TRUE(vector[0] == std::string(32, 'a'));
+		EXPECT_TRUE(vector[4] == std::string(32, 'e'));
+
+		// back inline once the elements fit again
+		vector.Erase(vector.begin(), vector.begin() + 2);
+		vector.ShrinkToFit();
+		EXPECT_TRUE(vector.IsInline());
+		EXPECT_TRUE(vector.GetSize() == 3);
+		EXPECT_TRUE(vector.Front() == std::string(32, 'c'));
+	}
+
+	TEST(SmallVector, MoveInline)
+	{
+		SmallVector<std::string, 4> vector{ "a", "b" };
+		SmallVector<std::string, 4> moved = std::move(vector);
+		EXPECT_TRUE(moved.IsInline());
+		EXPECT_TRUE((moved == SmallVector<std::string, 4>{ "a", "b" }));
+		EXPECT_TRUE(vector.IsEmpty());
+	}
+
+	TEST(SmallVector, MoveHeap)
+	{
+		SmallVector<int, 2> vector{ 0,1,2,3 };
+		const int* data = vector.GetData();
+
+		SmallVector<int, 2> moved;
+		moved = std::move(vector);
+		EXPECT_TRUE(moved.GetData() == data);
+		EXPECT_TRUE(vector.IsInline());
+		EXPECT_TRUE(vector.IsEmpty());
+	}
+
+	TEST(SmallVector, AssignGrowthFactor)
+	{
+		SmallVector<int, 2> vector{ 0,1,2,3 };
+		vector.SetGrowthFactor(3.0f);
+
+		SmallVector<int, 2> copy;
+		copy = vector;
+		EXPECT_TRUE(copy.GetGrowthFactor() == 3.0f);
+
+		SmallVector<int, 2> moved;
+		moved = std::move(vector);
+		EXPECT_TRUE(moved.GetGrowthFactor() == 3.0f);
+	}
+
+	TEST(SmallVector, Copy)
+	{
+		SmallVector<int, 2> vector{ 0,1,2,3 };
+		SmallVector<int, 2> copy = vector;
+		EXPECT_TRUE(copy == vector);
+		EXPECT_TRUE(copy.GetData() != vector.GetData());
+	}
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "Core/Containers/SparseSet.h"
+
+namespace Containers
+{
+	TEST(SparseSet, InsertErase)
+	{
+		SparseSet<> set;
+		EXPECT_TRUE(set.IsEmpty());
+		EXPECT_TRUE(set.Insert(10));
+		EXPECT_TRUE(set.Insert(3));
+		EXPECT_TRUE(set.Insert(7));
+		EXPECT_TRUE(!set.Insert(3));
+		EXPECT_TRUE(set.GetSize() == 3);
+		EXPECT_TRUE(set.Contains(10) && set.Contains(3) && !set.Contains(4) && !set.Contains(1000));
+		EXPECT_TRUE(set.IndexOf(7) == 2 && set.IndexOf(4) == set.GetSize());
+
+		// the last id takes the place of the erased one
+		EXPECT_TRUE(set.Erase(10));
+		EXPECT_TRUE(!set.Erase(10));
+		EXPECT_TRUE(set.GetData()[0] == 7 && set.IndexOf(7) == 0);
+		EXPECT_TRUE(!set.Contains(10) && set.GetSize() == 2);
+
+		std::vector<uint32_t> ids(set.begin(), set.end());
+		std::sort(ids.begin(), ids.end());
+		EXPECT_TRUE(ids == std::vector<uint32_t>({ 3, 7 }));
+	}
+
+	TEST(SparseSet, Clear)
+	{
+		SparseSet<uint16_t> set;
+		set.Reserve(16, 64);
+		for (uint16_t id = 0; id < 64; id += 4)
+		{
+			EXPECT_TRUE(set.Insert(id));
+		}
+		EXPECT_TRUE(set.GetSize() == 16);
+		set.Clear();
+		EXPECT_TRUE(set.IsEmpty() && !set.Contains(8));
+		EXPECT_TRUE(set.Insert(8) && set.IndexOf(8) == 0);
+	}
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <utility>
+#include "Core/Containers/SpscQueue.h"
+
+namespace Containers
+{
+	TEST(SpscQueue, PushPop)
+	{
+		SpscQueue<int, 4> queue;
+		EXPECT_TRUE(queue.IsEmpty());
+		for (int i = 0; i < 4; ++i)
+		{
+			EXPECT_TRUE(queue.TryPush(i));
+		}
+		EXPECT_TRUE(!queue.TryPush(4));
+		EXPECT_TRUE(queue.GetSize() == 4);
+
+		int value = -1;
+		for (int i = 0; i < 4; ++i)
+		{
+			EXPECT_TRUE(queue.TryPop(value));
+			EXPECT_TRUE(value == i);
+		}
+		EXPECT_TRUE(!queue.TryPop(value));
+	}
+
+	TEST(SpscQueue, Batch)
+	{
+		SpscQueue<int, 8> queue;
+		const int items[6] = { 0, 1, 2, 3, 4, 5 };
+		EXPECT_TRUE(queue.TryPushBatch(items, 6) == 6);
+		EXPECT_TRUE(queue.TryPushBatch(items, 6) == 2);
+
+		int popped[8] = {};
+		EXPECT_TRUE(queue.TryPopBatch(popped, 8) == 8);
+		EXPECT_TRUE(popped[5] == 5 && popped[6] == 0 && popped[7] == 1);
+		EXPECT_TRUE(queue.TryPopBatch(popped, 8) == 0);
+	}
+
+	TEST(SpscQueue, MoveOnly)
+	{
+		SpscQueue<std::unique_ptr<int>, 2> queue;
+		EXPECT_TRUE(queue.TryPush(std::make_unique<int>(7)));
+		std::unique_ptr<int> value;
+		EXPECT_TRUE(queue.TryPop(value));
+		EXPECT_TRUE(*value == 7);
+
+		// items left in the queue are destroyed with it
+		EXPECT_TRUE(queue.TryPush(std::make_unique<int>(8)));
+	}
+
+	// No default constructor, counts its destructions
+	struct SpscCounted
+	{
+		explicit SpscCounted(int& destroyedCount) : m_DestroyedCount(&destroyedCount) {}
+		SpscCounted(SpscCounted&& other) noexcept : m_DestroyedCount(other.m_DestroyedCount) { other.m_DestroyedCount = nullptr; }
+		SpscCounted& operator=(SpscCounted&& other) noexcept
+		{
+			std::swap(m_DestroyedCount, other.m_DestroyedCount);
+			return *this;
+		}
+		~SpscCounted()
+		{
+			if (m_DestroyedCount != nullptr)
+			{
+				++*m_DestroyedCount;
+			}
+		}
+
+		int* m_DestroyedCount;
+	};
+
+	TEST(SpscQueue, DestroysLeftItems)
+	{
+		int destroyedCount = 0;
+		{
+			SpscQueue<SpscCounted, 4> queue;
+			EXPECT_TRUE(queue.TryPush(SpscCounted(destroyedCount)));
+			EXPECT_TRUE(queue.TryPush(SpscCounted(destroyedCount)));
+			EXPECT_TRUE(queue.TryPush(SpscCounted(destroyedCount)));
+			EXPECT_TRUE(destroyedCount == 0);
+		}
+		EXPECT_TRUE(destroyedCount == 3);
+	}
+
+	TEST(SpscQueue, Threads)
+	{
+		constexpr int ItemCount = 200000;
+		SpscQueue<int, 256> queue;
+
+		std::thread producer([&queue]()
+		{
+			int batch[16];
+			int next = 0;
+			while (next < ItemCount)
+			{
+				if (next % 3 == 0)
+				{
+					if (queue.TryPush(next))
+					{
+						next++;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+					continue;
+				}
+				int count = 0;
+				while (count < 16 && next + count < ItemCount)
+				{
+					batch[count] = next + count;
+					count++;
+				}
+				const int pushed = static_cast<int>(queue.TryPushBatch(batch, count));
+				if (pushed == 0)
+				{
+					// let the consumer run, on few cores spinning only delays it
+					std::this_thread::yield();
+				}
+				next += pushed;
+			}
+		});
+
+		bool ordered = true;
+		int expected = 0;
+		int batch[32];
+		while (expected < ItemCount)
+		{
+			const size_t count = queue.TryPopBatch(batch, 32);
+			if (count == 0)
+			{
+				std::this_thread::yield();
+			}
+			for (size_t i = 0; i < count; ++i)
+			{
+				ordered = ordered && batch[i] == expected;
+				expected++;
+			}
+		}
+		producer.join();
+
+		EXPECT_TRUE(ordered);
+		EXPECT_TRUE(queue.IsEmpty());
+	}
+}
@@ -1,17 +1,168 @@
 #include <gtest/gtest.h>
+#include <memory>
+#include <string>
 #include "Core/Containers/Vector.h"
+#include "Core/Memory/FrameArena.h"
 
 namespace Containers
 {
 	TEST(Vector, GetSize)
 	{
 		Vector<int> vector{ 0,1,2,3 };
-		EXPECT_TRUE(vector.size() == 4);
+		EXPECT_TRUE(vector.GetSize() == 4);
 	}
 	TEST(Vector, Add)
 	{
 		Vector<int> vector{ 0,1,2,3 };
-		vector.push_back(4);
-		EXPECT_TRUE(vector.size() == 5);
+		vector.PushBack(4);
+		EXPECT_TRUE(vector.GetSize() == 5);
+	}
+
+	// Counts the allocations so the tests can see when the vector reallocates
+	struct CountingAllocator
+	{
+		[[nodiscard]] void* Allocate(size_t size, size_t alignment)
+		{
+			(*m_AllocationCount)++;
+			return HeapAllocator().Allocate(size, alignment);
+		}
+		void Free(void* memory, size_t size, size_t alignment) { HeapAllocator().Free(memory, size, alignment); }
+		[[nodiscard]] bool operator==(const CountingAllocator& other) const { return m_AllocationCount == other.m_AllocationCount; }
+
+		int* m_AllocationCount{nullptr};
+	};
+
+	TEST(Vector, Reserve)
+	{
+		int allocationCount = 0;
+		Vector<int, CountingAllocator> vector(CountingAllocator{ &allocationCount });
+		vector.Reserve(100);
+		for (int i = 0; i < 100; ++i)
+		{
+			vector.PushBackUnchecked(i);
+		}
+		EXPECT_TRUE(allocationCount == 1);
+		EXPECT_TRUE(vector.GetSize() == 100);
+		EXPECT_TRUE(vector.Back() == 99);
+	}
+
+	TEST(Vector, GrowthFactor)
+	{
+		int allocationCount = 0;
+		Vector<int, CountingAllocator> vector(CountingAllocator{ &allocationCount });
+		vector.SetGrowthFactor(4.0f);
+		for (int i = 0; i < 256; ++i)
+		{
+			vector.PushBack(i);
+		}
+		// 4, 16, 64 then 256
+		EXPECT_TRUE(allocationCount == 4);
+		EXPECT_TRUE(vector.GetCapacity() == 256);
+	}
+
+	TEST(Vector, AssignCarriesSettings)
+	{
+		int sourceCount = 0;
+		int destinationCount = 0;
+		Vector<int, CountingAllocator> source(CountingAllocator{ &sourceCount });
+		source.SetGrowthFactor(4.0f);
+		source.PushBack(1);
+
+		Vector<int, CountingAllocator> copy(CountingAllocator{ &destinationCount });
+		copy.PushBack(2);
+		copy = source;
+		EXPECT_TRUE(copy.GetGrowthFactor() == 4.0f);
+		EXPECT_TRUE(copy.GetAllocator() == source.GetAllocator());
+		EXPECT_TRUE(copy.GetSize() == 1 && copy[0] == 1);
+
+		Vector<int, CountingAllocator> moved(CountingAllocator{ &destinationCount });
+		moved = std::move(copy);
+		EXPECT_TRUE(moved.GetGrowthFactor() == 4.0f);
+		EXPECT_TRUE(moved.GetAllocator() == source.GetAllocator());
+
+		// later growth goes through the source allocator
+		const int allocationCount = sourceCount;
+		for (int i = 0; i < 16; ++i)
+		{
+			moved.PushBack(i);
+		}
+		EXPECT_TRUE(sourceCount > allocationCount);
+	}
+
+	TEST(Vector, RelocateNonTrivial)
+	{
+		Vector<std::string> vector;
+		for (int i = 0; i < 100; ++i)
+		{
+			vector.PushBack(std::string(32, static_cast<char>('a' + i % 26)));
+		}
+		EXPECT_TRUE(vector[27] == std::string(32, 'b'));
+
+		Vector<std::string> copy = vector;
+		EXPECT_TRUE(copy == vector);
+	}
+
+	TEST(Vector, RelocateUniquePtr)
+	{
+		static_assert(IsTriviallyRelocatableV<std::unique_ptr<int>>);
+
+		Vector<std::unique_ptr<int>> vector;
+		for (int i = 0; i < 100; ++i)
+		{
+			vector.EmplaceBack(std::make_unique<int>(i));
+		}
+		for (int i = 0; i < 100; ++i)
+		{
+			EXPECT_TRUE(*vector[static_cast<size_t>(i)] == i);
+		}
+	}
+
+	TEST(Vector, PushBackSelf)
+	{
+		Vector<std::string> vector{ "first" };
+		for (int i = 0; i < 10; ++i)
+		{
+			// the element comes from the storage that is about to be reallocated
+			vector.PushBack(vector.Front());
+		}
+		EXPECT_TRUE(vector.GetSize() == 11);
+		EXPECT_TRUE(vector.Back() == "first");
+	}
+
+	TEST(Vector, ResizeAndErase)
+	{
+		Vector<int> vector(5, 7);
+		EXPECT_TRUE((vector == Vector<int>{ 7, 7, 7, 7, 7 }));
+
+		vector.Resize(2);
+		vector.PushBack(1);
+		vector.Erase(vector.begin());
+		EXPECT_TRUE((vector == Vector<int>{ 7, 1 }));
+
+		vector.PopBack();
+		vector.Clear();
+		EXPECT_TRUE(vector.IsEmpty());
+	}
+
+	TEST(Vector, Move)
+	{
+		Vector<int> vector{ 0,1,2,3 };
+		const int* data = vector.GetData();
+
+		Vector<int> moved = std::move(vector);
+		EXPECT_TRUE(moved.GetData() == data);
+		EXPECT_TRUE(moved.GetSize() == 4);
+	}
+
+	TEST(Vector, FrameArena)
+	{
+		FrameArena arena;
+		FrameVector<int> vector(arena);
+		for (int i = 0; i < 1000; ++i)
+		{
+			vector.PushBack(i);
+		}
+		EXPECT_TRUE(vector[999] == 999);
+		EXPECT_TRUE(arena.GetUsedBytes() >= 1000 * sizeof(int));
 	}
 }
\ No newline at end of file
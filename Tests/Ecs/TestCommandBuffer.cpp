@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Ecs/CommandBuffer.h"
+#include "Ecs/Query.h"
+#include "Ecs/World.h"
+
+namespace Ecs
+{
+	struct Health
+	{
+		int m_Value;
+	};
+
+	struct Label
+	{
+		std::string m_Value;
+	};
+
+	struct Dead
+	{
+	};
+
+	TEST(CommandBuffer, StructuralChangesDuringQuery)
+	{
+		World world;
+		for (int i = 0; i < 100; ++i)
+		{
+			world.CreateEntity(Health{ i });
+		}
+
+		CommandBuffer commands;
+		Query<const Health> query(world);
+		query.ForEach([&commands](Entity entity, const Health& health)
+		{
+			if (health.m_Value % 2 == 0)
+			{
+				commands.DestroyEntity(entity);
+			}
+			else if (health.m_Value % 5 == 0)
+			{
+				commands.AddComponent(entity, Label{ std::to_string(health.m_Value) });
+			}
+			else
+			{
+				commands.AddComponent(entity, Dead{});
+			}
+			if (health.m_Value == 99)
+			{
+				commands.CreateEntity(Health{ 1000 }, Label{ "spawned" });
+			}
+		});
+		EXPECT_TRUE(world.GetEntityCount() == 100);
+
+		commands.Apply(world);
+		EXPECT_TRUE(commands.IsEmpty());
+		EXPECT_TRUE(world.GetEntityCount() == 51);
+		EXPECT_TRUE(Query<Dead>(world).GetEntityCount() == 40);
+
+		size_t labels = 0;
+		Query<const Health, const Label>(world).ForEach([&labels](const Health& health, const Label& label)
+		{
+			EXPECT_TRUE(health.m_Value == 1000 ? label.m_Value == "spawned" : label.m_Value == std::to_string(health.m_Value));
+			++labels;
+		});
+		EXPECT_EQ(labels, 11u);
+	}
+
+	TEST(CommandBuffer, RecordedOrder)
+	{
+		World world;
+		const Entity entity = world.CreateEntity(Health{ 1 });
+
+		CommandBuffer commands;
+		commands.AddComponent(entity, Label{ "first" });
+		commands.RemoveComponent<Health>(entity);
+		commands.AddComponent(entity, Label{ "second" });
+		commands.DestroyEntity(entity);
+		// dropped, the entity is gone when it runs
+		commands.AddComponent(entity, Label{ "late" });
+		commands.Apply(world);
+
+		EXPECT_TRUE(!world.IsAlive(entity));
+		EXPECT_TRUE(world.GetEntityCount() == 0);
+	}
+
+	TEST(CommandBuffer, PayloadLifetimes)
+	{
+		auto counter = std::make_shared<int>(0);
+		World world;
+		{
+			CommandBuffer commands;
+			commands.CreateEntity(counter);
+			commands.CreateEntity(counter, Health{ 1 });
+			EXPECT_TRUE(counter.use_count() == 3);
+			commands.Apply(world);
+			EXPECT_TRUE(counter.use_count() == 3);
+
+			// never applied, destroyed with the buffer
+			commands.CreateEntity(counter);
+			for (int i = 0; i < 2000; ++i)
+			{
+				commands.CreateEntity(Label{ std::string(64, 'x') });
+			}
+			EXPECT_TRUE(counter.use_count() == 4);
+		}
+		EXPECT_TRUE(counter.use_count() == 3);
+	}
+
+	// Remembers whether it was ever constructed at a misaligned address, payloads included
+	struct alignas(64) CacheLineComponent
+	{
+		explicit CacheLineComponent(float value) : m_Value(value) { Check(); }
+		CacheLineComponent(CacheLineComponent&& other) noexcept : m_Value(other.m_Value) { Check(); }
+		CacheLineComponent& operator=(CacheLineComponent&& other) noexcept
+		{
+			m_Value = other.m_Value;
+			return *this;
+		}
+
+		void Check() const { s_IsMisaligned |= reinterpret_cast<uintptr_t>(this) % alignof(CacheLineComponent) != 0; }
+
+		static inline bool s_IsMisaligned = false;
+		float m_Value;
+	};
+
+	TEST(CommandBuffer, OverAlignedPayloads)
+	{
+		World world;
+		const Entity entity = world.CreateEntity(Health{ 1 });
+		CacheLineComponent::s_IsMisaligned = false;
+
+		CommandBuffer commands;
+		for (int i = 0; i < 100; ++i)
+		{
+			// a small payload between each one shifts the next offset
+			commands.CreateEntity(Health{ i }, CacheLineComponent(static_cast<float>(i)));
+		}
+		commands.AddComponent(entity, CacheLineComponent(42.0f));
+		commands.Apply(world);
+
+		EXPECT_TRUE(!CacheLineComponent::s_IsMisaligned);
+		EXPECT_TRUE(world.GetComponent<CacheLineComponent>(entity)->m_Value == 42.0f);
+		EXPECT_TRUE(world.GetEntityCount() == 101);
+	}
+}
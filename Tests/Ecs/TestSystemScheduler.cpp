@@ -0,0 +1,345 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Ecs/System.h"
+
+namespace Ecs
+{
+	// the other test files of the area have components with the same names
+	namespace
+	{
+		struct Position
+		{
+			float m_Value;
+		};
+
+		struct Velocity
+		{
+			float m_Value;
+		};
+
+		struct Damage
+		{
+			int m_Value;
+		};
+
+		class MoveSystem : public System
+		{
+		public:
+			explicit MoveSystem(World& world) : System(world), m_Query(world)
+			{
+				Writes<Position>();
+				Reads<Velocity>();
+			}
+
+		protected:
+			void OnUpdate(float deltaTime) override
+			{
+				ForEach(m_Query, [deltaTime](Position& position, const Velocity& velocity)
+				{
+					position.m_Value += velocity.m_Value * deltaTime;
+				});
+			}
+
+		private:
+			Query<Position, const Velocity> m_Query;
+		};
+
+		class AccelerateSystem : public System
+		{
+		public:
+			explicit AccelerateSystem(World& world) : System(world), m_Query(world)
+			{
+				Writes<Velocity>();
+			}
+
+		protected:
+			void OnUpdate(float) override
+			{
+				ForEach(m_Query, [](Velocity& velocity)
+				{
+					velocity.m_Value += 1.0f;
+				});
+			}
+
+		private:
+			Query<Velocity> m_Query;
+		};
+
+		// Records the first position it sees
+		class RecordSystem : public System
+		{
+		public:
+			explicit RecordSystem(World& world) : System(world), m_Query(world)
+			{
+				Reads<Position>();
+			}
+
+			float m_FirstPosition{-1.0f};
+
+		protected:
+			void OnUpdate(float) override
+			{
+				m_Query.ForEach([this](const Position& position)
+				{
+					m_FirstPosition = position.m_Value;
+				});
+			}
+
+		private:
+			Query<const Position> m_Query;
+		};
+
+		// Kills every entity with enough damage, and spawns one entity per kill
+		class KillSystem : public System
+		{
+		public:
+			explicit KillSystem(World& world) : System(world), m_Query(world)
+			{
+				Reads<Damage>();
+			}
+
+		protected:
+			void OnUpdate(float) override
+			{
+				ForEach(m_Query, [this](Entity entity, const Damage& damage)
+				{
+					if (damage.m_Value >= 10)
+					{
+						GetCommands().DestroyEntity(entity);
+						GetCommands().CreateEntity(Position{ 0.0f });
+					}
+				});
+			}
+
+		private:
+			Query<const Damage> m_Query;
+		};
+
+		// Looks up the components of other entities instead of querying them
+		class LookupSystem : public System
+		{
+		public:
+			LookupSystem(World& world, Entity target) : System(world), m_Target(target)
+			{
+				Reads<Velocity>();
+				Writes<Damage>();
+			}
+
+		protected:
+			void OnUpdate(float) override
+			{
+				const Velocity* velocity = GetWorld().GetComponent<Velocity>(m_Target);
+				GetMutableComponent<Damage>(m_Target)->m_Value += static_cast<int>(velocity->m_Value);
+			}
+
+		private:
+			Entity m_Target;
+		};
+	}
+
+	TEST(SystemScheduler, ConflictsAreOrdered)
+	{
+		const size_t violations = GetAccessViolationCount();
+		JobSystem jobSystem(4);
+		World world;
+		world.CreateEntity(Position{ 0.0f }, Velocity{ 0.0f });
+
+		MoveSystem move(world);
+		AccelerateSystem accelerate(world);
+		RecordSystem record(world);
+
+		SystemScheduler scheduler(world);
+		scheduler.AddSystem(move);
+		scheduler.AddSystem(accelerate);
+		scheduler.AddSystem(record);
+
+		// accelerate writes what move reads, record reads what move writes, both wait for move only
+		for (int frame = 0; frame < 3; ++frame)
+		{
+			scheduler.Run(jobSystem, 1.0f);
+		}
+		EXPECT_TRUE(scheduler.GetTaskGraph().GetEdgeCount() == 2);
+		EXPECT_TRUE(scheduler.GetTaskGraph().GetCriticalPathTaskCount() == 2);
+
+		// frame 0 moves by 0, frame 1 by 1, frame 2 by 2, always before the velocity changes
+		EXPECT_TRUE(record.m_FirstPosition == 3.0f);
+		EXPECT_TRUE(GetAccessViolationCount() == violations);
+	}
+
+	TEST(SystemScheduler, DeclaredLookups)
+	{
+		JobSystem jobSystem(2);
+		World world;
+		const Entity entity = world.CreateEntity(Velocity{ 3.0f }, Damage{ 1 });
+
+		LookupSystem lookup(world, entity);
+		SystemScheduler scheduler(world);
+		scheduler.AddSystem(lookup);
+
+		const size_t violations = GetAccessViolationCount();
+		scheduler.Run(jobSystem, 0.0f);
+		EXPECT_TRUE(world.GetComponent<Damage>(entity)->m_Value == 4);
+		EXPECT_TRUE(GetAccessViolationCount() == violations);
+	}
+
+	TEST(SystemScheduler, ParallelQuery)
+	{
+		JobSystem jobSystem(4);
+		World world;
+		constexpr int Count = 50000;
+		Vector<Entity> entities;
+		for (int i = 0; i < Count; ++i)
+		{
+			entities.PushBack(world.CreateEntity(Position{ float(i) }, Velocity{ 2.0f }));
+		}
+
+		// large enough to be split over the chunks
+		MoveSystem move(world);
+		SystemScheduler scheduler(world);
+		scheduler.AddSystem(move);
+		scheduler.Run(jobSystem, 0.5f);
+		for (int i = 0; i < Count; ++i)
+		{
+			EXPECT_TRUE(world.GetComponent<Position>(entities[i])->m_Value == float(i + 1));
+		}
+
+		std::atomic<int> visited{0};
+		Query<Velocity> query(world);
+		query.ParallelForEach(jobSystem, [&visited](Velocity& velocity)
+		{
+			velocity.m_Value = 3.0f;
+			visited.fetch_add(1, std::memory_order_relaxed);
+		}, 4);
+		EXPECT_TRUE(visited.load() == Count);
+		EXPECT_TRUE(!world.IsLocked());
+		query.ForEach([](const Velocity& velocity) { EXPECT_TRUE(velocity.m_Value == 3.0f); });
+	}
+
+	TEST(SystemScheduler, CommandsAppliedAfterRun)
+	{
+		JobSystem jobSystem(2);
+		World world;
+		for (int i = 0; i < 20; ++i)
+		{
+			world.CreateEntity(Damage{ i });
+		}
+
+		KillSystem kill(world);
+		SystemScheduler scheduler(world);
+		scheduler.AddSystem(kill);
+		scheduler.Run(jobSystem, 0.0f);
+
+		EXPECT_TRUE(!world.IsLocked());
+		EXPECT_TRUE(Query<Damage>(world).GetEntityCount() == 10);
+		EXPECT_TRUE(Query<Position>(world).GetEntityCount() == 10);
+	}
+
+#if defined(NIH_ECS_VALIDATE_ACCESS)
+	// Counts the violations instead of asserting while it lives
+	class IgnoreViolations
+	{
+	public:
+		IgnoreViolations() : m_Previous(SetAccessViolationHandler([](ComponentTypeId, bool) {})) {}
+		~IgnoreViolations() { SetAccessViolationHandler(m_Previous); }
+
+	private:
+		AccessViolationHandler m_Previous;
+	};
+
+	class SneakySystem : public System
+	{
+	public:
+		explicit SneakySystem(World& world) : System(world), m_Query(world)
+		{
+			Reads<Position>();
+		}
+
+	protected:
+		void OnUpdate(float) override
+		{
+			// only declared as read
+			m_Query.ForEach([](Position&) {});
+		}
+
+	private:
+		Query<Position> m_Query;
+	};
+
+	TEST(SystemScheduler, UndeclaredAccess)
+	{
+		JobSystem jobSystem(2);
+		World world;
+		world.CreateEntity(Position{ 0.0f });
+
+		SneakySystem sneaky(world);
+		SystemScheduler scheduler(world);
+		scheduler.AddSystem(sneaky);
+
+		IgnoreViolations ignore;
+		const size_t violations = GetAccessViolationCount();
+		scheduler.Run(jobSystem, 0.0f);
+		EXPECT_TRUE(GetAccessViolationCount() == violations + 1);
+	}
+
+	class SneakyParallelSystem : public System
+	{
+	public:
+		explicit SneakyParallelSystem(World& world) : System(world), m_Query(world)
+		{
+			Writes<Position>();
+		}
+
+		std::atomic<size_t> m_OtherThreadCount{0};
+
+	protected:
+		void OnUpdate(float) override
+		{
+			// the velocity is never declared, whichever worker runs the chunk
+			const std::thread::id caller = std::this_thread::get_id();
+			ForEach(m_Query, [this, caller](Entity entity, Position&)
+			{
+				if (std::this_thread::get_id() != caller)
+				{
+					m_OtherThreadCount.fetch_add(1, std::memory_order_relaxed);
+				}
+				else
+				{
+					// holds the calling thread until another worker stole a range, even on a single core
+					const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+					while (m_OtherThreadCount.load(std::memory_order_relaxed) == 0 && std::chrono::steady_clock::now() < deadline)
+					{
+						std::this_thread::yield();
+					}
+				}
+				(void)GetWorld().GetComponent<Velocity>(entity);
+			});
+		}
+
+	private:
+		Query<Position> m_Query;
+	};
+
+	TEST(SystemScheduler, UndeclaredAccessInParallelQuery)
+	{
+		JobSystem jobSystem(4);
+		World world;
+		constexpr size_t Count = 20000;
+		for (size_t i = 0; i < Count; ++i)
+		{
+			world.CreateEntity(Position{ 0.0f }, Velocity{ 0.0f });
+		}
+
+		SneakyParallelSystem sneaky(world);
+		SystemScheduler scheduler(world);
+		scheduler.AddSystem(sneaky);
+
+		IgnoreViolations ignore;
+		const size_t violations = GetAccessViolationCount();
+		scheduler.Run(jobSystem, 0.0f);
+		EXPECT_TRUE(sneaky.m_OtherThreadCount.load() > 0);
+		EXPECT_TRUE(GetAccessViolationCount() == violations + Count);
+	}
+#endif
+}
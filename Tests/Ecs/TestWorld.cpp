@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "Core/Memory/CacheLine.h"
+#include "Ecs/Query.h"
+#include "Ecs/World.h"
+
+namespace Ecs
+{
+	struct Position
+	{
+		float m_X, m_Y;
+	};
+
+	struct Velocity
+	{
+		float m_X, m_Y;
+	};
+
+	struct Name
+	{
+		std::string m_Value;
+	};
+
+	struct Frozen
+	{
+	};
+
+	// a row of this does not fit in a standard chunk
+	struct Huge
+	{
+		uint32_t m_Values[ChunkPool::ChunkSize / sizeof(uint32_t)];
+	};
+
+	TEST(World, CreateAndGet)
+	{
+		World world;
+		const Entity entity = world.CreateEntity(Position{ 1.0f, 2.0f }, Name{ "first" });
+		const Entity empty = world.CreateEntity();
+
+		EXPECT_TRUE(world.GetEntityCount() == 2);
+		EXPECT_TRUE(world.IsAlive(entity) && world.IsAlive(empty));
+		EXPECT_TRUE(world.HasComponent<Position>(entity) && !world.HasComponent<Velocity>(entity));
+		EXPECT_TRUE(world.GetComponent<Position>(entity)->m_Y == 2.0f);
+		EXPECT_TRUE(world.GetComponent<Name>(entity)->m_Value == "first");
+		EXPECT_TRUE(world.GetComponent<Position>(empty) == nullptr);
+
+		EXPECT_TRUE(world.DestroyEntity(entity));
+		EXPECT_TRUE(!world.DestroyEntity(entity));
+		EXPECT_TRUE(!world.IsAlive(entity));
+		EXPECT_TRUE(world.GetComponent<Position>(entity) == nullptr);
+	}
+
+	TEST(World, AddRemoveComponents)
+	{
+		World world;
+		const Entity entity = world.CreateEntity(Position{ 1.0f, 2.0f });
+		world.AddComponent(entity, Name{ "moved" });
+		world.AddComponent(entity, Velocity{ 3.0f, 4.0f });
+
+		EXPECT_TRUE(world.GetComponent<Position>(entity)->m_X == 1.0f);
+		EXPECT_TRUE(world.GetComponent<Name>(entity)->m_Value == "moved");
+		EXPECT_TRUE(world.GetComponent<Velocity>(entity)->m_Y == 4.0f);
+
+		// adding again assigns
+		world.AddComponent(entity, Velocity{ 5.0f, 6.0f });
+		EXPECT_TRUE(world.GetComponent<Velocity>(entity)->m_X == 5.0f);
+
+		EXPECT_TRUE(world.RemoveComponent<Position>(entity));
+		EXPECT_TRUE(!world.RemoveComponent<Position>(entity));
+		EXPECT_TRUE(!world.HasComponent<Position>(entity));
+		EXPECT_TRUE(world.GetComponent<Name>(entity)->m_Value == "moved");
+	}
+
+	// Asserts in debug builds, a stale handle is a bug of the caller
+#if !defined(ENABLE_ASSERT)
+	TEST(World, StaleHandle)
+	{
+		World world;
+		const Entity stale = world.CreateEntity(Position{ 1.0f, 2.0f });
+		EXPECT_TRUE(world.DestroyEntity(stale));
+		// the slot is reused with a new generation
+		const Entity entity = world.CreateEntity(Position{ 3.0f, 4.0f });
+
+		EXPECT_TRUE(world.AddComponent(stale, Velocity{ 1.0f, 1.0f }) == nullptr);
+		EXPECT_TRUE(world.AddComponent(stale, Name{ "stale" }) == nullptr);
+		Velocity velocity{ 2.0f, 2.0f };
+		EXPECT_TRUE(!world.AddComponent(stale, GetComponentTypeId<Velocity>(), &velocity));
+		EXPECT_TRUE(!world.RemoveComponent<Position>(stale));
+
+		EXPECT_TRUE(!world.HasComponent<Velocity>(entity));
+		EXPECT_TRUE(world.GetComponent<Position>(entity)->m_X == 3.0f);
+		EXPECT_TRUE(world.GetEntityCount() == 1);
+	}
+#endif
+
+	// Destroying entities moves the last row in the hole, every other entity must keep its components
+	TEST(World, DestroyKeepsOthers)
+	{
+		World world;
+		constexpr int Count = 3000;
+		Entity entities[Count];
+		for (int i = 0; i < Count; ++i)
+		{
+			entities[i] = world.CreateEntity(Position{ float(i), 0.0f }, Name{ std::to_string(i) });
+		}
+		for (int i = 0; i < Count; i += 3)
+		{
+			world.DestroyEntity(entities[i]);
+		}
+
+		EXPECT_TRUE(world.GetEntityCount() == Count - Count / 3);
+		for (int i = 0; i < Count; ++i)
+		{
+			if (i % 3 == 0)
+			{
+				EXPECT_TRUE(!world.IsAlive(entities[i]));
+				continue;
+			}
+			EXPECT_TRUE(world.GetComponent<Position>(entities[i])->m_X == float(i));
+			EXPECT_TRUE(world.GetComponent<Name>(entities[i])->m_Value == std::to_string(i));
+		}
+	}
+
+	TEST(World, ChunkLayout)
+	{
+		World world;
+		for (int i = 0; i < 2000; ++i)
+		{
+			world.CreateEntity(Position{}, Velocity{});
+		}
+
+		const World::Location* location = world.GetLocation(world.CreateEntity(Position{}, Velocity{}));
+		const Archetype& archetype = *location->m_Archetype;
+		EXPECT_TRUE(archetype.GetEntityCount() == 2001);
+		EXPECT_TRUE(archetype.GetChunkCapacity() * (sizeof(Entity) + sizeof(Position) + sizeof(Velocity)) <= ChunkPool::ChunkSize);
+		EXPECT_TRUE(archetype.GetChunkCount() == (2001 + archetype.GetChunkCapacity() - 1) / archetype.GetChunkCapacity());
+		for (size_t column = 0; column < archetype.GetColumnCount(); ++column)
+		{
+			EXPECT_TRUE(archetype.GetColumnOffset(column) % CacheLineSize == 0);
+		}
+	}
+
+	TEST(World, OversizedRows)
+	{
+		World world;
+		Vector<Entity> entities;
+		for (uint32_t i = 0; i < 4; ++i)
+		{
+			auto huge = std::make_unique<Huge>();
+			huge->m_Values[0] = i;
+			huge->m_Values[std::size(huge->m_Values) - 1] = i + 100;
+			entities.PushBack(world.CreateEntity(Position{ float(i), 0.0f }, *huge));
+		}
+
+		const Archetype& archetype = *world.GetLocation(entities[0])->m_Archetype;
+		EXPECT_TRUE(archetype.GetChunkCapacity() == 1);
+		EXPECT_TRUE(archetype.GetChunkSize() > ChunkPool::ChunkSize);
+		EXPECT_TRUE(archetype.GetChunkCount() == 4);
+		for (size_t column = 0; column < archetype.GetColumnCount(); ++column)
+		{
+			EXPECT_TRUE(archetype.GetColumnOffset(column) >= sizeof(Entity));
+		}
+
+		world.DestroyEntity(entities[1]);
+		EXPECT_TRUE(archetype.GetChunkCount() == 3);
+		for (uint32_t i = 0; i < 4; ++i)
+		{
+			if (i == 1)
+			{
+				continue;
+			}
+			const Huge* huge = world.GetComponent<Huge>(entities[i]);
+			EXPECT_TRUE(huge->m_Values[0] == i && huge->m_Values[std::size(huge->m_Values) - 1] == i + 100);
+			EXPECT_TRUE(world.GetComponent<Position>(entities[i])->m_X == float(i));
+		}
+	}
+
+	TEST(World, ComponentLifetimes)
+	{
+		auto counter = std::make_shared<int>(0);
+		{
+			World world;
+			const Entity first = world.CreateEntity(counter);
+			world.CreateEntity(counter, Position{});
+			EXPECT_TRUE(counter.use_count() == 3);
+
+			world.AddComponent(first, Velocity{});
+			world.RemoveComponent<std::shared_ptr<int>>(first);
+			EXPECT_TRUE(counter.use_count() == 2);
+		}
+		EXPECT_TRUE(counter.use_count() == 1);
+	}
+
+	TEST(Query, ForEach)
+	{
+		World world;
+		for (int i = 0; i < 1000; ++i)
+		{
+			world.CreateEntity(Position{ float(i), 0.0f }, Velocity{ 1.0f, 2.0f });
+			world.CreateEntity(Position{ float(i), 0.0f }, Velocity{ 1.0f, 2.0f }, Name{});
+			world.CreateEntity(Position{ float(i), 0.0f });
+		}
+		world.CreateEntity(Position{}, Velocity{}, Frozen{});
+
+		Query<Position, const Velocity> query(world);
+		query.Without<Frozen>();
+		EXPECT_TRUE(query.GetEntityCount() == 2000);
+
+		query.ForEach([](Position& position, const Velocity& velocity)
+		{
+			position.m_X += velocity.m_X;
+			position.m_Y += velocity.m_Y;
+		});
+
+		float sum = 0.0f;
+		size_t count = 0;
+		Query<const Position>(world).ForEach([&sum, &count](const Position& position)
+		{
+			sum += position.m_Y;
+			++count;
+		});
+		EXPECT_TRUE(count == 3001);
+		EXPECT_TRUE(sum == 4000.0f);
+
+		// archetypes created after the first run are picked up
+		world.CreateEntity(Velocity{}, Position{}, Frozen{}, Name{});
+		world.CreateEntity(Velocity{}, Name{}, Position{ 0.0f, 0.0f });
+		EXPECT_TRUE(query.GetEntityCount() == 2001);
+	}
+
+	TEST(Query, Chunks)
+	{
+		World world;
+		Entity entities[500];
+		for (int i = 0; i < 500; ++i)
+		{
+			entities[i] = world.CreateEntity(Position{ float(i), 0.0f });
+		}
+
+		Query<Position> query(world);
+		size_t total = 0;
+		query.ForEachChunk([&](const Query<Position>::View& chunk)
+		{
+			EXPECT_TRUE(world.IsLocked());
+			const Position* positions = chunk.Get<Position>();
+			for (size_t i = 0; i < chunk.GetCount(); ++i)
+			{
+				EXPECT_TRUE(world.GetComponent<Position>(chunk.GetEntities()[i]) == &positions[i]);
+			}
+			total += chunk.GetCount();
+		});
+		EXPECT_TRUE(total == 500);
+		EXPECT_TRUE(!world.IsLocked());
+
+		query.ForEach([&entities](Entity entity, Position& position)
+		{
+			EXPECT_TRUE(entities[int(position.m_X)] == entity);
+		});
+	}
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "Engine/Clock.h"
+#include "Engine/Engine.h"
+#include "Window/HeadlessWindow.h"
+
+namespace Runtime
+{
+	TEST(Engine, Headless)
+	{
+		VirtualClock clock;
+		clock.SetAutoAdvanceSeconds(1.0 / 60.0);
+
+		auto window = std::make_unique<HeadlessWindow>();
+		HeadlessWindow* headlessWindow = window.get();
+
+		Engine engine;
+		engine.SetWindow(std::move(window));
+		engine.SetClock(clock);
+		engine.Init();
+		engine.RunFrames(10);
+
+		EXPECT_TRUE(engine.GetTimer().GetFrameCount() == 10);
+		EXPECT_TRUE(headlessWindow->GetRenderCount() == 10);
+	}
+
+	TEST(Engine, FixedStepInterpolation)
+	{
+		VirtualClock clock;
+		clock.SetAutoAdvanceSeconds(1.0 / 100.0);
+
+		auto window = std::make_unique<HeadlessWindow>();
+		HeadlessWindow* headlessWindow = window.get();
+
+		Engine engine;
+		engine.SetWindow(std::move(window));
+		engine.SetClock(clock);
+		engine.GetTimer().SetFixedTimeStep(true);
+		engine.GetTimer().SetTargetElapsedSeconds(1.0 / 25.0);
+		engine.Init();
+		engine.RunFrames(10);
+
+		// simulate at 25 Hz but render every frame once the first step ran, and pump messages every frame
+		EXPECT_TRUE(engine.GetTimer().GetFrameCount() == 2);
+		EXPECT_TRUE(headlessWindow->GetRenderCount() == 7);
+		EXPECT_TRUE(headlessWindow->GetUpdateMessagesCount() == 10);
+		EXPECT_NEAR(headlessWindow->GetLastSnapshot().m_InterpolationAlpha, 0.5, 0.001);
+	}
+
+	TEST(Engine, QuitEvent)
+	{
+		VirtualClock clock;
+		clock.SetAutoAdvanceSeconds(1.0 / 60.0);
+
+		auto window = std::make_unique<HeadlessWindow>();
+		WindowEvent quit;
+		quit.m_Type = WindowEventType::Quit;
+		window->PostEvent(quit);
+
+		Engine engine;
+		engine.SetWindow(std::move(window));
+		engine.SetClock(clock);
+		engine.Init();
+		engine.RunFrames(10);
+
+		EXPECT_TRUE(engine.GetTimer().GetFrameCount() == 1);
+	}
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include "Engine/Clock.h"
+#include "Engine/Engine.h"
+#include "Engine/FramePipeline.h"
+#include "Render/NullRenderBackend.h"
+#include "Render/ParallelSubmit.h"
+#include "Render/RenderBucket.h"
+#include "Tasks/Parallel.h"
+#include "Tasks/Task.h"
+#include "Window/HeadlessWindow.h"
+
+namespace Runtime
+{
+	namespace
+	{
+		// Pushes the same draws every frame from jobs of the engine, in reverse key order
+		class DrawTask : public Task
+		{
+		public:
+			static constexpr size_t DrawCount = 1000;
+
+			explicit DrawTask(JobSystem& jobSystem) : m_JobSystem(jobSystem) {}
+
+			void Init() override {}
+			void Update(float) override {}
+
+			void RecordDraws(RenderBucket& bucket) override
+			{
+				ParallelFor(m_JobSystem, IndexRange{ 0, DrawCount }, 64, [this, &bucket](size_t index)
+				{
+					const uint32_t draw = static_cast<uint32_t>(DrawCount - index);
+					DrawPacket packet{};
+					packet.m_Pipeline = draw % 4;
+					packet.m_Mesh = draw;
+					bucket.Push(m_JobSystem, SortKey::MakeOpaque(0, 0, packet.m_Pipeline, 0, draw), packet);
+				});
+			}
+
+		private:
+			JobSystem& m_JobSystem;
+		};
+	}
+
+	TEST(FramePipeline, Inline)
+	{
+		HeadlessWindow window;
+		FramePipeline pipeline(window, 0);
+
+		RenderSnapshot& snapshot = pipeline.BeginSnapshot();
+		snapshot.m_FrameIndex = 42;
+		pipeline.Submit();
+
+		EXPECT_TRUE(window.GetRenderCount() == 1);
+		EXPECT_TRUE(window.GetLastSnapshot().m_FrameIndex == 42);
+	}
+
+	TEST(FramePipeline, RenderThread)
+	{
+		HeadlessWindow window;
+		FramePipeline pipeline(window, 2);
+
+		for (uint64_t frame = 0; frame < 100; ++frame)
+		{
+			RenderSnapshot& snapshot = pipeline.BeginSnapshot();
+			snapshot.m_FrameIndex = frame;
+			pipeline.Submit();
+			EXPECT_TRUE(pipeline.GetSubmittedFrameCount() - pipeline.GetRenderedFrameCount() <= 3);
+		}
+		pipeline.Flush();
+
+		EXPECT_TRUE(pipeline.GetRenderedFrameCount() == 100);
+		EXPECT_TRUE(window.GetRenderCount() == 100);
+		EXPECT_TRUE(window.GetLastSnapshot().m_FrameIndex == 99);
+	}
+
+	TEST(FramePipeline, PipelinedEngine)
+	{
+		VirtualClock clock;
+		clock.SetAutoAdvanceSeconds(1.0 / 60.0);
+
+		auto window = std::make_unique<HeadlessWindow>();
+		HeadlessWindow* headlessWindow = window.get();
+
+		Engine engine;
+		engine.SetWindow(std::move(window));
+		engine.SetClock(clock);
+		engine.SetPipelineDepth(1);
+		engine.Init();
+		engine.RunFrames(10);
+
+		// leaving the simulation waits for the render thread
+		EXPECT_TRUE(headlessWindow->GetRenderCount() == 10);
+		EXPECT_TRUE(headlessWindow->GetLastSnapshot().m_SimulationFrame == 10);
+	}
+
+	TEST(FramePipeline, SlotBuckets)
+	{
+		HeadlessWindow window;
+		FramePipeline pipeline(window, 2);
+
+		// the ring has three slots, every one with its own bucket
+		const RenderBucket* buckets[4] = {};
+		for (uint64_t frame = 0; frame < 4; ++frame)
+		{
+			RenderSnapshot& snapshot = pipeline.BeginSnapshot();
+			EXPECT_TRUE(snapshot.m_Bucket == &pipeline.GetSnapshotBucket());
+			EXPECT_TRUE(snapshot.m_Bucket->GetSize() == 0);
+			pipeline.GetSnapshotBucket().Push(0, frame, DrawPacket{});
+			pipeline.GetSnapshotBucket().Sort();
+			buckets[frame] = snapshot.m_Bucket;
+			pipeline.Submit();
+		}
+		pipeline.Flush();
+
+		EXPECT_TRUE(buckets[0] != buckets[1] && buckets[1] != buckets[2] && buckets[0] != buckets[2]);
+		EXPECT_TRUE(buckets[3] == buckets[0]);
+		EXPECT_TRUE(window.GetDrawCount() == 4);
+	}
+
+	TEST(FramePipeline, EngineRecordsDraws)
+	{
+		for (uint32_t depth = 0; depth < 3; ++depth)
+		{
+			VirtualClock clock;
+			clock.SetAutoAdvanceSeconds(1.0 / 60.0);
+
+			auto window = std::make_unique<HeadlessWindow>();
+			HeadlessWindow* headlessWindow = window.get();
+
+			Engine engine;
+			engine.SetWindow(std::move(window));
+			engine.SetClock(clock);
+			engine.SetPipelineDepth(depth);
+			engine.Init();
+
+			DrawTask task(engine.GetTaskManager().GetJobSystem());
+			engine.GetTaskManager().AddTask(&task);
+			engine.RunFrames(10);
+
+			// the buckets are cleared with their slot, every frame draws its own packets sorted by pipeline
+			// and each range sets its first pipeline again
+			size_t pipelineChanges = 0;
+			for (size_t i = 0; i < headlessWindow->GetRenderBackendCount(); ++i)
+			{
+				pipelineChanges += headlessWindow->GetRenderBackend(i).GetPipelineChanges();
+			}
+			EXPECT_TRUE(headlessWindow->GetDrawCount() == 10 * DrawTask::DrawCount);
+			EXPECT_TRUE(pipelineChanges <= 10 * (4 + headlessWindow->GetLastRangeCount() - 1));
+		}
+	}
+
+	TEST(FramePipeline, ParallelRecording)
+	{
+		JobSystem jobSystem(4);
+		HeadlessWindow window;
+		FramePipeline pipeline(window, 0);
+
+		constexpr uint32_t DrawCount = 4000;
+		RenderSnapshot& snapshot = pipeline.BeginSnapshot();
+		snapshot.m_JobSystem = &jobSystem;
+		RenderBucket& bucket = pipeline.GetSnapshotBucket();
+		for (uint32_t i = 0; i < DrawCount; ++i)
+		{
+			DrawPacket packet{};
+			packet.m_Pipeline = i % 8;
+			packet.m_Mesh = i;
+			bucket.Push(jobSystem, SortKey::MakeOpaque(0, 0, packet.m_Pipeline, 0, DrawCount - i), packet);
+		}
+		bucket.Sort();
+		pipeline.Submit();
+
+		// one range per worker, each recorded what a serial submit of its range records
+		EXPECT_TRUE(window.GetLastRangeCount() == 4);
+		EXPECT_TRUE(window.GetDrawCount() == DrawCount);
+		for (uint32_t range = 0; range < window.GetLastRangeCount(); ++range)
+		{
+			NullRenderBackend expected;
+			bucket.Submit(expected, ParallelSubmit::GetRange(DrawCount, 4, range));
+			EXPECT_TRUE(window.GetRenderBackend(range).GetDrawCount() == DrawCount / 4);
+			EXPECT_TRUE(window.GetRenderBackend(range).GetChecksum() == expected.GetChecksum());
+		}
+	}
+}
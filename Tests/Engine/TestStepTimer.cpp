@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "Engine/Clock.h"
+#include "Engine/StepTimer.h"
+
+namespace Runtime
+{
+	TEST(StepTimer, VariableTimeStep)
+	{
+		VirtualClock clock;
+		DX::StepTimer timer(clock);
+
+		uint32_t updateCount = 0;
+		clock.AdvanceSeconds(0.016);
+		timer.Tick([&updateCount]() { updateCount++; });
+
+		EXPECT_TRUE(updateCount == 1);
+		EXPECT_TRUE(timer.GetElapsedTicks() == DX::StepTimer::SecondsToTicks(0.016));
+		EXPECT_TRUE(timer.GetFrameCount() == 1);
+	}
+
+	TEST(StepTimer, FixedTimeStep)
+	{
+		VirtualClock clock(1'000'000'000);
+		DX::StepTimer timer(clock);
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedSeconds(1.0 / 60.0);
+
+		uint32_t updateCount = 0;
+		clock.AdvanceSeconds(1.0 / 30.0);
+		timer.Tick([&updateCount]() { updateCount++; });
+		EXPECT_TRUE(updateCount == 2);
+
+		// not enough time for a full step
+		clock.AdvanceSeconds(0.005);
+		timer.Tick([&updateCount]() { updateCount++; });
+		EXPECT_TRUE(updateCount == 2);
+	}
+
+	TEST(StepTimer, ClampLargeDelta)
+	{
+		VirtualClock clock;
+		DX::StepTimer timer(clock);
+
+		clock.AdvanceSeconds(5.0);
+		timer.Tick([]() {});
+		EXPECT_TRUE(timer.GetElapsedSeconds() <= 0.1);
+	}
+
+	TEST(StepTimer, MaxSubSteps)
+	{
+		VirtualClock clock(1'000'000'000);
+		DX::StepTimer timer(clock);
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedSeconds(1.0 / 60.0);
+		timer.SetMaxSubSteps(2);
+
+		// 5.5 steps late, only 2 of them are simulated
+		uint32_t updateCount = 0;
+		clock.Advance(timer.GetTargetElapsedTicks() * 11 / 2 * 100);
+		timer.Tick([&updateCount]() { updateCount++; });
+		EXPECT_TRUE(updateCount == 2);
+		EXPECT_TRUE(timer.GetDroppedTicks() == timer.GetTargetElapsedTicks() * 3);
+		EXPECT_NEAR(timer.GetInterpolationAlpha(), 0.5, 0.001);
+	}
+
+	TEST(StepTimer, InterpolationAlpha)
+	{
+		VirtualClock clock(1'000'000'000);
+		DX::StepTimer timer(clock);
+		EXPECT_TRUE(timer.GetInterpolationAlpha() == 1.0);
+
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedSeconds(1.0 / 30.0);
+
+		clock.AdvanceSeconds(1.0 / 120.0);
+		timer.Tick([]() {});
+		EXPECT_NEAR(timer.GetInterpolationAlpha(), 0.25, 0.001);
+
+		clock.AdvanceSeconds(1.0 / 120.0);
+		timer.Tick([]() {});
+		EXPECT_NEAR(timer.GetInterpolationAlpha(), 0.5, 0.001);
+	}
+
+	TEST(StepTimer, AdaptiveTimeStep)
+	{
+		VirtualClock clock(1'000'000'000);
+		DX::StepTimer timer(clock);
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedSeconds(1.0 / 60.0);
+		timer.SetMaxSubSteps(2);
+		timer.SetAdaptiveTimeStep(true, 20.0);
+
+		// sustained overload, every frame is 4 steps late
+		for (uint32_t frame = 0; frame < 1000; ++frame)
+		{
+			clock.AdvanceSeconds(4.0 / 60.0);
+			timer.Tick([]() {});
+		}
+		EXPECT_TRUE(timer.GetSimulationRate() < 60.0);
+		EXPECT_TRUE(timer.GetSimulationRate() >= 20.0);
+
+		// at the lowered rate the budget is enough to keep up
+		const uint64_t droppedTicks = timer.GetDroppedTicks();
+		for (uint32_t frame = 0; frame < 100; ++frame)
+		{
+			clock.AdvanceSeconds(4.0 / 60.0);
+			timer.Tick([]() {});
+		}
+		EXPECT_TRUE(timer.GetDroppedTicks() == droppedTicks);
+
+		// frames are cheap again, back to the requested rate
+		for (uint32_t frame = 0; frame < 1000; ++frame)
+		{
+			clock.AdvanceSeconds(1.0 / 240.0);
+			timer.Tick([]() {});
+		}
+		EXPECT_NEAR(timer.GetSimulationRate(), 60.0, 0.01);
+	}
+
+	TEST(VirtualClock, AutoAdvance)
+	{
+		VirtualClock clock;
+		clock.SetAutoAdvance(10);
+		EXPECT_TRUE(clock.GetTicks() == 0);
+		EXPECT_TRUE(clock.GetTicks() == 10);
+		EXPECT_TRUE(clock.GetTicks() == 20);
+	}
+}
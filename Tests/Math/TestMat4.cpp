@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Core/Math/Math.h"
+
+namespace Math
+{
+	static bool IsNear(const Vec3& a, const Vec3& b, float epsilon = 1e-5f)
+	{
+		return std::fabs(a.m_X - b.m_X) < epsilon && std::fabs(a.m_Y - b.m_Y) < epsilon && std::fabs(a.m_Z - b.m_Z) < epsilon;
+	}
+
+	static bool IsNear(const Mat4& a, const Mat4& b, float epsilon = 1e-5f)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			if (!IsNear(a.m_Rows[row].GetXYZ(), b.m_Rows[row].GetXYZ(), epsilon) || std::fabs(a.m_Rows[row].m_W - b.m_Rows[row].m_W) >= epsilon)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	TEST(Mat4, Transform)
+	{
+		const Mat4 translation = Mat4::CreateTranslation(Vec3(1.0f, 2.0f, 3.0f));
+		EXPECT_TRUE(translation.TransformPoint(Vec3::Zero()) == Vec3(1.0f, 2.0f, 3.0f));
+		EXPECT_TRUE(translation.TransformVector(Vec3::UnitX()) == Vec3::UnitX());
+		EXPECT_TRUE(Mat4::CreateScale(Vec3(2.0f)).TransformPoint(Vec3(1.0f, 2.0f, 3.0f)) == Vec3(2.0f, 4.0f, 6.0f));
+
+		const Quat rotation = Quat::CreateFromAxisAngle(Normalize(Vec3(1.0f, 1.0f, 0.0f)), 0.7f);
+		const Vec3 point(0.3f, -2.0f, 5.0f);
+		EXPECT_TRUE(IsNear(Mat4::CreateFromQuaternion(rotation).TransformPoint(point), Rotate(rotation, point)));
+	}
+
+	TEST(Mat4, Multiply)
+	{
+		// row vectors: a * b applies a first
+		const Mat4 scale = Mat4::CreateScale(Vec3(2.0f));
+		const Mat4 translation = Mat4::CreateTranslation(Vec3(1.0f, 0.0f, 0.0f));
+		EXPECT_TRUE((scale * translation).TransformPoint(Vec3::UnitX()) == Vec3(3.0f, 0.0f, 0.0f));
+		EXPECT_TRUE((translation * scale).TransformPoint(Vec3::UnitX()) == Vec3(4.0f, 0.0f, 0.0f));
+		EXPECT_TRUE(Mat4::Identity() * translation == translation);
+
+		const Quat rotation = Quat::CreateFromAxisAngle(Vec3::UnitY(), 1.2f);
+		const Mat4 affine = Mat4::CreateAffine(Vec3(1.0f, 2.0f, 3.0f), rotation, Vec3(4.0f, 5.0f, 6.0f));
+		EXPECT_TRUE(IsNear(affine, Mat4::CreateScale(Vec3(1.0f, 2.0f, 3.0f)) * Mat4::CreateFromQuaternion(rotation) * translation * Mat4::CreateTranslation(Vec3(3.0f, 5.0f, 6.0f))));
+	}
+
+	TEST(Mat4, Inverse)
+	{
+		const Mat4 affine = Mat4::CreateAffine(Vec3(1.0f, 2.0f, 0.5f), Quat::CreateFromAxisAngle(Vec3::UnitZ(), 0.4f), Vec3(-3.0f, 1.0f, 8.0f));
+		EXPECT_TRUE(IsNear(affine * Inverse(affine), Mat4::Identity()));
+
+		const Mat4 projection = Mat4::CreatePerspectiveFieldOfView(Pi / 4.0f, 16.0f / 9.0f, 0.1f, 10.0f);
+		EXPECT_TRUE(IsNear(Inverse(projection) * projection, Mat4::Identity(), 1e-4f));
+		EXPECT_TRUE(IsNear(Transpose(Transpose(affine)), affine));
+		EXPECT_TRUE(Inverse(Mat4::CreateScale(Vec3::Zero())) == Mat4::Identity());
+	}
+
+	// Same values as XMMatrixLookAtRH / XMMatrixPerspectiveFovRH
+	TEST(Mat4, Camera)
+	{
+		const Mat4 view = Mat4::CreateLookAt(Vec3(0.0f, 0.0f, 5.0f), Vec3::Zero(), Vec3::UnitY());
+		EXPECT_TRUE(IsNear(view.TransformPoint(Vec3::Zero()), Vec3(0.0f, 0.0f, -5.0f)));
+		EXPECT_TRUE(IsNear(view.TransformPoint(Vec3(1.0f, 0.0f, 5.0f)), Vec3(1.0f, 0.0f, 0.0f)));
+
+		const Mat4 projection = Mat4::CreatePerspectiveFieldOfView(Pi / 2.0f, 1.0f, 1.0f, 100.0f);
+		// the near plane maps to depth 0 and the far plane to depth 1
+		const Vec4 nearPoint = projection.Transform(Vec4(0.0f, 0.0f, -1.0f, 1.0f));
+		const Vec4 farPoint = projection.Transform(Vec4(0.0f, 0.0f, -100.0f, 1.0f));
+		EXPECT_TRUE(std::fabs(nearPoint.m_Z / nearPoint.m_W) < 1e-5f);
+		EXPECT_TRUE(std::fabs(farPoint.m_Z / farPoint.m_W - 1.0f) < 1e-5f);
+	}
+}
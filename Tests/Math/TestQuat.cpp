@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Core/Math/Math.h"
+
+namespace Math
+{
+	static bool IsNear(const Vec3& a, const Vec3& b, float epsilon = 1e-5f)
+	{
+		return std::fabs(a.m_X - b.m_X) < epsilon && std::fabs(a.m_Y - b.m_Y) < epsilon && std::fabs(a.m_Z - b.m_Z) < epsilon;
+	}
+
+	static bool IsNear(const Mat4& a, const Mat4& b, float epsilon = 1e-5f)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			if (!IsNear(a.m_Rows[row].GetXYZ(), b.m_Rows[row].GetXYZ(), epsilon) || std::fabs(a.m_Rows[row].m_W - b.m_Rows[row].m_W) >= epsilon)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	TEST(Quat, Rotate)
+	{
+		// a quarter turn around Z takes X to Y
+		const Quat quarter = Quat::CreateFromAxisAngle(Vec3::UnitZ(), Pi * 0.5f);
+		EXPECT_TRUE(IsNear(Rotate(quarter, Vec3::UnitX()), Vec3::UnitY()));
+		EXPECT_TRUE(IsNear(Rotate(Conjugate(quarter), Vec3::UnitY()), Vec3::UnitX()));
+		EXPECT_TRUE(Rotate(Quat::Identity(), Vec3(1.0f, 2.0f, 3.0f)) == Vec3(1.0f, 2.0f, 3.0f));
+	}
+
+	TEST(Quat, Compose)
+	{
+		const Quat aroundZ = Quat::CreateFromAxisAngle(Vec3::UnitZ(), Pi * 0.5f);
+		const Quat aroundX = Quat::CreateFromAxisAngle(Vec3::UnitX(), Pi * 0.5f);
+		// a first, then b, like Mat4
+		const Vec3 composed = Rotate(aroundZ * aroundX, Vec3::UnitX());
+		EXPECT_TRUE(IsNear(composed, Rotate(aroundX, Rotate(aroundZ, Vec3::UnitX()))));
+		EXPECT_TRUE(IsNear(composed, Vec3::UnitZ()));
+
+		const Quat tilted = Quat::CreateFromAxisAngle(Normalize(Vec3(1.0f, 2.0f, 3.0f)), 0.7f);
+		EXPECT_TRUE(IsNear(Mat4::CreateFromQuaternion(aroundZ * tilted), Mat4::CreateFromQuaternion(aroundZ) * Mat4::CreateFromQuaternion(tilted)));
+		EXPECT_TRUE(IsNear(Mat4::CreateFromQuaternion(tilted * aroundX), Mat4::CreateFromQuaternion(tilted) * Mat4::CreateFromQuaternion(aroundX)));
+	}
+
+	TEST(Quat, Slerp)
+	{
+		const Quat start = Quat::Identity();
+		const Quat end = Quat::CreateFromAxisAngle(Vec3::UnitY(), Pi * 0.5f);
+		const Quat half = Slerp(start, end, 0.5f);
+		const Quat expected = Quat::CreateFromAxisAngle(Vec3::UnitY(), Pi * 0.25f);
+		EXPECT_TRUE(std::fabs(Dot(half, expected) - 1.0f) < 1e-5f);
+		EXPECT_TRUE(std::fabs(Length(Normalize(Quat(1.0f, 2.0f, 3.0f, 4.0f)).ToVec4()) - 1.0f) < 1e-5f);
+	}
+}
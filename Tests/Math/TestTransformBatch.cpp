@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "Core/Math/Aabb.h"
+#include "Core/Math/Math.h"
+#include "Core/Math/TransformBatch.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/ParallelTransforms.h"
+
+namespace Math
+{
+	static bool NearlyEqual(const Vec3& a, const Vec3& b)
+	{
+		return Length(a - b) < 1e-4f * (1.0f + Length(b));
+	}
+
+	static bool NearlyEqual(const Mat4& a, const Mat4& b)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			const Vec4 difference = Vec4::FromSimd(Simd::Sub(a.m_Rows[row].ToSimd(), b.m_Rows[row].ToSimd()));
+			if (std::fabs(difference.m_X) + std::fabs(difference.m_Y) + std::fabs(difference.m_Z) + std::fabs(difference.m_W) > 1e-4f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static Mat4 MakeTransform(size_t i)
+	{
+		const float f = float(i);
+		return Mat4::CreateAffine(Vec3(1.0f + 0.1f * f, 2.0f, 0.5f), Quat::CreateFromAxisAngle(Normalize(Vec3(1.0f, f, 2.0f)), 0.2f * f), Vec3(f, -f, 3.0f));
+	}
+
+	// Component arrays of a set of points
+	struct Points
+	{
+		explicit Points(size_t count) : m_X(count), m_Y(count), m_Z(count) {}
+
+		SoAPoints GetView() { return { m_X.data(), m_Y.data(), m_Z.data() }; }
+		Vec3 Get(size_t i) const { return Vec3(m_X[i], m_Y[i], m_Z[i]); }
+		void Set(size_t i, const Vec3& point) { m_X[i] = point.m_X; m_Y[i] = point.m_Y; m_Z[i] = point.m_Z; }
+
+		std::vector<float> m_X;
+		std::vector<float> m_Y;
+		std::vector<float> m_Z;
+	};
+
+	// Every kernel level against Mat4 and Aabb, with counts that leave a tail after the 8 wide loops
+	TEST(TransformBatch, KernelLevels)
+	{
+		const SimdLevel supported = TransformBatch::GetSimdLevel();
+		for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::Avx2 })
+		{
+			TransformBatch::SetSimdLevel(level);
+			const bool isAvx2 = level == SimdLevel::Avx2 && GetSupportedSimdLevel() == SimdLevel::Avx2;
+			EXPECT_TRUE(TransformBatch::GetSimdLevel() == (isAvx2 ? SimdLevel::Avx2 : TransformBatch::BaselineSimdLevel));
+
+			for (size_t count : { size_t(1), size_t(7), size_t(8), size_t(29) })
+			{
+				std::vector<Mat4> locals(count);
+				std::vector<Mat4> parents(count);
+				Points points(count);
+				Points extents(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					locals[i] = MakeTransform(i);
+					parents[i] = MakeTransform(i + 3);
+					points.Set(i, Vec3(float(i), 1.0f - float(i), 0.5f * float(i)));
+					extents.Set(i, Vec3(1.0f, 0.5f + float(i), 2.0f));
+				}
+
+				const Mat4 parent = MakeTransform(11);
+				std::vector<Mat4> worlds(count);
+				TransformBatch::MultiplyMatrices(locals.data(), parent, worlds.data(), count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					EXPECT_TRUE(NearlyEqual(worlds[i], locals[i] * parent));
+				}
+
+				TransformBatch::MultiplyMatrices(locals.data(), parents.data(), worlds.data(), count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					EXPECT_TRUE(NearlyEqual(worlds[i], locals[i] * parents[i]));
+				}
+
+				// in place
+				std::vector<Mat4> inPlace = locals;
+				TransformBatch::MultiplyMatrices(inPlace.data(), parent, inPlace.data(), count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					EXPECT_TRUE(NearlyEqual(inPlace[i], locals[i] * parent));
+				}
+
+				Points results(count);
+				TransformBatch::TransformPoints(parent, points.GetView(), results.GetView(), count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					EXPECT_TRUE(NearlyEqual(results.Get(i), parent.TransformPoint(points.Get(i))));
+				}
+
+				Points worldCenters(count);
+				Points worldExtents(count);
+				TransformBatch::TransformBounds(locals.data(), SoABounds{ points.GetView(), extents.GetView() }, SoABounds{ worldCenters.GetView(), worldExtents.GetView() }, count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					const Aabb expected = Transform(Aabb::FromCenterExtents(points.Get(i), extents.Get(i)), locals[i]);
+					EXPECT_TRUE(NearlyEqual(worldCenters.Get(i), expected.GetCenter()));
+					EXPECT_TRUE(NearlyEqual(worldExtents.Get(i), expected.GetExtents()));
+				}
+			}
+		}
+		TransformBatch::SetSimdLevel(supported);
+	}
+
+	TEST(TransformBatch, Parallel)
+	{
+		JobSystem jobSystem(4);
+		constexpr size_t Count = 10007;
+
+		std::vector<Mat4> locals(Count);
+		Points points(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			locals[i] = MakeTransform(i % 64);
+			points.Set(i, Vec3(float(i % 13), float(i % 7), -1.0f));
+		}
+
+		const Mat4 parent = MakeTransform(5);
+		std::vector<Mat4> worlds(Count);
+		ParallelTransforms::MultiplyMatrices(jobSystem, locals.data(), parent, worlds.data(), Count, 256);
+
+		Points results(Count);
+		ParallelTransforms::TransformPoints(jobSystem, parent, points.GetView(), results.GetView(), Count, 256);
+
+		Points worldCenters(Count);
+		Points worldExtents(Count);
+		ParallelTransforms::TransformBounds(jobSystem, worlds.data(), SoABounds{ points.GetView(), points.GetView() }, SoABounds{ worldCenters.GetView(), worldExtents.GetView() }, Count, 256);
+
+		for (size_t i = 0; i < Count; ++i)
+		{
+			EXPECT_TRUE(NearlyEqual(worlds[i], locals[i] * parent));
+			EXPECT_TRUE(NearlyEqual(results.Get(i), parent.TransformPoint(points.Get(i))));
+			EXPECT_TRUE(NearlyEqual(worldCenters.Get(i), worlds[i].TransformPoint(points.Get(i))));
+		}
+	}
+}
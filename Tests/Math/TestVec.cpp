@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Core/Math/Vec3.h"
+#include "Core/Math/Vec4.h"
+
+namespace Math
+{
+	TEST(Vec3, Arithmetic)
+	{
+		constexpr Vec3 a(1.0f, 2.0f, 3.0f);
+		constexpr Vec3 b(4.0f, 5.0f, 6.0f);
+		static_assert(a + b == Vec3(5.0f, 7.0f, 9.0f));
+		static_assert(b - a == Vec3(3.0f));
+		static_assert(a * 2.0f == 2.0f * a);
+		static_assert(Dot(a, b) == 32.0f);
+		static_assert(Cross(Vec3::UnitX(), Vec3::UnitY()) == Vec3::UnitZ());
+		static_assert(Lerp(a, b, 0.5f) == Vec3(2.5f, 3.5f, 4.5f));
+		EXPECT_TRUE(Length(Vec3(3.0f, 4.0f, 0.0f)) == 5.0f);
+		EXPECT_TRUE(Normalize(Vec3(0.0f, 0.0f, 5.0f)) == Vec3::UnitZ());
+		EXPECT_TRUE(Normalize(Vec3::Zero()) == Vec3::Zero());
+	}
+
+	TEST(Vec4, Arithmetic)
+	{
+		const Vec4 a(1.0f, 2.0f, 3.0f, 4.0f);
+		const Vec4 b(4.0f, 3.0f, 2.0f, 1.0f);
+		EXPECT_TRUE(a + b == Vec4(5.0f));
+		EXPECT_TRUE(a - b == Vec4(-3.0f, -1.0f, 1.0f, 3.0f));
+		EXPECT_TRUE(a * b == Vec4(4.0f, 6.0f, 6.0f, 4.0f));
+		EXPECT_TRUE(-a == a * -1.0f);
+		EXPECT_TRUE(Dot(a, b) == 20.0f);
+		EXPECT_TRUE(Min(a, b) == Vec4(1.0f, 2.0f, 2.0f, 1.0f) && Max(a, b) == Vec4(4.0f, 3.0f, 3.0f, 4.0f));
+		EXPECT_TRUE(Lerp(a, b, 0.5f) == Vec4(2.5f));
+		EXPECT_TRUE(Length(Vec4(1.0f)) == 2.0f);
+		EXPECT_TRUE(a.GetXYZ() == Vec3(1.0f, 2.0f, 3.0f));
+	}
+}
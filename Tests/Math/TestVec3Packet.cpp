@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Core/Math/Math.h"
+
+namespace Math
+{
+	template<typename Packet>
+	static void CheckPacket()
+	{
+		constexpr int Width = Packet::Width;
+		Vec3 points[Width];
+		Vec3 others[Width];
+		for (int i = 0; i < Width; ++i)
+		{
+			points[i] = Vec3(float(i), float(i * 2), float(1 - i));
+			others[i] = Vec3(1.0f, float(-i), 0.5f);
+		}
+
+		const Packet a = Packet::Load(points);
+		const Packet b = Packet::Load(others);
+		Vec3 sums[Width];
+		(a + b).Store(sums);
+		Vec3 crosses[Width];
+		Cross(a, b).Store(crosses);
+		float dots[Width];
+		Simd::Store(dots, Dot(a, b));
+
+		const Mat4 transform = Mat4::CreateAffine(Vec3(2.0f), Quat::CreateFromAxisAngle(Vec3::UnitX(), 0.3f), Vec3(1.0f, 2.0f, 3.0f));
+		Vec3 transformed[Width];
+		TransformPoints(transform, a).Store(transformed);
+
+		for (int i = 0; i < Width; ++i)
+		{
+			EXPECT_TRUE(sums[i] == points[i] + others[i]);
+			EXPECT_TRUE(crosses[i] == Cross(points[i], others[i]));
+			EXPECT_TRUE(dots[i] == Dot(points[i], others[i]));
+			EXPECT_TRUE(Length(transformed[i] - transform.TransformPoint(points[i])) < 1e-4f);
+		}
+
+		float xs[Width];
+		float ys[Width];
+		float zs[Width];
+		Normalize(b).StoreSoA(xs, ys, zs);
+		for (int i = 0; i < Width; ++i)
+		{
+			EXPECT_TRUE(std::fabs(Length(Vec3(xs[i], ys[i], zs[i])) - 1.0f) < 1e-5f);
+		}
+	}
+
+	TEST(Vec3Packet, Vec3x4) { CheckPacket<Vec3x4>(); }
+	TEST(Vec3Packet, Vec3x8) { CheckPacket<Vec3x8>(); }
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/FrameArena.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace Memory
+{
+	TEST(FrameArena, Alignment)
+	{
+		FrameArena arena(1024);
+		void* byte = arena.Allocate(1, 1);
+		void* aligned = arena.Allocate(16, 16);
+		double* values = arena.Allocate<double>(4);
+
+		EXPECT_TRUE(byte != nullptr);
+		EXPECT_TRUE(reinterpret_cast<uintptr_t>(aligned) % 16 == 0);
+		EXPECT_TRUE(reinterpret_cast<uintptr_t>(values) % alignof(double) == 0);
+		EXPECT_TRUE(arena.GetUsedBytes() >= 1 + 16 + 4 * sizeof(double));
+	}
+
+	TEST(FrameArena, ResetReusesBlocks)
+	{
+		FrameArena arena(1024);
+		void* first = arena.Allocate(100);
+		void* large = arena.Allocate(2000);
+		const size_t reservedBytes = arena.GetReservedBytes();
+		const size_t usedBytes = arena.GetUsedBytes();
+
+		arena.Reset();
+		EXPECT_TRUE(arena.GetUsedBytes() == 0);
+		EXPECT_TRUE(arena.GetHighWaterMark() == usedBytes);
+
+		// same frame again, the memory comes from the same blocks
+		EXPECT_TRUE(arena.Allocate(100) == first);
+		EXPECT_TRUE(arena.Allocate(2000) == large);
+		EXPECT_TRUE(arena.GetReservedBytes() == reservedBytes);
+	}
+
+	TEST(FrameArena, PmrVector)
+	{
+		FrameArena arena;
+		PmrVector<int> values(arena.GetResource());
+		for (int i = 0; i < 1000; ++i)
+		{
+			values.PushBack(i);
+		}
+
+		EXPECT_TRUE(values[999] == 999);
+		EXPECT_TRUE(arena.GetUsedBytes() >= 1000 * sizeof(int));
+	}
+
+	TEST(FrameArena, PerThreadRegions)
+	{
+		JobSystem jobSystem(4);
+		FrameArena arena;
+
+		ParallelFor(jobSystem, IndexRange{ 0, 10'000 }, 16, [&arena](size_t i)
+		{
+			uint64_t* value = arena.Allocate<uint64_t>(1);
+			*value = i;
+			EXPECT_TRUE(*value == i);
+		});
+
+		EXPECT_TRUE(arena.GetThreadCount() >= 1);
+		EXPECT_TRUE(arena.GetThreadCount() <= jobSystem.GetWorkerCount());
+		EXPECT_TRUE(arena.GetUsedBytes() == 10'000 * sizeof(uint64_t));
+	}
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include "Core/Containers/Vector.h"
+#include "Core/Memory/PoolAllocator.h"
+
+namespace Memory
+{
+	struct PoolObject
+	{
+		explicit PoolObject(int value, int& destroyed) : m_Value(value), m_Destroyed(&destroyed) {}
+		~PoolObject() { (*m_Destroyed)++; }
+
+		int m_Value;
+		int* m_Destroyed;
+	};
+
+	TEST(PoolAllocator, ReuseFreedBlock)
+	{
+		PoolAllocator allocator(24, 8);
+		void* first = allocator.Allocate();
+		void* second = allocator.Allocate();
+		EXPECT_TRUE(first != second);
+		EXPECT_TRUE(allocator.GetLiveCount() == 2);
+
+		allocator.Free(first);
+		EXPECT_TRUE(allocator.Allocate() == first);
+		EXPECT_TRUE(allocator.GetChunkCount() == 1);
+
+		allocator.Free(first);
+		allocator.Free(second);
+		EXPECT_TRUE(allocator.GetLiveCount() == 0);
+	}
+
+	TEST(PoolAllocator, CacheLineAligned)
+	{
+		PoolAllocator allocator(8, 8, true);
+		EXPECT_TRUE(allocator.GetBlockSize() == CacheLineSize);
+		for (int i = 0; i < 100; ++i)
+		{
+			EXPECT_TRUE(reinterpret_cast<uintptr_t>(allocator.Allocate()) % CacheLineSize == 0);
+		}
+	}
+
+	TEST(PoolAllocator, PageSizedChunks)
+	{
+		PoolAllocator allocator(64, 8);
+		const size_t blocksPerChunk = allocator.GetChunkSize() / allocator.GetBlockSize();
+		EXPECT_TRUE(allocator.GetChunkSize() == PoolAllocator::PageSize);
+
+		for (size_t i = 0; i <= blocksPerChunk; ++i)
+		{
+			EXPECT_TRUE(allocator.Allocate() != nullptr);
+		}
+		EXPECT_TRUE(allocator.GetChunkCount() == 2);
+	}
+
+	TEST(PoolAllocator, FreeFromOtherThreads)
+	{
+		constexpr size_t BlockCount = 10'000;
+		PoolAllocator allocator(32, 8);
+		Vector<void*> blocks(BlockCount);
+		for (void*& block : blocks)
+		{
+			block = allocator.Allocate();
+		}
+		const size_t chunkCount = allocator.GetChunkCount();
+
+		Vector<std::thread> threads;
+		for (size_t t = 0; t < 4; ++t)
+		{
+			threads.EmplaceBack([&allocator, &blocks, t]()
+			{
+				for (size_t i = t; i < BlockCount; i += 4)
+				{
+					allocator.Free(blocks[i]);
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		EXPECT_TRUE(allocator.GetLiveCount() == 0);
+
+		// every block comes back without touching the heap
+		for (size_t i = 0; i < BlockCount; ++i)
+		{
+			EXPECT_TRUE(allocator.Allocate() != nullptr);
+		}
+		EXPECT_TRUE(allocator.GetChunkCount() == chunkCount);
+	}
+
+	TEST(Pool, MakeUnique)
+	{
+		Pool<PoolObject> pool;
+		int destroyed = 0;
+		{
+			Pool<PoolObject>::Ptr object = pool.MakeUnique(42, destroyed);
+			EXPECT_TRUE(object->m_Value == 42);
+			EXPECT_TRUE(pool.GetAllocator().GetLiveCount() == 1);
+		}
+		EXPECT_TRUE(destroyed == 1);
+		EXPECT_TRUE(pool.GetAllocator().GetLiveCount() == 0);
+	}
+}
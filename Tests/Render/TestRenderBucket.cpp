@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <random>
+
+#include "Core/Containers/Vector.h"
+#include "Render/NullRenderBackend.h"
+#include "Render/ParallelSubmit.h"
+#include "Render/RenderBucket.h"
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace Render
+{
+	static DrawPacket MakePacket(uint32_t pipeline, uint32_t material, uint32_t mesh)
+	{
+		DrawPacket packet;
+		packet.m_Pipeline = pipeline;
+		packet.m_Material = material;
+		packet.m_Mesh = mesh;
+		packet.m_IndexCount = 36;
+		return packet;
+	}
+
+	TEST(RenderBucket, SortKeyOrder)
+	{
+		// the layer wins over everything, then the pass
+		EXPECT_TRUE(SortKey::MakeOpaque(0, 15, 4095, 1, SortKey::MaxDepth) < SortKey::MakeOpaque(1, 0, 0, 0, 0));
+		EXPECT_TRUE(SortKey::MakeOpaque(1, 0, 4095, 1, 0) < SortKey::MakeOpaque(1, 1, 0, 0, 0));
+		EXPECT_TRUE(SortKey::GetLayer(SortKey::MakeOpaque(9, 3, 1, 2, 3)) == 9);
+		EXPECT_TRUE(SortKey::GetPass(SortKey::MakeOpaque(9, 3, 1, 2, 3)) == 3);
+
+		// opaque: grouped by pipeline, front to back inside a material
+		EXPECT_TRUE(SortKey::MakeOpaque(0, 0, 1, 0, SortKey::MaxDepth) < SortKey::MakeOpaque(0, 0, 2, 0, 0));
+		EXPECT_TRUE(SortKey::MakeOpaque(0, 0, 1, 5, 10) < SortKey::MakeOpaque(0, 0, 1, 5, 20));
+
+		// translucent: back to front whatever the state
+		const uint32_t near = SortKey::QuantizeDepth(0.1f);
+		const uint32_t far = SortKey::QuantizeDepth(0.9f);
+		EXPECT_TRUE(SortKey::MakeTranslucent(0, 0, 0, 0, far) < SortKey::MakeTranslucent(0, 0, 0, 0, near));
+		EXPECT_TRUE(SortKey::MakeTranslucent(0, 0, 4095, 7, far) < SortKey::MakeTranslucent(0, 0, 0, 0, near));
+
+		EXPECT_TRUE(SortKey::QuantizeDepth(-1.0f) == 0);
+		EXPECT_TRUE(SortKey::QuantizeDepth(2.0f) == SortKey::MaxDepth);
+	}
+
+	TEST(RenderBucket, SortMatchesStdSort)
+	{
+		RenderBucket bucket(4);
+		Vector<uint64_t> expected;
+		std::mt19937_64 random(42);
+		for (uint32_t i = 0; i < 10'000; ++i)
+		{
+			// narrow pipeline and material ranges and a constant layer, so that some radix passes are skipped
+			const uint64_t key = SortKey::MakeOpaque(2, random() % 3, random() % 8, random() % 64, random() % SortKey::MaxDepth);
+			// the mesh remembers the key, to check that the packets follow their keys
+			bucket.Push(i % 4, key, MakePacket(0, 0, static_cast<uint32_t>(key)));
+			expected.PushBack(key);
+		}
+		EXPECT_TRUE(bucket.GetSize() == 10'000);
+
+		bucket.Sort();
+		std::sort(expected.begin(), expected.end());
+		EXPECT_TRUE(bucket.GetSortedSize() == expected.GetSize());
+
+		bool isSorted = true;
+		bool packetsFollowKeys = true;
+		for (size_t i = 0; i < bucket.GetSortedSize(); ++i)
+		{
+			isSorted &= bucket.GetSortedKey(i) == expected[i];
+			packetsFollowKeys &= bucket.GetSortedPacket(i).m_Mesh == static_cast<uint32_t>(expected[i]);
+		}
+		EXPECT_TRUE(isSorted);
+		EXPECT_TRUE(packetsFollowKeys);
+	}
+
+	TEST(RenderBucket, SubmitSkipsRedundantState)
+	{
+		RenderBucket bucket(1);
+		// recorded interleaved, drawn grouped by pipeline then material
+		for (uint32_t i = 0; i < 12; ++i)
+		{
+			const uint32_t pipeline = i % 2;
+			const uint32_t material = i % 3;
+			bucket.Push(0, SortKey::MakeOpaque(0, 0, pipeline, material, i), MakePacket(pipeline, material, i));
+		}
+		bucket.Sort();
+
+		NullRenderBackend backend;
+		bucket.Submit(backend);
+		EXPECT_TRUE(backend.GetSubmitCount() == 1);
+		EXPECT_TRUE(backend.GetDrawCount() == 12);
+		EXPECT_TRUE(backend.GetPipelineChanges() == 2);
+		EXPECT_TRUE(backend.GetMaterialChanges() == 6);
+
+		// the storage is kept, the packets are not
+		bucket.Clear();
+		EXPECT_TRUE(bucket.GetSize() == 0);
+		bucket.Sort();
+		NullRenderBackend emptyBackend;
+		bucket.Submit(emptyBackend);
+		EXPECT_TRUE(emptyBackend.GetDrawCount() == 0);
+		EXPECT_TRUE(emptyBackend.GetPipelineChanges() == 0);
+	}
+
+	TEST(RenderBucket, ParallelRecording)
+	{
+		JobSystem jobSystem(4);
+		RenderBucket bucket(jobSystem.GetWorkerCount());
+		constexpr size_t DrawCount = 50'000;
+
+		ParallelFor(jobSystem, IndexRange{ 0, DrawCount }, 256, [&](IndexRange chunk)
+		{
+			for (size_t i = chunk.m_Begin; i < chunk.m_End; ++i)
+			{
+				const uint32_t index = static_cast<uint32_t>(i);
+				bucket.Push(jobSystem, SortKey::MakeOpaque(0, 0, index % 16, 0, index), MakePacket(index % 16, 0, index));
+			}
+		});
+		EXPECT_TRUE(bucket.GetSize() == DrawCount);
+
+		bucket.Sort();
+		bool isSorted = true;
+		for (size_t i = 1; i < bucket.GetSortedSize(); ++i)
+		{
+			isSorted &= bucket.GetSortedKey(i - 1) <= bucket.GetSortedKey(i);
+		}
+		EXPECT_TRUE(isSorted);
+
+		NullRenderBackend backend;
+		bucket.Submit(backend);
+		EXPECT_TRUE(backend.GetDrawCount() == DrawCount);
+		EXPECT_TRUE(backend.GetPipelineChanges() == 16);
+	}
+
+	TEST(RenderBucket, ParallelSubmitRanges)
+	{
+		EXPECT_TRUE(ParallelSubmit::GetRangeCount(0, 8) == 1);
+		EXPECT_TRUE(ParallelSubmit::GetRangeCount(ParallelSubmit::MinPacketsPerRange, 8) == 1);
+		EXPECT_TRUE(ParallelSubmit::GetRangeCount(ParallelSubmit::MinPacketsPerRange + 1, 8) == 2);
+		EXPECT_TRUE(ParallelSubmit::GetRangeCount(1'000'000, 8) == 8);
+
+		// contiguous, complete and balanced
+		size_t end = 0;
+		bool isContiguous = true;
+		for (uint32_t i = 0; i < 7; ++i)
+		{
+			const IndexRange range = ParallelSubmit::GetRange(1000, 7, i);
+			isContiguous &= range.m_Begin == end && (range.GetSize() == 142 || range.GetSize() == 143);
+			end = range.m_End;
+		}
+		EXPECT_TRUE(isContiguous);
+		EXPECT_TRUE(end == 1000);
+	}
+
+	TEST(RenderBucket, ParallelSubmitMatchesSerial)
+	{
+		JobSystem jobSystem(4);
+		RenderBucket bucket(1);
+		constexpr uint32_t DrawCount = 10'000;
+		for (uint32_t i = 0; i < DrawCount; ++i)
+		{
+			const uint32_t pipeline = (i * 7) % 5;
+			const uint32_t material = (i * 13) % 11;
+			bucket.Push(0, SortKey::MakeOpaque(0, 0, pipeline, material, i), MakePacket(pipeline, material, i));
+		}
+		bucket.Sort();
+
+		const uint32_t rangeCount = ParallelSubmit::GetRangeCount(bucket.GetSortedSize(), jobSystem.GetWorkerCount());
+		EXPECT_TRUE(rangeCount == 4);
+
+		NullRenderBackend parallelBackends[4];
+		ParallelSubmit::Run(jobSystem, bucket, rangeCount, [&](uint32_t range) -> IRenderBackend& { return parallelBackends[range]; });
+
+		// each range sees what a serial submit of the same range sees, whichever worker recorded it
+		size_t drawCount = 0;
+		bool matchesSerial = true;
+		for (uint32_t range = 0; range < rangeCount; ++range)
+		{
+			NullRenderBackend serialBackend;
+			bucket.Submit(serialBackend, ParallelSubmit::GetRange(bucket.GetSortedSize(), rangeCount, range));
+			matchesSerial &= parallelBackends[range].GetChecksum() == serialBackend.GetChecksum();
+			matchesSerial &= parallelBackends[range].GetDrawCount() == serialBackend.GetDrawCount();
+			// the state is set again at the start of every range
+			matchesSerial &= parallelBackends[range].GetPipelineChanges() >= 1;
+			drawCount += parallelBackends[range].GetDrawCount();
+		}
+		EXPECT_TRUE(matchesSerial);
+		EXPECT_TRUE(drawCount == DrawCount);
+	}
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "Core/Math/Math.h"
+#include "Scene/TransformHierarchy.h"
+#include "Tasks/JobSystem.h"
+
+namespace Scene
+{
+	static bool NearlyEqual(const Vec3& a, const Vec3& b)
+	{
+		return Length(a - b) < 1e-3f;
+	}
+
+	static Mat4 Translate(float x, float y = 0.0f, float z = 0.0f)
+	{
+		return Mat4::CreateTranslation(Vec3(x, y, z));
+	}
+
+	TEST(TransformHierarchy, ParentsFirst)
+	{
+		TransformHierarchy hierarchy;
+		// children created before their parents are reparented, the order is fixed by Update
+		const TransformHierarchy::Handle grandChild = hierarchy.Create(Translate(0.0f, 0.0f, 1.0f));
+		const TransformHierarchy::Handle child = hierarchy.Create(Translate(0.0f, 1.0f));
+		const TransformHierarchy::Handle root = hierarchy.Create(Translate(1.0f));
+		hierarchy.SetParent(grandChild, child);
+		hierarchy.SetParent(child, root);
+		hierarchy.Update();
+
+		EXPECT_TRUE(hierarchy.GetLevelCount() == 3);
+		EXPECT_TRUE(hierarchy.GetUpdatedCount() == 3);
+		EXPECT_TRUE(hierarchy.GetParent(grandChild) == child);
+		EXPECT_TRUE(NearlyEqual(hierarchy.GetWorld(grandChild).GetTranslation(), Vec3(1.0f, 1.0f, 1.0f)));
+
+		// only the moved subtree is recomputed
+		hierarchy.SetLocal(child, Translate(0.0f, 2.0f));
+		hierarchy.Update();
+		EXPECT_TRUE(hierarchy.GetUpdatedCount() == 2);
+		EXPECT_TRUE(NearlyEqual(hierarchy.GetWorld(grandChild).GetTranslation(), Vec3(1.0f, 2.0f, 1.0f)));
+		EXPECT_TRUE(NearlyEqual(hierarchy.GetWorld(root).GetTranslation(), Vec3(1.0f, 0.0f, 0.0f)));
+
+		hierarchy.Update();
+		EXPECT_TRUE(hierarchy.GetUpdatedCount() == 0);
+	}
+
+	TEST(TransformHierarchy, RotationsCompose)
+	{
+		TransformHierarchy hierarchy;
+		const Quat quarterTurn = Quat::CreateFromAxisAngle(Vec3::UnitZ(), Math::Pi / 2.0f);
+		const TransformHierarchy::Handle root = hierarchy.Create(Mat4::CreateFromQuaternion(quarterTurn));
+		const TransformHierarchy::Handle arm = hierarchy.Create(Translate(2.0f), root);
+		hierarchy.Update();
+
+		// the child is placed in the rotated frame of its parent
+		EXPECT_TRUE(NearlyEqual(hierarchy.GetWorld(arm).GetTranslation(), Vec3(0.0f, 2.0f, 0.0f)));
+	}
+
+	TEST(TransformHierarchy, DestroySubtree)
+	{
+		TransformHierarchy hierarchy;
+		const TransformHierarchy::Handle root = hierarchy.Create(Translate(1.0f));
+		const TransformHierarchy::Handle branch = hierarchy.Create(Translate(1.0f), root);
+		const TransformHierarchy::Handle leaf = hierarchy.Create(Translate(1.0f), branch);
+		const TransformHierarchy::Handle other = hierarchy.Create(Translate(5.0f), root);
+		const TransformHierarchy::Handle otherLeaf = hierarchy.Create(Translate(5.0f), other);
+		hierarchy.Update();
+
+		hierarchy.Destroy(branch);
+		EXPECT_TRUE(hierarchy.GetSize() == 3);
+		EXPECT_TRUE(!hierarchy.Contains(branch) && !hierarchy.Contains(leaf));
+		EXPECT_TRUE(hierarchy.GetParent(otherLeaf) == other);
+
+		hierarchy.SetLocal(root, Translate(2.0f));
+		hierarchy.Update();
+		EXPECT_TRUE(hierarchy.GetUpdatedCount() == 3);
+		EXPECT_TRUE(NearlyEqual(hierarchy.GetWorld(otherLeaf).GetTranslation(), Vec3(12.0f, 0.0f, 0.0f)));
+
+		hierarchy.Destroy(root);
+		EXPECT_TRUE(hierarchy.GetSize() == 0 && hierarchy.GetLevelCount() == 0);
+	}
+
+	// Parallel levels against the serial pass on a wide tree
+	TEST(TransformHierarchy, ParallelLevels)
+	{
+		JobSystem jobSystem(4);
+		TransformHierarchy serial;
+		TransformHierarchy parallel;
+		Vector<TransformHierarchy::Handle> serialNodes;
+		Vector<TransformHierarchy::Handle> parallelNodes;
+		constexpr uint32_t Count = 20000;
+		for (uint32_t i = 0; i < Count; ++i)
+		{
+			const Mat4 local = Mat4::CreateAffine(Vec3(1.0f), Quat::CreateFromAxisAngle(Vec3::UnitY(), 0.01f * float(i % 17)), Vec3(float(i % 5), 1.0f, 0.0f));
+			const bool isRoot = i < 4;
+			serialNodes.PushBack(serial.Create(local, isRoot ? TransformHierarchy::Handle() : serialNodes[(i - 1) / 8]));
+			parallelNodes.PushBack(parallel.Create(local, isRoot ? TransformHierarchy::Handle() : parallelNodes[(i - 1) / 8]));
+		}
+
+		for (int frame = 0; frame < 3; ++frame)
+		{
+			for (uint32_t i = frame; i < Count; i += 97)
+			{
+				serial.SetLocal(serialNodes[i], Translate(float(frame)));
+				parallel.SetLocal(parallelNodes[i], Translate(float(frame)));
+			}
+			serial.Update();
+			parallel.Update(&jobSystem);
+
+			EXPECT_TRUE(serial.GetUpdatedCount() == parallel.GetUpdatedCount());
+			for (uint32_t i = 0; i < Count; ++i)
+			{
+				EXPECT_TRUE(serial.GetWorld(serialNodes[i]).GetTranslation() == parallel.GetWorld(parallelNodes[i]).GetTranslation());
+			}
+		}
+	}
+}
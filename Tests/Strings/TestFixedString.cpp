@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "Core/Strings/FixedString.h"
+
+namespace Strings
+{
+	TEST(FixedString, Constexpr)
+	{
+		constexpr FixedString<16> name("Player");
+		static_assert(name.GetSize() == 6);
+		static_assert(name == std::string_view("Player"));
+		EXPECT_TRUE(name.CStr()[6] == '\0');
+	}
+
+	TEST(FixedString, Append)
+	{
+		FixedString<8> text;
+		EXPECT_TRUE(text.IsEmpty());
+		EXPECT_TRUE(text.Append("Nih"));
+		EXPECT_TRUE(text.Append('-'));
+		EXPECT_TRUE(text.View() == "Nih-");
+
+		// cut at the capacity and still terminated
+		EXPECT_TRUE(!text.Append("Engine"));
+		EXPECT_TRUE(text.GetSize() == 8);
+		EXPECT_TRUE(text == std::string_view("Nih-Engi"));
+		EXPECT_TRUE(text.CStr()[8] == '\0');
+
+		text = "Window";
+		EXPECT_TRUE(text.View() == "Window");
+		text.Clear();
+		EXPECT_TRUE(text.IsEmpty() && text.CStr()[0] == '\0');
+	}
+
+	TEST(FixedString, Compare)
+	{
+		const FixedString<8> a("abc");
+		const FixedString<32> b("abc");
+		EXPECT_TRUE(a == b);
+		EXPECT_TRUE(a < std::string_view("abd"));
+		EXPECT_TRUE(!(a == std::string_view("ab")));
+	}
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Core/Containers/HashMap.h"
+#include "Core/Strings/StringId.h"
+
+namespace Strings
+{
+	TEST(StringId, CompileTime)
+	{
+		constexpr StringId id = "Player"_sid;
+		static_assert(id.IsValid());
+		static_assert(id == StringId(std::string_view("Player")));
+		static_assert(id != "Enemy"_sid);
+		// FNV-1a of the empty string is the offset basis
+		static_assert(StringId::HashString("") == StringId::FnvOffsetBasis);
+		static_assert(StringId::HashString("a") == 0xaf63dc4c8601ec8cull);
+		EXPECT_TRUE(!StringId().IsValid());
+	}
+
+	TEST(StringId, RunTime)
+	{
+		const std::string text = std::string("Pla") + "yer";
+		const StringId id(text);
+		EXPECT_TRUE(id == "Player"_sid);
+		EXPECT_TRUE(StringId::FromValue(id.GetValue()) == id);
+	}
+
+	TEST(StringId, HashMapKey)
+	{
+		HashMap<StringId, int> map;
+		map["Texture"_sid] = 1;
+		map["Mesh"_sid] = 2;
+		const int* mesh = map.Find("Mesh"_sid);
+		EXPECT_TRUE(mesh != nullptr && *mesh == 2);
+		EXPECT_TRUE(!map.Contains("Sound"_sid));
+	}
+
+#if defined(NIH_STRINGID_NAMES)
+	TEST(StringId, Names)
+	{
+		std::vector<std::thread> threads;
+		for (int thread = 0; thread < 4; ++thread)
+		{
+			threads.emplace_back([]()
+			{
+				for (int i = 0; i < 256; ++i)
+				{
+					[[maybe_unused]] const StringId id(std::string("Resource") + std::to_string(i));
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		const StringId id(std::string("Resource42"));
+		EXPECT_TRUE(id.GetName() != nullptr && std::string_view(id.GetName()) == "Resource42");
+		EXPECT_TRUE(StringId::FromValue(12345).GetName() == nullptr);
+	}
+#endif
+}
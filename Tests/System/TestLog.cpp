@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "Core/Containers/Vector.h"
+#include "System/Log.h"
+
+namespace System
+{
+	Vector<std::string> s_Messages;
+
+	void CaptureSink(LogSeverity, const char* message)
+	{
+		s_Messages.PushBack(message);
+	}
+
+	bool EndsWith(const std::string& message, const std::string& suffix)
+	{
+		return message.size() >= suffix.size() && message.compare(message.size() - suffix.size(), suffix.size(), suffix) == 0;
+	}
+
+	TEST(Log, FormatOnFlush)
+	{
+		s_Messages.Clear();
+		Log::SetSink(&CaptureSink);
+
+		Log::Write(LogSeverity::Info, "Update: {} {} {} {}", 42, 1.5f, true, "text");
+		Log::Write(LogSeverity::Error, "No argument {}");
+		EXPECT_TRUE(s_Messages.IsEmpty());
+
+		Log::Flush();
+		Log::SetSink(nullptr);
+
+		EXPECT_TRUE(s_Messages.GetSize() == 2);
+		EXPECT_TRUE(EndsWith(s_Messages[0], "[Info] Update: 42 1.500000 true text\n"));
+		EXPECT_TRUE(EndsWith(s_Messages[1], "[Error] No argument {}\n"));
+	}
+
+	TEST(Log, DropWhenFull)
+	{
+		s_Messages.Clear();
+		Log::SetSink(&CaptureSink);
+
+		const uint64_t droppedCount = Log::GetDroppedCount();
+		for (int i = 0; i < 5000; ++i)
+		{
+			Log::Write(LogSeverity::Trace, "{}", i);
+		}
+		EXPECT_TRUE(Log::GetDroppedCount() > droppedCount);
+
+		Log::Flush();
+		Log::SetSink(nullptr);
+		EXPECT_TRUE(!s_Messages.IsEmpty() && s_Messages.GetSize() < 5000);
+	}
+
+	TEST(Log, ThreadsComeAndGo)
+	{
+		s_Messages.Clear();
+		Log::SetSink(&CaptureSink);
+
+		// more threads than buffers over the run, the buffers of the exited ones are reused
+		const uint64_t droppedCount = Log::GetDroppedCount();
+		for (int i = 0; i < 300; ++i)
+		{
+			std::thread thread([i]() { Log::Write(LogSeverity::Info, "Thread {}", i); });
+			thread.join();
+		}
+		Log::Flush();
+		Log::SetSink(nullptr);
+
+		EXPECT_TRUE(Log::GetDroppedCount() == droppedCount);
+		EXPECT_TRUE(s_Messages.GetSize() == 300);
+	}
+
+	TEST(Log, CompiledOut)
+	{
+		int evaluated = 0;
+		auto evaluate = [&evaluated]() { return ++evaluated; };
+		if constexpr (NIH_LOG_MIN_SEVERITY > 0)
+		{
+			NIH_LOG_TRACE("{}", evaluate());
+			EXPECT_TRUE(evaluated == 0);
+		}
+		NIH_LOG_ERROR("{}", evaluate());
+		EXPECT_TRUE(evaluated == 1);
+		Log::Flush();
+	}
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "Tasks/JobSystem.h"
+#include "Tasks/WorkStealingDeque.h"
+
+namespace Tasks
+{
+	struct IncrementJob : Job
+	{
+		std::atomic<uint32_t>* m_Value{nullptr};
+	};
+
+	void Increment(Job& job)
+	{
+		static_cast<IncrementJob&>(job).m_Value->fetch_add(1);
+	}
+
+	TEST(WorkStealingDeque, PushPop)
+	{
+		WorkStealingDeque<int, 4> deque;
+		EXPECT_TRUE(deque.Push(1));
+		EXPECT_TRUE(deque.Push(2));
+		EXPECT_TRUE(deque.GetSize() == 2);
+
+		int value = 0;
+		EXPECT_TRUE(deque.Pop(value));
+		EXPECT_TRUE(value == 2);
+		EXPECT_TRUE(deque.Steal(value));
+		EXPECT_TRUE(value == 1);
+		EXPECT_FALSE(deque.Pop(value));
+	}
+
+	TEST(WorkStealingDeque, Full)
+	{
+		WorkStealingDeque<int, 2> deque;
+		EXPECT_TRUE(deque.Push(1));
+		EXPECT_TRUE(deque.Push(2));
+		EXPECT_FALSE(deque.Push(3));
+	}
+
+	TEST(JobSystem, ScheduleAndWait)
+	{
+		JobSystem jobSystem(4);
+		std::atomic<uint32_t> value{0};
+
+		Vector<IncrementJob> jobs(1000);
+		JobCounter counter;
+		for (IncrementJob& job : jobs)
+		{
+			job.m_Function = &Increment;
+			job.m_Value = &value;
+			jobSystem.Schedule(job, counter);
+		}
+		jobSystem.Wait(counter);
+
+		EXPECT_TRUE(counter.IsDone());
+		EXPECT_TRUE(value.load() == 1000);
+	}
+
+	TEST(JobSystem, SingleWorker)
+	{
+		JobSystem jobSystem(1);
+		EXPECT_TRUE(jobSystem.GetWorkerCount() == 1);
+		EXPECT_TRUE(jobSystem.GetCurrentWorkerIndex() == 0);
+
+		std::atomic<uint32_t> value{0};
+		IncrementJob job;
+		job.m_Function = &Increment;
+		job.m_Value = &value;
+
+		JobCounter counter;
+		jobSystem.Schedule(job, counter);
+		jobSystem.Wait(counter);
+		EXPECT_TRUE(value.load() == 1);
+	}
+}
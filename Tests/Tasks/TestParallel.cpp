@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "Tasks/JobSystem.h"
+#include "Tasks/Parallel.h"
+
+namespace Tasks
+{
+	TEST(Parallel, ForEachIndex)
+	{
+		JobSystem jobSystem(4);
+		Vector<int> values(100'000, 0);
+
+		ParallelFor(jobSystem, IndexRange{ 0, values.GetSize() }, 64, [&values](size_t i)
+		{
+			values[i] += static_cast<int>(i);
+		});
+
+		for (size_t i = 0; i < values.GetSize(); ++i)
+		{
+			EXPECT_TRUE(values[i] == static_cast<int>(i));
+		}
+	}
+
+	TEST(Parallel, ForEachRange)
+	{
+		JobSystem jobSystem(4);
+		std::atomic<size_t> visited{0};
+		std::atomic<size_t> maxChunk{0};
+
+		ParallelFor(jobSystem, IndexRange{ 10, 10'010 }, 100, [&](IndexRange chunk)
+		{
+			visited.fetch_add(chunk.GetSize());
+			size_t current = maxChunk.load();
+			while (chunk.GetSize() > current && !maxChunk.compare_exchange_weak(current, chunk.GetSize()))
+			{
+			}
+		});
+
+		EXPECT_TRUE(visited.load() == 10'000);
+		EXPECT_TRUE(maxChunk.load() <= 100);
+	}
+
+	TEST(Parallel, Reduce)
+	{
+		JobSystem jobSystem(4);
+		const uint64_t sum = ParallelReduce(jobSystem, IndexRange{ 0, 1'000'000 }, 1000, uint64_t{ 0 },
+			[](IndexRange chunk, uint64_t accumulator)
+			{
+				for (size_t i = chunk.m_Begin; i < chunk.m_End; ++i)
+				{
+					accumulator += i;
+				}
+				return accumulator;
+			},
+			[](uint64_t lhs, uint64_t rhs) { return lhs + rhs; });
+
+		EXPECT_TRUE(sum == 999'999ull * 1'000'000ull / 2);
+	}
+
+	TEST(Parallel, EmptyRange)
+	{
+		JobSystem jobSystem(2);
+		bool called = false;
+		ParallelFor(jobSystem, IndexRange{ 5, 5 }, 1, [&called](size_t) { called = true; });
+		EXPECT_FALSE(called);
+
+		const int result = ParallelReduce(jobSystem, IndexRange{}, 1, 0,
+			[](IndexRange, int accumulator) { return accumulator + 1; },
+			[](int lhs, int rhs) { return lhs + rhs; });
+		EXPECT_TRUE(result == 0);
+	}
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "Tasks/JobSystem.h"
+#include "Tasks/TaskGraph.h"
+
+namespace Tasks
+{
+	class RecordTask : public Task
+	{
+	public:
+		RecordTask(Vector<int>& record, int id)
+			: m_Record(record)
+			, m_Id(id)
+		{
+		}
+
+		void Init() override {}
+		void Update(float) override { m_Record.PushBack(m_Id); }
+
+	private:
+		Vector<int>& m_Record;
+		int m_Id;
+	};
+
+	constexpr TaskResource ResourceA = 1;
+	constexpr TaskResource ResourceB = 2;
+
+	TEST(TaskGraph, WritesAreOrdered)
+	{
+		JobSystem jobSystem(4);
+		Vector<int> record;
+
+		RecordTask first(record, 0);
+		RecordTask second(record, 1);
+		RecordTask third(record, 2);
+		first.DeclareWrite(ResourceA);
+		second.DeclareWrite(ResourceA);
+		third.DeclareWrite(ResourceA);
+
+		Vector<Task*> tasks{ &first, &second, &third };
+		TaskGraph graph;
+		for (int frame = 0; frame < 100; ++frame)
+		{
+			graph.Build(tasks);
+			graph.Run(jobSystem, 0.0f);
+		}
+
+		EXPECT_TRUE(graph.GetEdgeCount() == 2);
+		EXPECT_TRUE(graph.GetCriticalPathTaskCount() == 3);
+		EXPECT_TRUE(record.GetSize() == 300);
+		for (size_t i = 0; i < record.GetSize(); ++i)
+		{
+			EXPECT_TRUE(record[i] == static_cast<int>(i % 3));
+		}
+	}
+
+	TEST(TaskGraph, ReadersShareAWriter)
+	{
+		Vector<int> recordA;
+		Vector<int> recordB;
+		Vector<int> recordC;
+
+		RecordTask writer(recordA, 0);
+		RecordTask reader0(recordB, 1);
+		RecordTask reader1(recordC, 2);
+		RecordTask lastWriter(recordA, 3);
+		writer.DeclareWrite(ResourceA);
+		reader0.DeclareRead(ResourceA);
+		reader1.DeclareRead(ResourceA);
+		reader1.DeclareWrite(ResourceB);
+		lastWriter.DeclareWrite(ResourceA);
+
+		Vector<Task*> tasks{ &writer, &reader0, &reader1, &lastWriter };
+		TaskGraph graph;
+		graph.Build(tasks);
+
+		// writer -> reader0, writer -> reader1, reader0 -> lastWriter, reader1 -> lastWriter
+		EXPECT_TRUE(graph.GetEdgeCount() == 4);
+
+		JobSystem jobSystem(4);
+		graph.Run(jobSystem, 0.0f);
+		EXPECT_TRUE(graph.GetCriticalPathTaskCount() == 3);
+		EXPECT_TRUE((recordA == Vector<int>{ 0, 3 }));
+	}
+
+	TEST(TaskGraph, IndependentTasks)
+	{
+		Vector<int> recordA;
+		Vector<int> recordB;
+
+		RecordTask taskA(recordA, 0);
+		RecordTask taskB(recordB, 1);
+		taskA.DeclareWrite(ResourceA);
+		taskB.DeclareWrite(ResourceB);
+
+		Vector<Task*> tasks{ &taskA, &taskB };
+		TaskGraph graph;
+		graph.Build(tasks);
+		EXPECT_TRUE(graph.GetEdgeCount() == 0);
+
+		JobSystem jobSystem(2);
+		graph.Run(jobSystem, 0.0f);
+		EXPECT_TRUE(graph.GetCriticalPathTaskCount() == 1);
+		EXPECT_TRUE(recordA.GetSize() == 1 && recordB.GetSize() == 1);
+	}
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "Window/EventQueue.h"
+#include "Window/HeadlessWindow.h"
+
+namespace Platform
+{
+	WindowEvent MakeKeyDown(uint32_t key)
+	{
+		WindowEvent event;
+		event.m_Type = WindowEventType::KeyDown;
+		event.m_Code = key;
+		return event;
+	}
+
+	TEST(EventQueue, Frame)
+	{
+		EventQueue queue;
+		queue.Push(MakeKeyDown(1));
+		queue.Push(MakeKeyDown(2));
+
+		queue.BeginFrame();
+		// events pushed while a frame is open belong to the next frame
+		queue.Push(MakeKeyDown(3));
+		EXPECT_TRUE(queue.GetEventCount() == 2);
+		EXPECT_TRUE(queue.GetEvent(0).m_Code == 1);
+		EXPECT_TRUE(queue.GetEvent(1).m_Code == 2);
+		queue.EndFrame();
+
+		queue.BeginFrame();
+		EXPECT_TRUE(queue.GetEventCount() == 1);
+		EXPECT_TRUE(queue.GetEvent(0).m_Code == 3);
+		EXPECT_TRUE(queue.Contains(WindowEventType::KeyDown));
+		EXPECT_FALSE(queue.Contains(WindowEventType::Quit));
+		queue.EndFrame();
+	}
+
+	TEST(EventQueue, Full)
+	{
+		EventQueue queue;
+		for (uint32_t i = 0; i < EventQueue::Capacity; ++i)
+		{
+			EXPECT_TRUE(queue.Push(MakeKeyDown(i)));
+		}
+		EXPECT_FALSE(queue.Push(MakeKeyDown(0)));
+		EXPECT_TRUE(queue.GetDroppedCount() == 1);
+
+		queue.BeginFrame();
+		uint32_t count = 0;
+		queue.ForEach([&count](const WindowEvent& event) { EXPECT_TRUE(event.m_Code == count++); });
+		EXPECT_TRUE(count == EventQueue::Capacity);
+		queue.EndFrame();
+
+		EXPECT_TRUE(queue.Push(MakeKeyDown(0)));
+	}
+
+	TEST(HeadlessWindow, UpdateMessages)
+	{
+		HeadlessWindow window;
+		window.PostEvent(MakeKeyDown(7));
+		window.PostEvent(MakeKeyDown(8));
+
+		EventQueue& queue = window.GetEventQueue();
+		queue.BeginFrame();
+		EXPECT_TRUE(queue.GetEventCount() == 0);
+		queue.EndFrame();
+
+		window.UpdateMessages();
+		queue.BeginFrame();
+		EXPECT_TRUE(queue.GetEventCount() == 2);
+		queue.EndFrame();
+	}
+}